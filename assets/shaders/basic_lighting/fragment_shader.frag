@@ -8,8 +8,8 @@ layout (location = 0) out vec4 FragColor;
 uniform vec3 uLightColor;
 uniform vec3 uObjectColor;
 uniform vec3 uLightPos;    // En world space
-uniform vec3 uViewPos;     // En world space (posición de cámara)
-uniform mat4 uView; 
+
+#include "../include/camera.glsl"
 
 void main()
 {
@@ -18,7 +18,7 @@ void main()
     
     // Convertir todo a view space
     vec3 lightPosView = vec3(uView * vec4(uLightPos, 1.0));
-    vec3 viewPosView = vec3(uView * vec4(uViewPos, 1.0)); 
+    vec3 viewPosView = vec3(uView * vec4(uCameraPosition, 1.0)); 
     
     vec3 norm = normalize(vNormal);
     vec3 lightDir = normalize(lightPosView - FragPos);
@@ -6,8 +6,8 @@ layout (location = 1) in vec3 aNormal;
 layout (location = 0) out vec3 FragPos; 
 layout (location = 1) out vec3 vNormal;
 
-uniform mat4 uProjection;
-uniform mat4 uView; 
+#include "../include/camera.glsl"
+
 uniform mat4 uModel;
 
 void main()
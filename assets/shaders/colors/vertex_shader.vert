@@ -2,11 +2,11 @@
 
 layout (location = 0) in vec3 aPos;
 
-uniform mat4 uProjection;
-uniform mat4 uView; 
+#include "../include/camera.glsl"
+
 uniform mat4 uModel;
 
 void main()
 {
-    gl_Position = uProjection * uView * uModel * vec4(aPos, 1.0);
+    gl_Position = uViewProjection * uModel * vec4(aPos, 1.0);
 }
\ No newline at end of file
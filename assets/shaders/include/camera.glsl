@@ -0,0 +1,13 @@
+// Bloque compartido de la camara (engine::graphics::CameraUniforms)
+layout (std140, binding = 0) uniform Camera {
+    mat4 uView;
+    mat4 uProjection;
+    mat4 uViewProjection;
+    mat4 uInverseView;
+    mat4 uInverseProjection;
+    vec3 uCameraPosition;
+    float uZNear;
+    float uZFar;
+    float uFov;
+    float uAspectRatio;
+};
@@ -0,0 +1,12 @@
+// Luz del bloque "Lights" (engine::core::Light con layout std140)
+struct Light {
+    vec3 position;
+
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+};
+
+layout (std140) uniform Lights {
+    Light uLight;
+};
@@ -0,0 +1,20 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec4 aColor;
+layout (location = 2) in vec2 aTexCoords;
+layout (location = 4) in mat4 aModel;
+layout (location = 11) in vec4 aTint;
+
+layout (location = 0) out vec4 vColor;
+layout (location = 1) out vec2 vTexCoords;
+
+#include "../include/camera.glsl"
+
+void main()
+{
+    gl_Position = uViewProjection * aModel * vec4(aPos, 1.0);
+
+    vColor = aColor * aTint;
+    vTexCoords = aTexCoords;
+}
@@ -1,10 +0,0 @@
-#version 460 core
-
-layout (location = 0) out vec4 FragColor;
-
-uniform vec3 uLightColor;
-
-void main()
-{
-    FragColor = vec4(uLightColor, 1.0);
-}
\ No newline at end of file
@@ -6,25 +6,19 @@ layout (location = 2) in vec3 vNormal;
 
 layout (location = 0) out vec4 FragColor;
 
-uniform mat4 uView;
+#include "../include/camera.glsl"
 
 struct Material {
     sampler2D diffuse;
+#ifdef HAS_SPECULAR_MAP
     sampler2D specular;
+#endif
     float shininess;
 };
 
 uniform Material uMaterial;
 
-struct Light {
-    vec3 position;
-
-    vec3 ambient;
-    vec3 diffuse;
-    vec3 specular;
-};
-
-uniform Light uLight;
+#include "../include/light.glsl"
 
 void main() 
 {
@@ -38,7 +32,11 @@ void main()
     float diff = max(dot(norm, lightDir), 0.0);
     vec3 diffuse = (diff * diffuseMap) * uLight.diffuse;
 
+#ifdef HAS_SPECULAR_MAP
     vec3 specularMap = vec3(texture(uMaterial.specular, vTexCoords));
+#else
+    vec3 specularMap = vec3(0.5);
+#endif
     vec3 viewDir = normalize(-vFragPos);
     vec3 reflectDir = reflect(-lightDir, norm);
     float spec = pow(max(dot(viewDir, reflectDir), 0.0), uMaterial.shininess);
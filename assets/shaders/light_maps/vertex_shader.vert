@@ -8,16 +8,15 @@ layout (location = 0) out vec3 vFragPos;
 layout (location = 1) out vec2 vTexCoords;
 layout (location = 2) out vec3 vNormal;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
+#include "../include/camera.glsl"
+
 uniform mat4 uModel;
-uniform mat3 uNormalMatrix;
 
 void main()
 {
     mat4 modelView = uView * uModel;
     gl_Position = uProjection * modelView * vec4(aPos, 1.0);
     vFragPos = vec3(modelView * vec4(aPos, 1.0));
-    vNormal = uNormalMatrix * aNormal;
+    vNormal = mat3(transpose(inverse(modelView))) * aNormal;
     vTexCoords = aTexCoords;
 }
\ No newline at end of file
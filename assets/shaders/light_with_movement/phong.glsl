@@ -0,0 +1,25 @@
+// Iluminacion Phong en view space, comun a la variante por pixel y a GOURAUD (por vertice)
+uniform vec3 uLightColor;
+uniform vec3 uLightPos;    // En world space
+uniform float uAmbientStrength;
+uniform float uSpecularStrength;
+uniform float uBrightness;
+
+vec3 phong(vec3 fragPos, vec3 norm)
+{
+    vec3 ambient = uAmbientStrength * uLightColor;
+
+    vec3 lightPosView = vec3(uView * vec4(uLightPos, 1.0));
+    vec3 lightDir = normalize(lightPosView - fragPos);
+
+    float diff = max(dot(norm, lightDir), 0.0);
+    vec3 diffuse = diff * uLightColor;
+
+    vec3 viewDir = normalize(-fragPos);
+    vec3 reflectDir = reflect(-lightDir, norm);
+
+    float spec = pow(max(dot(viewDir, reflectDir), 0.0), uBrightness);
+    vec3 specular = uSpecularStrength * spec * uLightColor;
+
+    return ambient + diffuse + specular;
+}
@@ -4,20 +4,35 @@ layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec2 aTexCoords;
 layout (location = 2) in vec3 aNormal;
 
+#ifdef GOURAUD
+layout (location = 0) out vec4 vLightColor;
+#else
 layout (location = 0) out vec3 vFragPos;
-layout (location = 1) out vec2 vTexCoords;
 layout (location = 2) out vec3 vNormal;
+#endif
+layout (location = 1) out vec2 vTexCoords;
+
+#include "../include/camera.glsl"
 
-uniform mat4 uProjection;
-uniform mat4 uView;
 uniform mat4 uModel;
 
+#ifdef GOURAUD
+#include "phong.glsl"
+#endif
+
 void main()
 {
     mat4 modelView = uView * uModel;
 
     gl_Position = uProjection * modelView * vec4(aPos, 1.0);
-    vFragPos = vec3(modelView * vec4(aPos, 1.0));
+    vec3 fragPos = vec3(modelView * vec4(aPos, 1.0));
+    vec3 normal = mat3(transpose(inverse(modelView))) * aNormal;
+
+#ifdef GOURAUD
+    vLightColor = vec4(phong(fragPos, normalize(normal)), 1.0);
+#else
+    vFragPos = fragPos;
+    vNormal = normal;
+#endif
     vTexCoords = aTexCoords;
-    vNormal = mat3(transpose(inverse(modelView))) * aNormal;
-}
\ No newline at end of file
+}
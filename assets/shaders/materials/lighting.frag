@@ -6,7 +6,7 @@ layout (location = 2) in vec3 vNormal;
 
 layout (location = 0) out vec4 FragColor;
 
-uniform mat4 uView;
+#include "../include/camera.glsl"
 
 struct Material {
     vec3 ambient;
@@ -15,17 +15,11 @@ struct Material {
     float shininess;
 };
 
-uniform Material uMaterial;
-
-struct Light {
-    vec3 position;
-
-    vec3 ambient;
-    vec3 diffuse;
-    vec3 specular;
+layout (std140) uniform Materials {
+    Material uMaterial;
 };
 
-uniform Light uLight;
+#include "../include/light.glsl"
 
 void main() 
 {
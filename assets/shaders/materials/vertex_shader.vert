@@ -8,8 +8,8 @@ layout (location = 0) out vec3 vFragPos;
 layout (location = 1) out vec2 vTexCoords;
 layout (location = 2) out vec3 vNormal;
 
-uniform mat4 uProjection;
-uniform mat4 uView;
+#include "../include/camera.glsl"
+
 uniform mat4 uModel;
 
 void main()
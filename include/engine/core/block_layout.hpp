@@ -0,0 +1,248 @@
+/**
+ * @file block_layout.hpp
+ * @brief Empaquetado std140/std430 de structs C++ resuelto en tiempo de compilación
+ *
+ * Un struct C++ como engine::core::Light no tiene la misma disposición en
+ * memoria que su equivalente en un bloque GLSL: en std140 y std430 un vec3
+ * se alinea a 16 bytes y las columnas de un mat3 ocupan 16 bytes cada una.
+ * BlockLayout calcula en compilación el offset de cada campo según las
+ * reglas del layout elegido y copia los campos a su posición, de modo que
+ * un struct o un array de structs se sube a la GPU en una sola operación.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef BLOCK_LAYOUT_HPP
+#define BLOCK_LAYOUT_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace engine::core {
+    /** @brief Reglas de empaquetado std140 (uniform blocks) */
+    struct Std140 {};
+
+    /** @brief Reglas de empaquetado std430 (shader storage blocks) */
+    struct Std430 {};
+
+    namespace detail {
+        constexpr size_t alignUp(size_t value, size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        /**
+         * @brief Alineación base, tamaño y escritura de un miembro de bloque
+         *
+         * Solo se admiten escalares de 32 bits, vectores y matrices de float.
+         */
+        template <typename Packing, typename T>
+        struct BlockMember;
+
+        template <typename Packing, typename T>
+            requires (std::is_same_v<T, float> || std::is_same_v<T, int32_t> ||
+                      std::is_same_v<T, uint32_t> || std::is_same_v<T, bool>)
+        struct BlockMember<Packing, T> {
+            static constexpr size_t alignment = 4;
+            static constexpr size_t size = 4;
+
+            static void write(const T& value, unsigned char* destination)
+            {
+                if constexpr (std::is_same_v<T, bool>) {
+                    // En GLSL un bool ocupa 4 bytes
+                    uint32_t word = value ? 1u : 0u;
+                    std::memcpy(destination, &word, sizeof(word));
+                } else {
+                    std::memcpy(destination, &value, sizeof(T));
+                }
+            }
+        };
+
+        template <typename Packing, glm::length_t L, typename S>
+        struct BlockMember<Packing, glm::vec<L, S, glm::defaultp>> {
+            static_assert(sizeof(S) == 4, "Block vectors must have 32-bit components");
+
+            static constexpr size_t alignment = L == 3 ? 16 : L * 4;
+            static constexpr size_t size = L * 4;
+
+            static void write(const glm::vec<L, S, glm::defaultp>& value, unsigned char* destination)
+            {
+                std::memcpy(destination, &value, size);
+            }
+        };
+
+        template <typename Packing, glm::length_t C, glm::length_t R>
+        struct BlockMember<Packing, glm::mat<C, R, float, glm::defaultp>> {
+            // Una matriz es un array de C columnas: en std140 cada elemento ocupa 16 bytes
+            static constexpr size_t columnStride =
+                std::is_same_v<Packing, Std140> ? 16 : BlockMember<Packing, glm::vec<R, float, glm::defaultp>>::alignment;
+            static constexpr size_t alignment = columnStride;
+            static constexpr size_t size = C * columnStride;
+
+            static void write(const glm::mat<C, R, float, glm::defaultp>& value, unsigned char* destination)
+            {
+                for (glm::length_t column = 0; column < C; ++column)
+                    std::memcpy(destination + column * columnStride, &value[column], R * sizeof(float));
+            }
+        };
+
+        template <typename Target, typename... Fields>
+        constexpr size_t fieldIndex()
+        {
+            constexpr bool matches[] = { std::is_same_v<Target, Fields>... };
+            for (size_t i = 0; i < sizeof...(Fields); ++i) {
+                if (matches[i])
+                    return i;
+            }
+            return sizeof...(Fields);
+        }
+    }
+
+    /**
+     * @struct Field
+     * @brief Campo de un struct reflejado en un bloque, identificado por su puntero a miembro
+     *
+     * @tparam Member Puntero al miembro (p. ej. &Light::position)
+     */
+    template <auto Member>
+    struct Field;
+
+    template <typename Owner, typename T, T Owner::*Member>
+    struct Field<Member> {
+        using owner_type = Owner;
+        using type = T;
+
+        static const T& get(const Owner& owner) { return owner.*Member; }
+    };
+
+    /**
+     * @struct BlockLayout
+     * @brief Offsets y tamaño de un struct dentro de un bloque std140 o std430
+     *
+     * Los campos se colocan en el orden declarado, cada uno en el siguiente
+     * múltiplo de su alineación base. El tamaño final se redondea a la
+     * alineación del struct (en std140, como mínimo 16 bytes), que es también
+     * la distancia entre elementos consecutivos de un array de structs.
+     *
+     * @tparam Packing Std140 o Std430
+     * @tparam Fields Campos del struct, en el mismo orden que en GLSL
+     *
+     * @example
+     * @code
+     * using LightLayout = BlockLayout<Std140, Field<&Light::position>, Field<&Light::ambient>>;
+     * static_assert(LightLayout::offsetOf<&Light::ambient> == 16);
+     * static_assert(LightLayout::size == 32);
+     * @endcode
+     */
+    template <typename Packing, typename... Fields>
+    struct BlockLayout {
+        static_assert(std::is_same_v<Packing, Std140> || std::is_same_v<Packing, Std430>,
+                      "BlockLayout packing must be Std140 or Std430");
+        static_assert(sizeof...(Fields) > 0, "BlockLayout requires at least one field");
+
+        /** @brief Struct C++ al que pertenecen los campos */
+        using owner_type = typename std::tuple_element_t<0, std::tuple<Fields...>>::owner_type;
+        static_assert((std::is_same_v<owner_type, typename Fields::owner_type> && ...),
+                      "BlockLayout fields must belong to the same struct");
+
+        /** @brief Número de campos */
+        static constexpr size_t fieldCount = sizeof...(Fields);
+
+        /** @brief Offset en bytes de cada campo, en orden de declaración */
+        static constexpr std::array<size_t, fieldCount> offsets = [] {
+            constexpr size_t alignments[] = { detail::BlockMember<Packing, typename Fields::type>::alignment... };
+            constexpr size_t sizes[] = { detail::BlockMember<Packing, typename Fields::type>::size... };
+            std::array<size_t, fieldCount> result{};
+            size_t offset = 0;
+            for (size_t i = 0; i < fieldCount; ++i) {
+                result[i] = detail::alignUp(offset, alignments[i]);
+                offset = result[i] + sizes[i];
+            }
+            return result;
+        }();
+
+        /** @brief Alineación del struct dentro del bloque */
+        static constexpr size_t alignment = [] {
+            size_t largest = std::max({ detail::BlockMember<Packing, typename Fields::type>::alignment... });
+            return std::is_same_v<Packing, Std140> ? detail::alignUp(largest, 16) : largest;
+        }();
+
+        /** @brief Tamaño en bytes del struct, y stride en un array de structs */
+        static constexpr size_t size = detail::alignUp(
+            offsets[fieldCount - 1] + detail::BlockMember<Packing, typename std::tuple_element_t<fieldCount - 1, std::tuple<Fields...>>::type>::size,
+            alignment);
+
+        /** @brief Offset en bytes del campo Member */
+        template <auto Member>
+        static constexpr size_t offsetOf = offsets[detail::fieldIndex<Field<Member>, Fields...>()];
+
+        /**
+         * @brief Escribe un struct empaquetado
+         *
+         * @param value Valor a empaquetar
+         * @param destination Memoria de al menos size bytes; el relleno se pone a cero
+         */
+        static void write(const owner_type& value, unsigned char* destination)
+        {
+            std::memset(destination, 0, size);
+            writeFields(value, destination, std::index_sequence_for<Fields...>());
+        }
+
+        /**
+         * @brief Escribe un array de structs empaquetado
+         *
+         * @param values Valores a empaquetar
+         * @param destination Memoria de al menos values.size() * size bytes
+         */
+        static void write(std::span<const owner_type> values, unsigned char* destination)
+        {
+            for (const owner_type& value : values) {
+                write(value, destination);
+                destination += size;
+            }
+        }
+
+    private:
+        template <size_t... I>
+        static void writeFields(const owner_type& value, unsigned char* destination, std::index_sequence<I...>)
+        {
+            (detail::BlockMember<Packing, typename Fields::type>::write(Fields::get(value), destination + offsets[I]), ...);
+        }
+    };
+
+    /**
+     * @struct BlockReflection
+     * @brief Declara qué campos de un struct forman su bloque GLSL
+     *
+     * Se especializa junto a cada struct con un alias layout<Packing>.
+     *
+     * @example
+     * @code
+     * template <>
+     * struct BlockReflection<Light> {
+     *     template <typename Packing>
+     *     using layout = BlockLayout<Packing, Field<&Light::position>, Field<&Light::ambient>>;
+     * };
+     * @endcode
+     */
+    template <typename T>
+    struct BlockReflection;
+
+    /** @brief Layout de bloque de T con las reglas de Packing */
+    template <typename T, typename Packing = Std140>
+    using BlockLayoutOf = typename BlockReflection<T>::template layout<Packing>;
+}
+
+#endif // BLOCK_LAYOUT_HPP
@@ -0,0 +1,114 @@
+/**
+ * @file file_watcher.hpp
+ * @brief Aviso sin bloqueos de archivos modificados en disco
+ *
+ * Envuelve inotify (Linux) en modo no bloqueante. Se vigila el directorio
+ * de cada archivo, no el archivo en sí, porque muchos editores guardan
+ * escribiendo un archivo temporal y renombrándolo encima del original, y
+ * eso rompe una vigilancia sobre el inodo antiguo. En otras plataformas la
+ * clase existe pero no informa de ningún cambio.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef FILE_WATCHER_HPP
+#define FILE_WATCHER_HPP
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace engine::core {
+    /**
+     * @class FileWatcher
+     * @brief Conjunto de archivos vigilados cuyos cambios se consultan una vez por frame
+     *
+     * @example
+     * @code
+     * FileWatcher watcher;
+     * watcher.watch("shaders/lighting.frag");
+     *
+     * while (running) {
+     *     for (const std::filesystem::path& file : watcher.poll()) {
+     *         reload(file);
+     *     }
+     *     ...
+     * }
+     * @endcode
+     *
+     * @note La clase no es copiable; el descriptor se cierra en el destructor
+     */
+    class FileWatcher {
+    private:
+        /** @brief Descriptor de inotify (-1 si no está disponible) */
+        int m_descriptor;
+
+        /** @brief Directorio de cada vigilancia de inotify */
+        std::unordered_map<int, std::filesystem::path> m_directories;
+
+        /** @brief Directorios ya vigilados */
+        std::unordered_set<std::string> m_watchedDirectories;
+
+        /** @brief Archivos vigilados, con ruta absoluta normalizada */
+        std::unordered_set<std::string> m_files;
+
+        /** @brief Archivos modificados desde la última llamada a poll() */
+        std::vector<std::filesystem::path> m_changed;
+
+    public:
+        /**
+         * @brief Crea la instancia de inotify
+         *
+         * @note Si falla se muestra un error y isActive() devuelve false
+         */
+        FileWatcher();
+
+        /**
+         * @brief Destructor - cierra el descriptor de inotify
+         */
+        ~FileWatcher();
+
+        FileWatcher(const FileWatcher&) = delete;
+        FileWatcher& operator=(const FileWatcher&) = delete;
+
+        /**
+         * @brief Empieza a vigilar un archivo
+         *
+         * Vigilar dos veces el mismo archivo no tiene efecto.
+         *
+         * @param file Ruta del archivo (relativa al directorio de trabajo o absoluta)
+         * @return bool true si el archivo queda vigilado
+         */
+        bool watch(const std::filesystem::path& file);
+
+        /**
+         * @brief Recoge sin bloquear los archivos escritos desde la última llamada
+         *
+         * @return const std::vector<std::filesystem::path>& Rutas absolutas
+         * normalizadas, sin repetir; válidas hasta la siguiente llamada
+         */
+        const std::vector<std::filesystem::path>& poll();
+
+        /**
+         * @brief Indica si la vigilancia funciona en esta plataforma
+         *
+         * @return bool true si inotify se inicializó correctamente
+         */
+        bool isActive() const;
+
+        /**
+         * @brief Normaliza una ruta igual que la devuelve poll()
+         *
+         * @param file Ruta relativa o absoluta
+         * @return std::filesystem::path Ruta absoluta normalizada
+         */
+        static std::filesystem::path normalize(const std::filesystem::path& file);
+    };
+}
+
+#endif // FILE_WATCHER_HPP
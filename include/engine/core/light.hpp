@@ -4,6 +4,7 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include "engine/core/block_layout.hpp"
 
 namespace engine::core {
     struct Light {
@@ -12,6 +13,22 @@ namespace engine::core {
         glm::vec3 diffuse;
         glm::vec3 specular;
     };
+
+    template <>
+    struct BlockReflection<Light> {
+        template <typename Packing>
+        using layout = BlockLayout<Packing,
+                                   Field<&Light::position>,
+                                   Field<&Light::ambient>,
+                                   Field<&Light::diffuse>,
+                                   Field<&Light::specular>>;
+    };
+
+    static_assert(BlockLayoutOf<Light, Std140>::offsetOf<&Light::ambient> == 16);
+    static_assert(BlockLayoutOf<Light, Std140>::offsetOf<&Light::diffuse> == 32);
+    static_assert(BlockLayoutOf<Light, Std140>::offsetOf<&Light::specular> == 48);
+    static_assert(BlockLayoutOf<Light, Std140>::size == 64);
+    static_assert(BlockLayoutOf<Light, Std430>::size == 64);
 }
 
 #endif // LIGHT_HPP
\ No newline at end of file
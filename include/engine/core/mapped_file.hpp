@@ -0,0 +1,107 @@
+/**
+ * @file mapped_file.hpp
+ * @brief Proyección de archivos de solo lectura en memoria
+ *
+ * Envuelve mmap (POSIX) y CreateFileMapping/MapViewOfFile (Windows) para
+ * leer archivos grandes sin copiarlos a un buffer intermedio: el sistema
+ * operativo carga las páginas bajo demanda y varios hilos pueden leer
+ * regiones distintas a la vez.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace engine::core {
+    /**
+     * @class MappedFile
+     * @brief Archivo proyectado en memoria en modo solo lectura
+     *
+     * @example
+     * @code
+     * MappedFile file("../../assets/models/cube.obj");
+     * if (file.isOpen()) {
+     *     std::string_view text = file.view();
+     * }
+     * @endcode
+     *
+     * @note La clase no es copiable; la proyección se libera en el destructor
+     */
+    class MappedFile {
+    private:
+        /** @brief Inicio de la proyección (nullptr si el archivo está vacío o no se abrió) */
+        const char* m_data;
+
+        /** @brief Tamaño del archivo en bytes */
+        size_t m_size;
+
+        /** @brief Indica si el archivo se abrió correctamente */
+        bool m_open;
+
+#ifdef _WIN32
+        /** @brief HANDLE del archivo */
+        void* m_file;
+
+        /** @brief HANDLE de la proyección */
+        void* m_mapping;
+#else
+        /** @brief Descriptor del archivo */
+        int m_descriptor;
+#endif
+
+    public:
+        /**
+         * @brief Abre y proyecta el archivo completo
+         *
+         * @param path Ruta del archivo
+         *
+         * @note Si falla se muestra un error y isOpen() devuelve false
+         */
+        explicit MappedFile(const char* path);
+
+        /**
+         * @brief Destructor - deshace la proyección y cierra el archivo
+         */
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief Indica si el archivo se abrió y proyectó correctamente
+         *
+         * @return bool true si se puede leer el contenido
+         */
+        bool isOpen() const;
+
+        /**
+         * @brief Obtiene el inicio del contenido
+         *
+         * @return const char* Puntero al primer byte (nullptr si el archivo está vacío)
+         */
+        const char* data() const;
+
+        /**
+         * @brief Obtiene el tamaño del archivo
+         *
+         * @return size_t Tamaño en bytes
+         */
+        size_t size() const;
+
+        /**
+         * @brief Obtiene el contenido como texto
+         *
+         * @return std::string_view Vista de todo el archivo
+         */
+        std::string_view view() const;
+    };
+}
+
+#endif // MAPPED_FILE_HPP
@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <glm/glm.hpp>
+#include "engine/core/block_layout.hpp"
 #include "engine/graphics/texture.hpp"
 
 namespace engine::core {
@@ -21,6 +22,23 @@ namespace engine::core {
         std::shared_ptr<Texture> diffuseMap;
         std::shared_ptr<Texture> specularMap;
     };
+
+    // Las texturas no forman parte del bloque: se enlazan como samplers
+    template <>
+    struct BlockReflection<Material> {
+        template <typename Packing>
+        using layout = BlockLayout<Packing,
+                                   Field<&Material::ambient>,
+                                   Field<&Material::diffuse>,
+                                   Field<&Material::specular>,
+                                   Field<&Material::shininess>>;
+    };
+
+    static_assert(BlockLayoutOf<Material, Std140>::offsetOf<&Material::diffuse> == 16);
+    static_assert(BlockLayoutOf<Material, Std140>::offsetOf<&Material::specular> == 32);
+    static_assert(BlockLayoutOf<Material, Std140>::offsetOf<&Material::shininess> == 44);
+    static_assert(BlockLayoutOf<Material, Std140>::size == 48);
+    static_assert(BlockLayoutOf<Material, Std430>::size == 48);
 }
 
 #endif // MATERIAL_HPP
\ No newline at end of file
@@ -0,0 +1,164 @@
+/**
+ * @file parallel.hpp
+ * @brief Reparto de trabajo entre hilos para los cargadores y estructuras del motor
+ *
+ * VertexWelder, los cargadores OBJ y glTF, Bvh y OcclusionCuller reparten
+ * bucles independientes entre varios hilos. Todos usan parallelFor: el hilo
+ * que llama trabaja también, y los índices se reparten uno a uno con un
+ * contador atómico para que los elementos lentos no dejen hilos parados.
+ * Quien reparte trabajo cada frame usa WorkerPool, que crea sus hilos una
+ * sola vez y los despierta en cada llamada a run().
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef PARALLEL_HPP
+#define PARALLEL_HPP
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine::core
+{
+    /**
+     * @brief Número de hilos a usar para un parámetro threadCount
+     *
+     * @param requested Hilos pedidos (0 = hardware_concurrency)
+     * @return unsigned Hilos a usar, al menos 1
+     */
+    inline unsigned resolveThreadCount(unsigned requested)
+    {
+        return requested > 0 ? requested : std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    /**
+     * @brief Ejecuta function(i) para cada i en [0, count) repartido entre hilos
+     *
+     * Con un solo hilo (o un solo elemento) se ejecuta en el hilo actual sin
+     * crear ninguno. Vuelve cuando todas las llamadas han terminado.
+     *
+     * @param count Número de elementos
+     * @param threadCount Hilos a usar, incluido el actual (ver resolveThreadCount)
+     * @param function Llamable con la firma void(size_t)
+     */
+    template <typename Function>
+    void parallelFor(size_t count, unsigned threadCount, Function function)
+    {
+        threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, count));
+        if (threadCount <= 1) {
+            for (size_t i = 0; i < count; ++i)
+                function(i);
+            return;
+        }
+
+        std::atomic<size_t> next(0);
+        auto worker = [&]() {
+            for (size_t i = next++; i < count; i = next++)
+                function(i);
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount - 1);
+        for (unsigned t = 1; t < threadCount; ++t)
+            threads.emplace_back(worker);
+        worker();
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    /**
+     * @class WorkerPool
+     * @brief Hilos persistentes que ejecutan bucles como parallelFor
+     *
+     * parallelFor crea y une sus hilos en cada llamada, algo aceptable al
+     * cargar un archivo pero no una vez por frame. WorkerPool crea los hilos
+     * en el constructor, los deja dormidos en una variable de condición y los
+     * despierta en cada run(); el hilo que llama trabaja también.
+     *
+     * @example
+     * @code
+     * WorkerPool workers;
+     * while (running) {
+     *     workers.run(tiles.size(), [&](size_t tile) { rasterizeTile(tiles[tile]); });
+     *     ...
+     * }
+     * @endcode
+     *
+     * @note La clase no es copiable y run() no debe llamarse desde varios
+     * hilos a la vez ni desde dentro de otro run() del mismo pool
+     */
+    class WorkerPool {
+    private:
+        /** @brief Hilos del pool (threadCount() - 1; el que llama a run() es el otro) */
+        std::vector<std::thread> m_threads;
+
+        /** @brief Protege m_busy, m_generation y m_stop */
+        std::mutex m_mutex;
+
+        /** @brief Despierta a los hilos cuando hay un trabajo nuevo o hay que terminar */
+        std::condition_variable m_start;
+
+        /** @brief Avisa a run() cuando el último hilo ha terminado su parte */
+        std::condition_variable m_done;
+
+        /** @brief Trabajo en curso; válido mientras m_busy > 0 */
+        const std::function<void(size_t)>* m_function;
+        size_t m_count;
+        std::atomic<size_t> m_next;
+
+        /** @brief Hilos del pool que aún no han terminado el trabajo en curso */
+        size_t m_busy;
+
+        /** @brief Se incrementa con cada run() para que los hilos distingan trabajos */
+        uint64_t m_generation;
+        bool m_stop;
+
+        void workerLoop();
+        void work();
+
+    public:
+        /**
+         * @brief Crea los hilos del pool
+         *
+         * @param threadCount Hilos a usar, incluido el que llama a run() (0 = hardware_concurrency)
+         */
+        explicit WorkerPool(unsigned threadCount = 0);
+
+        /**
+         * @brief Destructor - despierta y une todos los hilos
+         */
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        /**
+         * @brief Ejecuta function(i) para cada i en [0, count) repartido entre los hilos
+         *
+         * Vuelve cuando todas las llamadas han terminado.
+         *
+         * @param count Número de elementos
+         * @param function Llamable con la firma void(size_t)
+         */
+        void run(size_t count, const std::function<void(size_t)>& function);
+
+        /**
+         * @brief Obtiene el número de hilos que reparten cada run()
+         *
+         * @return unsigned Hilos del pool más el que llama
+         */
+        unsigned threadCount() const;
+    };
+}
+
+#endif // PARALLEL_HPP
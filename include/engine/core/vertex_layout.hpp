@@ -0,0 +1,314 @@
+/**
+ * @file vertex_layout.hpp
+ * @brief Layouts de vértice tipados y resueltos en tiempo de compilación
+ *
+ * A diferencia de engine::core::Vertex, que siempre ocupa 48 bytes con
+ * posición, color, coordenadas de textura y normal, TypedVertex solo
+ * contiene los atributos declarados. VertexLayout deriva en tiempo de
+ * compilación el stride, los offsets y las locations de cada atributo.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef VERTEX_LAYOUT_HPP
+#define VERTEX_LAYOUT_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "engine/core/vertex.hpp"
+
+namespace engine::core {
+    /**
+     * @namespace engine::core::attribute
+     * @brief Etiquetas de atributos de vértice para VertexLayout
+     *
+     * Cada etiqueta define el tipo C++ del atributo, cómo lo ve OpenGL,
+     * cómo extraerlo de un engine::core::Vertex completo y su slot en Mesh
+     * (el bit de VertexAttributes y el orden de sus locations).
+     */
+    namespace attribute {
+        /** @brief Posición 3D (vec3, GL_FLOAT) */
+        struct Position {
+            using type = glm::vec3;
+            static constexpr GLint components = 3;
+            static constexpr GLenum glType = GL_FLOAT;
+            static constexpr GLboolean normalized = GL_FALSE;
+            static constexpr size_t slot = 0;
+            static type from(const Vertex& vertex) { return vertex.m_position; }
+        };
+
+        /** @brief Color RGBA (vec4, GL_FLOAT) */
+        struct Color {
+            using type = glm::vec4;
+            static constexpr GLint components = 4;
+            static constexpr GLenum glType = GL_FLOAT;
+            static constexpr GLboolean normalized = GL_FALSE;
+            static constexpr size_t slot = 1;
+            static type from(const Vertex& vertex) { return vertex.m_color; }
+        };
+
+        /** @brief Coordenadas de textura (vec2, GL_FLOAT) */
+        struct TexCoords {
+            using type = glm::vec2;
+            static constexpr GLint components = 2;
+            static constexpr GLenum glType = GL_FLOAT;
+            static constexpr GLboolean normalized = GL_FALSE;
+            static constexpr size_t slot = 2;
+            static type from(const Vertex& vertex) { return vertex.m_texCoords; }
+        };
+
+        /** @brief Vector normal (vec3, GL_FLOAT) */
+        struct Normal {
+            using type = glm::vec3;
+            static constexpr GLint components = 3;
+            static constexpr GLenum glType = GL_FLOAT;
+            static constexpr GLboolean normalized = GL_FALSE;
+            static constexpr size_t slot = 3;
+            static type from(const Vertex& vertex) { return vertex.m_normal; }
+        };
+    }
+
+    namespace detail {
+        template <typename Target, typename... Attrs>
+        constexpr size_t attributeIndex()
+        {
+            constexpr bool matches[] = { std::is_same_v<Target, Attrs>... };
+            for (size_t i = 0; i < sizeof...(Attrs); ++i) {
+                if (matches[i])
+                    return i;
+            }
+            return sizeof...(Attrs);
+        }
+
+        template <typename Target, typename... Attrs>
+        constexpr size_t attributeOffset()
+        {
+            constexpr size_t sizes[] = { sizeof(typename Attrs::type)... };
+            constexpr size_t index = attributeIndex<Target, Attrs...>();
+            size_t offset = 0;
+            for (size_t i = 0; i < index; ++i)
+                offset += sizes[i];
+            return offset;
+        }
+
+        template <typename... Attrs>
+        constexpr bool ascendingSlots()
+        {
+            constexpr size_t slots[] = { Attrs::slot... };
+            for (size_t i = 1; i < sizeof...(Attrs); ++i) {
+                if (slots[i] <= slots[i - 1])
+                    return false;
+            }
+            return true;
+        }
+
+        template <typename... Attrs>
+        constexpr bool hasDuplicates()
+        {
+            constexpr size_t indices[] = { attributeIndex<Attrs, Attrs...>()... };
+            for (size_t i = 0; i < sizeof...(Attrs); ++i) {
+                if (indices[i] != i)
+                    return true;
+            }
+            return false;
+        }
+    }
+
+    template <typename... Attrs>
+    struct TypedVertex;
+
+    /**
+     * @struct VertexLayout
+     * @brief Descriptor de formato de vértice resuelto en tiempo de compilación
+     *
+     * Los atributos se empaquetan sin relleno en el orden declarado y reciben
+     * locations consecutivas desde 0, igual que Mesh con VertexAttributes.
+     *
+     * @tparam Attrs Etiquetas de engine::core::attribute en orden de location
+     *
+     * @example
+     * @code
+     * using LightProxyLayout = VertexLayout<attribute::Position>;
+     * static_assert(LightProxyLayout::stride == 12);
+     * static_assert(VertexLayout<attribute::Position, attribute::Normal>::location<attribute::Normal> == 1);
+     * @endcode
+     */
+    template <typename... Attrs>
+    struct VertexLayout {
+        static_assert(sizeof...(Attrs) > 0, "VertexLayout requires at least one attribute");
+        static_assert(!detail::hasDuplicates<Attrs...>(), "VertexLayout attributes must be unique");
+
+        /** @brief Tipo de vértice que contiene exactamente estos atributos */
+        using vertex_type = TypedVertex<Attrs...>;
+
+        /** @brief Número de atributos del layout */
+        static constexpr size_t attributeCount = sizeof...(Attrs);
+
+        /** @brief Tamaño en bytes de un vértice */
+        static constexpr GLsizei stride = static_cast<GLsizei>((sizeof(typename Attrs::type) + ...));
+
+        /** @brief Indica si el layout contiene el atributo A */
+        template <typename A>
+        static constexpr bool has = (std::is_same_v<A, Attrs> || ...);
+
+        /** @brief Offset en bytes del atributo A dentro del vértice */
+        template <typename A>
+        static constexpr size_t offset = detail::attributeOffset<A, Attrs...>();
+
+        /** @brief Location del atributo A en el shader */
+        template <typename A>
+        static constexpr GLuint location = static_cast<GLuint>(detail::attributeIndex<A, Attrs...>());
+
+        /** @brief Máscara de bits con un bit por slot, con los mismos valores que VertexAttributes */
+        static constexpr unsigned attributeMask = ((1u << Attrs::slot) | ...);
+
+        /**
+         * @brief Indica si los atributos siguen el orden de Mesh (posición, color,
+         * coordenadas de textura, normal) y por tanto reciben las mismas locations
+         */
+        static constexpr bool meshOrder = detail::ascendingSlots<Attrs...>();
+
+        /**
+         * @brief Escribe el offset de cada atributo en la posición de su slot
+         *
+         * @param offsets Offsets por slot (posición, color, coordenadas de textura, normal)
+         */
+        static void slotOffsets(size_t (&offsets)[4])
+        {
+            ((offsets[Attrs::slot] = offset<Attrs>), ...);
+        }
+
+        /**
+         * @brief Configura todos los atributos en el VAO actualmente bindeado
+         *
+         * Debe llamarse con el VAO y el VBO de la malla bindeados.
+         */
+        static void setupAttributes()
+        {
+            (setupAttribute<Attrs>(), ...);
+        }
+
+    private:
+        template <typename A>
+        static void setupAttribute()
+        {
+            glVertexAttribPointer(location<A>, A::components,
+                                  A::glType,
+                                  A::normalized,
+                                  stride,
+                                  (void*)offset<A>);
+            glEnableVertexAttribArray(location<A>);
+        }
+    };
+
+    /**
+     * @struct TypedVertex
+     * @brief Vértice que solo almacena los atributos declarados
+     *
+     * Los datos se guardan empaquetados según VertexLayout<Attrs...>, por lo
+     * que un arreglo de TypedVertex puede subirse directamente a la GPU.
+     *
+     * @tparam Attrs Etiquetas de engine::core::attribute
+     *
+     * @example
+     * @code
+     * using PosNormal = TypedVertex<attribute::Position, attribute::Normal>;
+     * PosNormal v({0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f});
+     * v.set<attribute::Normal>(glm::vec3(0.0f, 1.0f, 0.0f));
+     * glm::vec3 normal = v.get<attribute::Normal>();
+     * @endcode
+     */
+    template <typename... Attrs>
+    struct TypedVertex {
+        /** @brief Layout asociado a este tipo de vértice */
+        using layout = VertexLayout<Attrs...>;
+
+        /** @brief Bytes empaquetados de todos los atributos */
+        alignas(float) unsigned char m_data[layout::stride];
+
+        // Constructor por defecto (todos los atributos a cero)
+        TypedVertex() : m_data{} {}
+
+        // Constructor con un valor por atributo, en el orden declarado
+        TypedVertex(const typename Attrs::type&... values)
+        {
+            (set<Attrs>(values), ...);
+        }
+
+        /**
+         * @brief Lee un atributo del vértice
+         *
+         * Los bytes se copian con std::memcpy: m_data no contiene objetos del
+         * tipo del atributo, así que no puede accederse a ellos por puntero.
+         *
+         * @tparam A Etiqueta del atributo; debe formar parte del layout
+         * @return Copia del valor del atributo
+         */
+        template <typename A>
+        typename A::type get() const
+        {
+            static_assert(layout::template has<A>, "Attribute is not part of this vertex layout");
+            typename A::type value;
+            std::memcpy(&value, m_data + layout::template offset<A>, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Asigna un atributo del vértice
+         *
+         * @tparam A Etiqueta del atributo; debe formar parte del layout
+         * @param value Nuevo valor del atributo
+         */
+        template <typename A>
+        void set(const typename A::type& value)
+        {
+            static_assert(layout::template has<A>, "Attribute is not part of this vertex layout");
+            std::memcpy(m_data + layout::template offset<A>, &value, sizeof(value));
+        }
+
+        /**
+         * @brief Construye el vértice tomando solo sus atributos de un Vertex completo
+         *
+         * @param vertex Vértice completo de origen
+         * @return TypedVertex Vértice con los atributos declarados
+         */
+        static TypedVertex from(const Vertex& vertex)
+        {
+            return TypedVertex(Attrs::from(vertex)...);
+        }
+    };
+
+    /**
+     * @brief Convierte vértices completos al formato compacto de un layout
+     *
+     * Útil para reutilizar la geometría existente (p. ej. el cubo de las demos)
+     * en pasadas que solo necesitan algunos atributos.
+     *
+     * @tparam Layout VertexLayout de destino
+     * @param vertexs Vértices completos de origen
+     * @return std::vector<typename Layout::vertex_type> Vértices compactos
+     *
+     * @example
+     * @code
+     * auto positions = convertVertices<VertexLayout<attribute::Position>>(cube.vertexs);
+     * @endcode
+     */
+    template <typename Layout>
+    std::vector<typename Layout::vertex_type> convertVertices(const std::vector<Vertex>& vertexs)
+    {
+        std::vector<typename Layout::vertex_type> result;
+        result.reserve(vertexs.size());
+        for (const Vertex& vertex : vertexs)
+            result.push_back(Layout::vertex_type::from(vertex));
+        return result;
+    }
+}
+
+#endif // VERTEX_LAYOUT_HPP
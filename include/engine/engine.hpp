@@ -9,13 +9,39 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include "engine/core/block_layout.hpp"
+#include "engine/core/file_watcher.hpp"
+#include "engine/core/mapped_file.hpp"
+#include "engine/core/parallel.hpp"
 #include "engine/core/vertex.hpp"
+#include "engine/core/vertex_layout.hpp"
 #include "engine/core/timer.hpp"
+#include "engine/graphics/block_buffer.hpp"
+#include "engine/graphics/bvh.hpp"
 #include "engine/graphics/camera.hpp"
+#include "engine/graphics/camera_uniforms.hpp"
+#include "engine/graphics/frustum.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include "engine/graphics/gltf_loader.hpp"
 #include "engine/graphics/mesh.hpp"
+#include "engine/graphics/mesh_cache.hpp"
+#include "engine/graphics/mesh_lod.hpp"
+#include "engine/graphics/meshlet.hpp"
+#include "engine/graphics/obj_loader.hpp"
+#include "engine/graphics/occlusion_culler.hpp"
+#include "engine/graphics/mesh_optimizer.hpp"
+#include "engine/graphics/mesh_pool.hpp"
+#include "engine/graphics/primitives.hpp"
+#include "engine/graphics/program_cache.hpp"
+#include "engine/graphics/ray.hpp"
+#include "engine/graphics/stream_buffer.hpp"
 #include "engine/graphics/shader.hpp"
+#include "engine/graphics/shader_library.hpp"
+#include "engine/graphics/shader_preprocessor.hpp"
 #include "engine/graphics/sprite_sheet.hpp"
 #include "engine/graphics/texture.hpp"
+#include "engine/graphics/typed_mesh.hpp"
+#include "engine/graphics/vertex_welder.hpp"
 #include "engine/input/mouse.hpp"
 
 #endif // ENGINE_HPP
\ No newline at end of file
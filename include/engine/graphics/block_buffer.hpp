@@ -0,0 +1,174 @@
+/**
+ * @file block_buffer.hpp
+ * @brief Buffer de bloque uniforme o de almacenamiento para structs reflejados
+ *
+ * BlockBuffer empaqueta un struct, o un array de structs, con el layout
+ * std140/std430 que declara engine::core::BlockReflection y lo sube con una
+ * sola llamada a glNamedBufferSubData. El buffer queda enlazado a un binding fijo
+ * que el shader asocia a su bloque con Shader::bindBlock().
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef BLOCK_BUFFER_HPP
+#define BLOCK_BUFFER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "engine/core/block_layout.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @class BlockBuffer
+     * @brief Uniform buffer (std140) o shader storage buffer (std430) de structs de tipo T
+     *
+     * @tparam T Struct con una especialización de engine::core::BlockReflection
+     * @tparam Packing engine::core::Std140 o engine::core::Std430
+     *
+     * @example
+     * @code
+     * // GLSL: layout (std140) uniform Lights { Light uLights[256]; };
+     * BlockBuffer<engine::core::Light> lights(1, 256);
+     * shader.bindBlock("Lights", lights.binding());
+     *
+     * lights.upload(sceneLights);   // todas las luces en un solo glNamedBufferSubData
+     * @endcode
+     *
+     * @note La clase no es copiable para evitar problemas de gestión de recursos GPU
+     */
+    template <typename T, typename Packing = engine::core::Std140>
+    class BlockBuffer
+    {
+    public:
+        /** @brief Offsets y stride de T en el bloque */
+        using layout = engine::core::BlockLayoutOf<T, Packing>;
+
+    private:
+        /** @brief Identificador del buffer en OpenGL */
+        GLuint m_ID;
+
+        /** @brief GL_UNIFORM_BUFFER para std140, GL_SHADER_STORAGE_BUFFER para std430 */
+        GLenum m_target;
+
+        /** @brief Binding indexado del buffer */
+        GLuint m_binding;
+
+        /** @brief Elementos que caben en el almacenamiento actual */
+        size_t m_capacity;
+
+        /** @brief Elementos subidos en la última llamada a upload() */
+        size_t m_count;
+
+        /** @brief Memoria intermedia con los structs ya empaquetados */
+        std::vector<unsigned char> m_staging;
+
+    public:
+        /**
+         * @brief Crea el buffer y lo enlaza a su binding
+         *
+         * @param binding Binding indexado (el mismo que el bloque en el shader)
+         * @param capacity Número de structs reservados inicialmente
+         */
+        explicit BlockBuffer(GLuint binding, size_t capacity = 1)
+            : m_ID(0)
+            , m_target(std::is_same_v<Packing, engine::core::Std140> ? GL_UNIFORM_BUFFER : GL_SHADER_STORAGE_BUFFER)
+            , m_binding(binding)
+            , m_capacity(capacity == 0 ? 1 : capacity)
+            , m_count(0)
+        {
+            glCreateBuffers(1, &m_ID);
+            glNamedBufferData(m_ID, m_capacity * layout::size, nullptr, GL_DYNAMIC_DRAW);
+            bind();
+        }
+
+        /**
+         * @brief Destructor - libera el buffer
+         */
+        ~BlockBuffer()
+        {
+            GLStateCache::deleteBuffer(m_ID);
+        }
+
+        BlockBuffer(const BlockBuffer&) = delete;
+        BlockBuffer& operator=(const BlockBuffer&) = delete;
+
+        /**
+         * @brief Sube un único struct al inicio del buffer
+         *
+         * @param value Valor a subir
+         */
+        void upload(const T& value)
+        {
+            upload(std::span<const T>(&value, 1));
+        }
+
+        /**
+         * @brief Sube un array de structs con una sola actualización del buffer
+         *
+         * Si no caben, el almacenamiento se reasigna con el doble de capacidad.
+         *
+         * @param values Valores a subir, en el orden del array GLSL
+         */
+        void upload(std::span<const T> values)
+        {
+            m_count = values.size();
+            if (m_count == 0)
+                return;
+
+            m_staging.resize(m_count * layout::size);
+            layout::write(values, m_staging.data());
+
+            if (m_count > m_capacity) {
+                while (m_capacity < m_count)
+                    m_capacity *= 2;
+                glNamedBufferData(m_ID, m_capacity * layout::size, nullptr, GL_DYNAMIC_DRAW);
+            }
+            glNamedBufferSubData(m_ID, 0, m_staging.size(), m_staging.data());
+        }
+
+        /**
+         * @brief Vuelve a enlazar el buffer a su binding indexado
+         */
+        void bind() const
+        {
+            GLStateCache::bindBufferBase(m_target, m_binding, m_ID);
+        }
+
+        /**
+         * @brief Obtiene el identificador del buffer en OpenGL
+         *
+         * @return GLuint Identificador del buffer
+         */
+        GLuint ID() const { return m_ID; }
+
+        /**
+         * @brief Obtiene el binding indexado del buffer
+         *
+         * @return GLuint Binding al que asociar el bloque del shader
+         */
+        GLuint binding() const { return m_binding; }
+
+        /**
+         * @brief Obtiene el número de structs subidos en la última actualización
+         *
+         * @return size_t Elementos válidos en el buffer
+         */
+        size_t count() const { return m_count; }
+
+        /**
+         * @brief Obtiene la capacidad actual del buffer
+         *
+         * @return size_t Structs que caben sin reasignar
+         */
+        size_t capacity() const { return m_capacity; }
+    };
+}
+
+#endif // BLOCK_BUFFER_HPP
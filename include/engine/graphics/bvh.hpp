@@ -0,0 +1,273 @@
+/**
+ * @file bvh.hpp
+ * @brief Jerarquía de volúmenes envolventes (BVH) para culling y picking
+ *
+ * El árbol se construye con la heurística de área de superficie (SAH)
+ * evaluada por cubetas, repartiendo los subárboles grandes entre varios
+ * hilos. Puede indexar cajas de objetos de la escena o los triángulos de
+ * una malla, y cuando los objetos se mueven basta con reajustar (refit) las
+ * cajas de los nodos sin reconstruir la topología.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef BVH_HPP
+#define BVH_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cfloat>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/graphics/frustum.hpp"
+#include "engine/graphics/ray.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct BvhNode
+     * @brief Nodo de 32 bytes: dos nodos hermanos comparten línea de caché
+     *
+     * Si count es 0 el nodo es interior y leftFirst es el índice de su hijo
+     * izquierdo (el derecho va justo después). Si no, es una hoja y
+     * leftFirst es su primera primitiva dentro de Bvh::primitiveIndexs().
+     */
+    struct BvhNode {
+        glm::vec3 boundsMin;
+        GLuint leftFirst;
+        glm::vec3 boundsMax;
+        GLuint count;
+
+        /**
+         * @brief Comprueba si el nodo es una hoja
+         *
+         * @return bool true si el nodo contiene primitivas
+         */
+        bool isLeaf() const
+        {
+            return count > 0;
+        }
+    };
+
+    static_assert(sizeof(BvhNode) == 32, "BvhNode must fit in 32 bytes");
+
+    /**
+     * @struct BvhBuildParams
+     * @brief Parámetros de construcción de Bvh
+     */
+    struct BvhBuildParams {
+        /**
+         * @brief Número de hilos para construir subárboles (0 = hardware_concurrency)
+         *
+         * @default 0
+         */
+        unsigned threadCount = 0;
+
+        /**
+         * @brief Primitivas por hoja a partir de las que siempre se divide el nodo
+         *
+         * @default 4
+         */
+        GLuint maxLeafSize = 4;
+
+        /**
+         * @brief Cubetas por eje para evaluar la SAH (máximo 32)
+         *
+         * @default 16
+         */
+        GLuint binCount = 16;
+    };
+
+    /**
+     * @struct BvhHit
+     * @brief Resultado de Bvh::raycast
+     *
+     * Antes de la consulta, distance actúa como distancia máxima: solo se
+     * aceptan impactos más cercanos.
+     */
+    struct BvhHit {
+        /** @brief Primitiva alcanzada (índice de caja o de triángulo) */
+        GLuint primitive = std::numeric_limits<GLuint>::max();
+
+        /** @brief Distancia a lo largo del rayo */
+        float distance = FLT_MAX;
+
+        /** @brief Coordenadas baricéntricas (v1, v2) del impacto en un triángulo */
+        glm::vec2 barycentric = glm::vec2(0.0f);
+    };
+
+    /**
+     * @struct BvhStats
+     * @brief Forma del árbol construido
+     */
+    struct BvhStats {
+        /** @brief Nodos del árbol */
+        size_t nodeCount = 0;
+
+        /** @brief Nodos hoja */
+        size_t leafCount = 0;
+
+        /** @brief Profundidad máxima (la raíz tiene profundidad 0) */
+        size_t maxDepth = 0;
+
+        /** @brief Coste SAH del árbol relativo al área de la raíz */
+        float sahCost = 0.0f;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const BvhStats& stats)
+    {
+        os << "Nodes: " << stats.nodeCount << " | Leaves: " << stats.leafCount
+           << " | Max depth: " << stats.maxDepth << " | SAH cost: " << stats.sahCost;
+        return os;
+    }
+
+    /**
+     * @class Bvh
+     * @brief BVH sobre cajas de objetos o sobre triángulos
+     *
+     * @example
+     * @code
+     * BoxBatch boxes;
+     * for (const Object& object : scene)
+     *     boxes.add(object.mesh.boundsMin(), object.mesh.boundsMax(), object.model);
+     *
+     * Bvh bvh;
+     * bvh.build(boxes);
+     * bvh.cull(camera.frustum(aspectRatio), visible);
+     *
+     * BvhHit hit;
+     * Ray ray = camera.screenRay(Mouse::positionX(), Mouse::positionY(), width, height);
+     * if (bvh.raycast(ray, hit))
+     *     select(scene[hit.primitive]);
+     * @endcode
+     *
+     * @note Sobre cajas, raycast devuelve la distancia de entrada en la caja.
+     * Para un impacto exacto se puede construir un Bvh de triángulos por malla
+     * y lanzar el rayo, en espacio del objeto, solo contra los objetos cuya
+     * caja alcanza con hit.distance como límite
+     */
+    class Bvh {
+        private:
+        /** @brief Triángulo preparado para Möller-Trumbore */
+        struct Triangle {
+            glm::vec3 vertex;
+            glm::vec3 edge1;
+            glm::vec3 edge2;
+        };
+
+        std::vector<BvhNode> m_nodes;
+        std::vector<GLuint> m_primitiveIndexs;
+        std::vector<glm::vec3> m_primitiveMin;
+        std::vector<glm::vec3> m_primitiveMax;
+        std::vector<Triangle> m_triangles;
+        std::vector<GLuint> m_triangleIndexs;
+        unsigned m_threadCount;
+
+        void buildNodes(const BvhBuildParams& params);
+        void refitNodes();
+        void updateTriangles(std::span<const glm::vec3> positions);
+
+        public:
+        Bvh();
+
+        /**
+         * @brief Construye el árbol sobre cajas en espacio del mundo
+         *
+         * @param boxes Una caja por objeto; hit.primitive y cull devuelven su índice
+         * @param params Parámetros de construcción
+         */
+        void build(const BoxBatch& boxes, const BvhBuildParams& params = BvhBuildParams());
+
+        /**
+         * @brief Construye el árbol sobre los triángulos de una malla
+         *
+         * @param positions Posiciones de los vértices
+         * @param indexs Tres índices por triángulo; hit.primitive devuelve el número de triángulo
+         * @param params Parámetros de construcción
+         */
+        void build(std::span<const glm::vec3> positions,
+                   std::span<const GLuint> indexs,
+                   const BvhBuildParams& params = BvhBuildParams());
+
+        /**
+         * @brief Actualiza las cajas de los nodos tras mover los objetos
+         *
+         * Mantiene la topología, así que es mucho más rápido que build pero
+         * la calidad del árbol se degrada si los objetos se desplazan mucho.
+         *
+         * @param boxes Las mismas cajas de build, en el mismo orden, con su nueva posición
+         */
+        void refit(const BoxBatch& boxes);
+
+        /**
+         * @brief Actualiza las cajas de los nodos tras deformar la malla
+         *
+         * @param positions Nuevas posiciones de los vértices (mismos índices que en build)
+         */
+        void refit(std::span<const glm::vec3> positions);
+
+        /**
+         * @brief Recoge las primitivas dentro del frustum recorriendo el árbol
+         *
+         * Descarta subárboles enteros fuera del frustum y acepta sin más tests
+         * los que quedan completamente dentro.
+         *
+         * @param frustum Planos del frustum (ver Camera::frustum)
+         * @param visible Recibe los índices de las primitivas visibles (en orden del árbol)
+         * @return size_t Número de primitivas visibles
+         */
+        size_t cull(const Frustum& frustum, std::vector<GLuint>& visible) const;
+
+        /**
+         * @brief Busca la primitiva más cercana que corta el rayo
+         *
+         * @param ray Rayo en el mismo espacio que las primitivas
+         * @param hit Distancia máxima de entrada; recibe el impacto más cercano
+         * @return bool true si se encontró un impacto más cercano que hit.distance
+         */
+        bool raycast(const Ray& ray, BvhHit& hit) const;
+
+        /**
+         * @brief Calcula la forma del árbol
+         *
+         * @return BvhStats Número de nodos, hojas, profundidad y coste SAH
+         */
+        BvhStats stats() const;
+
+        /**
+         * @brief Obtiene los nodos del árbol (la raíz es el nodo 0)
+         *
+         * @return const std::vector<BvhNode>& Nodos del árbol
+         */
+        const std::vector<BvhNode>& nodes() const;
+
+        /**
+         * @brief Obtiene el orden de las primitivas en las hojas
+         *
+         * @return const std::vector<GLuint>& Índice original de cada primitiva
+         */
+        const std::vector<GLuint>& primitiveIndexs() const;
+
+        /**
+         * @brief Obtiene el número de primitivas indexadas
+         *
+         * @return size_t Cajas o triángulos del árbol
+         */
+        size_t primitiveCount() const;
+
+        /**
+         * @brief Comprueba si el árbol está vacío
+         *
+         * @return bool true si no se ha construido o no hay primitivas
+         */
+        bool empty() const;
+    };
+}
+
+#endif // BVH_HPP
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include "engine/graphics/camera_uniforms.hpp"
+#include "engine/graphics/frustum.hpp"
+#include "engine/graphics/ray.hpp"
 #include <GLFW/glfw3.h>
 #include <glm/glm.hpp>
+#include <vector>
 
 namespace engine::graphics {
     class Camera {
@@ -25,6 +29,14 @@ namespace engine::graphics {
         float m_maxFov;
         float m_zNear;
         float m_zFar;
+
+        mutable glm::mat4 m_view;
+        mutable glm::mat4 m_projection;
+        mutable float m_projectionAspectRatio;
+        mutable bool m_viewDirty;
+        mutable bool m_projectionDirty;
+        mutable bool m_uniformsDirty;
+        mutable CameraUniforms m_uniforms;
         
         void updateVectors();
 
@@ -44,6 +56,13 @@ namespace engine::graphics {
 
         glm::mat4 getViewMatrix() const;
         glm::mat4 getProjectionMatrix(float aspectRatio) const;
+        Frustum frustum(float aspectRatio) const;
+        Ray screenRay(double screenX, double screenY, int width, int height) const;
+        const CameraUniforms& uniforms(float aspectRatio) const;
+        void publish(float aspectRatio) const;
+
+        size_t cull(const BoxBatch& boxes, float aspectRatio, std::vector<GLuint>& visible) const;
+        size_t cull(const SphereBatch& spheres, float aspectRatio, std::vector<GLuint>& visible) const;
 
         void move(const glm::vec3& offset);
         void moveForward(float distance);
@@ -0,0 +1,76 @@
+/**
+ * @file camera_uniforms.hpp
+ * @brief Bloque uniforme std140 con las matrices de la cámara
+ *
+ * Camera::publish() escribe este bloque en un único uniform buffer enlazado
+ * a un binding fijo, y cada Shader asocia a ese binding su bloque "Camera"
+ * al enlazarse. Así ningún shader necesita recibir uView o uProjection con
+ * setUniform: basta con declarar el bloque en GLSL.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef CAMERA_UNIFORMS_HPP
+#define CAMERA_UNIFORMS_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <glm/glm.hpp>
+
+namespace engine::graphics
+{
+    /** @brief Binding del uniform buffer de la cámara */
+    inline constexpr GLuint CAMERA_UNIFORM_BINDING = 0;
+
+    /** @brief Nombre del bloque uniforme en GLSL */
+    inline constexpr const char* CAMERA_UNIFORM_BLOCK = "Camera";
+
+    /**
+     * @struct CameraUniforms
+     * @brief Contenido del bloque uniforme "Camera" con layout std140
+     *
+     * Declaración equivalente en GLSL:
+     * @code
+     * layout (std140, binding = 0) uniform Camera {
+     *     mat4 uView;
+     *     mat4 uProjection;
+     *     mat4 uViewProjection;
+     *     mat4 uInverseView;
+     *     mat4 uInverseProjection;
+     *     vec3 uCameraPosition;
+     *     float uZNear;
+     *     float uZFar;
+     *     float uFov;         // vertical, en radianes
+     *     float uAspectRatio;
+     * };
+     * @endcode
+     */
+    struct CameraUniforms {
+        glm::mat4 view;
+        glm::mat4 projection;
+        glm::mat4 viewProjection;
+        glm::mat4 inverseView;
+        glm::mat4 inverseProjection;
+        glm::vec3 position;
+        float zNear;
+        float zFar;
+        float fov;
+        float aspectRatio;
+        float padding;
+    };
+
+    static_assert(offsetof(CameraUniforms, projection) == 64);
+    static_assert(offsetof(CameraUniforms, viewProjection) == 128);
+    static_assert(offsetof(CameraUniforms, inverseView) == 192);
+    static_assert(offsetof(CameraUniforms, inverseProjection) == 256);
+    static_assert(offsetof(CameraUniforms, position) == 320);
+    static_assert(offsetof(CameraUniforms, zNear) == 332);
+    static_assert(offsetof(CameraUniforms, zFar) == 336);
+    static_assert(offsetof(CameraUniforms, aspectRatio) == 344);
+    static_assert(sizeof(CameraUniforms) == 352);
+}
+
+#endif // CAMERA_UNIFORMS_HPP
@@ -0,0 +1,191 @@
+/**
+ * @file frustum.hpp
+ * @brief Planos del frustum y culling por lotes de cajas y esferas
+ *
+ * Los volúmenes envolventes se guardan en formato SoA (un arreglo por
+ * componente), de modo que el test contra los seis planos se evalúa para
+ * 8 objetos a la vez con AVX o 4 con SSE, y el resultado es una lista
+ * compacta con los índices de los objetos visibles.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <vector>
+#include <glm/glm.hpp>
+
+namespace engine::graphics
+{
+    /**
+     * @struct BoxBatch
+     * @brief Cajas alineadas con los ejes (AABB) en formato SoA
+     */
+    struct BoxBatch {
+        std::vector<float> minX;
+        std::vector<float> minY;
+        std::vector<float> minZ;
+        std::vector<float> maxX;
+        std::vector<float> maxY;
+        std::vector<float> maxZ;
+
+        /**
+         * @brief Añade una caja en espacio del mundo
+         *
+         * @param boundsMin Esquina mínima
+         * @param boundsMax Esquina máxima
+         */
+        void add(const glm::vec3& boundsMin, const glm::vec3& boundsMax);
+
+        /**
+         * @brief Añade la caja de una malla transformada por su matriz de modelo
+         *
+         * La caja resultante envuelve las 8 esquinas transformadas (método de Arvo).
+         * Se acota a ±FLT_MAX, así que una caja sin límites (la de las mallas
+         * alimentadas por un StreamBuffer) sigue siendo siempre visible.
+         *
+         * @param boundsMin Esquina mínima en espacio del objeto (ver Mesh::boundsMin)
+         * @param boundsMax Esquina máxima en espacio del objeto (ver Mesh::boundsMax)
+         * @param model Matriz de modelo del objeto
+         */
+        void add(const glm::vec3& boundsMin, const glm::vec3& boundsMax, const glm::mat4& model);
+
+        /**
+         * @brief Reserva memoria para varias cajas
+         *
+         * @param count Número de cajas
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Elimina todas las cajas
+         */
+        void clear();
+
+        /**
+         * @brief Obtiene el número de cajas
+         *
+         * @return size_t Cantidad de cajas del lote
+         */
+        size_t size() const;
+    };
+
+    /**
+     * @struct SphereBatch
+     * @brief Esferas envolventes en formato SoA
+     */
+    struct SphereBatch {
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> centerZ;
+        std::vector<float> radius;
+
+        /**
+         * @brief Añade una esfera en espacio del mundo
+         *
+         * @param center Centro de la esfera
+         * @param sphereRadius Radio de la esfera
+         */
+        void add(const glm::vec3& center, float sphereRadius);
+
+        /**
+         * @brief Reserva memoria para varias esferas
+         *
+         * @param count Número de esferas
+         */
+        void reserve(size_t count);
+
+        /**
+         * @brief Elimina todas las esferas
+         */
+        void clear();
+
+        /**
+         * @brief Obtiene el número de esferas
+         *
+         * @return size_t Cantidad de esferas del lote
+         */
+        size_t size() const;
+    };
+
+    /**
+     * @struct Frustum
+     * @brief Seis planos normalizados (izquierdo, derecho, inferior, superior, cercano, lejano)
+     *
+     * Los planos apuntan hacia el interior: un punto p está dentro si
+     * x * p.x + y * p.y + z * p.z + w >= 0 para los seis.
+     *
+     * @example
+     * @code
+     * Frustum frustum = camera.frustum(aspectRatio);
+     * std::vector<GLuint> visible;
+     * frustum.cull(boxes, visible);
+     * for (GLuint object : visible)
+     *     meshes[object].draw(shader);
+     * @endcode
+     *
+     * @note El culling es conservador: una caja que corta la esquina de dos
+     * planos puede considerarse visible aunque quede fuera
+     */
+    struct Frustum {
+        float x[6];
+        float y[6];
+        float z[6];
+        float w[6];
+
+        /**
+         * @brief Extrae los planos de una matriz proyección * vista (Gribb-Hartmann)
+         *
+         * Si la matriz incluye también la de modelo, los planos quedan en
+         * espacio del objeto.
+         *
+         * @param viewProjection Matriz de proyección por matriz de vista
+         * @return Frustum Planos normalizados
+         */
+        static Frustum fromMatrix(const glm::mat4& viewProjection);
+
+        /**
+         * @brief Comprueba si una caja está total o parcialmente dentro
+         *
+         * @param boundsMin Esquina mínima
+         * @param boundsMax Esquina máxima
+         * @return bool false si la caja queda por completo detrás de algún plano
+         */
+        bool intersects(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const;
+
+        /**
+         * @brief Comprueba si una esfera está total o parcialmente dentro
+         *
+         * @param center Centro de la esfera
+         * @param radius Radio de la esfera
+         * @return bool false si la esfera queda por completo detrás de algún plano
+         */
+        bool intersects(const glm::vec3& center, float radius) const;
+
+        /**
+         * @brief Descarta las cajas fuera del frustum
+         *
+         * @param boxes Cajas a comprobar
+         * @param visible Recibe los índices de las cajas visibles en orden creciente
+         * @return size_t Número de cajas visibles
+         */
+        size_t cull(const BoxBatch& boxes, std::vector<GLuint>& visible) const;
+
+        /**
+         * @brief Descarta las esferas fuera del frustum
+         *
+         * @param spheres Esferas a comprobar
+         * @param visible Recibe los índices de las esferas visibles en orden creciente
+         * @return size_t Número de esferas visibles
+         */
+        size_t cull(const SphereBatch& spheres, std::vector<GLuint>& visible) const;
+    };
+}
+
+#endif // FRUSTUM_HPP
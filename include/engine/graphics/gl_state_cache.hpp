@@ -0,0 +1,276 @@
+/**
+ * @file gl_state_cache.hpp
+ * @brief Copia en CPU del estado de OpenGL para no repetir llamadas
+ *
+ * Cada glUseProgram, glBindVertexArray o glBindTexture que deja el estado
+ * como estaba sigue costando una llamada al driver y su validación. Mesh,
+ * Texture, Shader y los buffers del motor cambian el estado a través de
+ * GLStateCache, que recuerda el último valor enviado y omite la llamada si
+ * no cambia nada. Los contadores permiten ver cuántas llamadas se ahorran.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef GL_STATE_CACHE_HPP
+#define GL_STATE_CACHE_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <array>
+#include <cstddef>
+#include <ostream>
+
+namespace engine::graphics
+{
+    /**
+     * @struct GLStateCounter
+     * @brief Llamadas enviadas al driver y omitidas para un tipo de estado
+     */
+    struct GLStateCounter {
+        /** @brief Llamadas que cambiaban el estado y se enviaron */
+        size_t issued = 0;
+
+        /** @brief Llamadas omitidas porque el estado ya tenía ese valor */
+        size_t elided = 0;
+    };
+
+    /**
+     * @struct GLStateStats
+     * @brief Contadores de GLStateCache por tipo de estado
+     */
+    struct GLStateStats {
+        GLStateCounter programs;
+        GLStateCounter vertexArrays;
+        GLStateCounter activeTexture;
+        GLStateCounter textures;
+        GLStateCounter buffers;
+        GLStateCounter capabilities;
+
+        /**
+         * @brief Suma de todos los contadores
+         *
+         * @return GLStateCounter Llamadas enviadas y omitidas en total
+         */
+        GLStateCounter total() const
+        {
+            GLStateCounter sum;
+            for (const GLStateCounter* counter : { &programs, &vertexArrays, &activeTexture, &textures, &buffers, &capabilities }) {
+                sum.issued += counter->issued;
+                sum.elided += counter->elided;
+            }
+            return sum;
+        }
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const GLStateCounter& counter)
+    {
+        os << counter.issued << "/" << counter.elided;
+        return os;
+    }
+
+    inline std::ostream& operator<<(std::ostream& os, const GLStateStats& stats)
+    {
+        GLStateCounter total = stats.total();
+        os << "GL state: " << total.issued << " issued, " << total.elided << " elided (issued/elided: programs "
+           << stats.programs << ", VAOs " << stats.vertexArrays << ", active unit " << stats.activeTexture
+           << ", textures " << stats.textures << ", buffers " << stats.buffers << ", capabilities "
+           << stats.capabilities << ")";
+        return os;
+    }
+
+    /**
+     * @class GLStateCache
+     * @brief Estado de OpenGL del contexto actual, con las llamadas redundantes omitidas
+     *
+     * @example
+     * @code
+     * GLStateCache::enable(GL_DEPTH_TEST);
+     * GLStateCache::useProgram(shader.ID());   // lo mismo que shader.use()
+     * GLStateCache::bindTexture(GL_TEXTURE1, GL_TEXTURE_2D, texture.ID());
+     *
+     * std::cout << GLStateCache::stats() << std::endl;
+     * GLStateCache::resetStats();
+     * @endcode
+     *
+     * @note La caché solo conoce los cambios que pasan por ella. Después de
+     * tocar el mismo estado con llamadas directas a OpenGL (otra biblioteca,
+     * una interfaz de depuración...) hay que llamar a invalidate(). Los draws
+     * de Mesh dejan su VAO enlazado: no enlazar GL_ELEMENT_ARRAY_BUFFER fuera
+     * de la configuración de un VAO propio
+     */
+    class GLStateCache {
+        private:
+        /** @brief Unidades de textura y destinos de textura seguidos; el resto se envía siempre */
+        static constexpr size_t TEXTURE_UNITS = 32;
+        static constexpr size_t TEXTURE_TARGETS = 4;
+
+        /** @brief Destinos de buffer seguidos */
+        static constexpr size_t BUFFER_TARGETS = 8;
+
+        /** @brief Capacidades de glEnable seguidas */
+        static constexpr size_t CAPABILITIES = 8;
+
+        /** @brief Valor desconocido: la siguiente llamada se envía siempre */
+        static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;
+
+        static GLuint currentProgram;
+        static GLuint currentVertexArray;
+        static GLenum currentActiveTexture;
+        static std::array<std::array<GLuint, TEXTURE_TARGETS>, TEXTURE_UNITS> currentTextures;
+        static std::array<GLuint, BUFFER_TARGETS> currentBuffers;
+        static std::array<GLuint, CAPABILITIES> currentCapabilities;
+        static GLenum currentBlendSource;
+        static GLenum currentBlendDestination;
+        static GLenum currentDepthFunc;
+        static GLuint currentDepthMask;
+        static GLStateStats counters;
+
+        static void setCapability(GLenum capability, bool enabled);
+
+        public:
+        GLStateCache() = delete;
+
+        /**
+         * @brief glUseProgram si el programa no está ya en uso
+         *
+         * @param program Programa de shaders (0 para ninguno)
+         */
+        static void useProgram(GLuint program);
+
+        /**
+         * @brief glBindVertexArray si el VAO no está ya enlazado
+         *
+         * Cambiar de VAO cambia también el GL_ELEMENT_ARRAY_BUFFER enlazado,
+         * que forma parte del estado del VAO.
+         *
+         * @param vertexArray VAO (0 para ninguno)
+         */
+        static void bindVertexArray(GLuint vertexArray);
+
+        /**
+         * @brief glActiveTexture si la unidad no está ya activa
+         *
+         * @param unit GL_TEXTURE0 + i
+         */
+        static void activeTexture(GLenum unit);
+
+        /**
+         * @brief Enlaza una textura a una unidad
+         *
+         * Si la textura ya está en esa unidad no se envía nada, ni siquiera
+         * glActiveTexture.
+         *
+         * @param unit GL_TEXTURE0 + i
+         * @param target GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_2D_ARRAY o GL_TEXTURE_3D
+         * (otros destinos se envían siempre)
+         * @param texture Textura (0 para ninguna)
+         */
+        static void bindTexture(GLenum unit, GLenum target, GLuint texture);
+
+        /**
+         * @brief glBindBuffer si el buffer no está ya enlazado a ese destino
+         *
+         * @param target Destino del buffer (GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER...)
+         * @param buffer Buffer (0 para ninguno)
+         */
+        static void bindBuffer(GLenum target, GLuint buffer);
+
+        /**
+         * @brief glBindBufferBase, que también cambia el enlace genérico del destino
+         *
+         * Los enlaces indexados no se siguen: la llamada se envía siempre.
+         *
+         * @param target GL_UNIFORM_BUFFER o GL_SHADER_STORAGE_BUFFER
+         * @param index Binding indexado
+         * @param buffer Buffer
+         */
+        static void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+
+        /**
+         * @brief glEnable si la capacidad no está ya activada
+         *
+         * @param capability GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE, GL_SCISSOR_TEST...
+         */
+        static void enable(GLenum capability);
+
+        /**
+         * @brief glDisable si la capacidad no está ya desactivada
+         *
+         * @param capability GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE, GL_SCISSOR_TEST...
+         */
+        static void disable(GLenum capability);
+
+        /**
+         * @brief glBlendFunc si la función de mezcla cambia
+         *
+         * @param source Factor de origen
+         * @param destination Factor de destino
+         */
+        static void blendFunc(GLenum source, GLenum destination);
+
+        /**
+         * @brief glDepthFunc si la comparación de profundidad cambia
+         *
+         * @param func GL_LESS, GL_LEQUAL...
+         */
+        static void depthFunc(GLenum func);
+
+        /**
+         * @brief glDepthMask si la escritura de profundidad cambia
+         *
+         * @param mask GL_TRUE para escribir en el depth buffer
+         */
+        static void depthMask(GLboolean mask);
+
+        /**
+         * @brief Libera un programa y lo olvida si estaba en uso
+         *
+         * @param program Programa a liberar
+         */
+        static void deleteProgram(GLuint program);
+
+        /**
+         * @brief Libera un VAO y lo olvida si estaba enlazado
+         *
+         * Sin esto un VAO nuevo que reciba el mismo identificador se daría por enlazado.
+         *
+         * @param vertexArray VAO a liberar
+         */
+        static void deleteVertexArray(GLuint vertexArray);
+
+        /**
+         * @brief Libera una textura y la olvida en todas las unidades
+         *
+         * @param texture Textura a liberar
+         */
+        static void deleteTexture(GLuint texture);
+
+        /**
+         * @brief Libera un buffer y lo olvida en todos los destinos
+         *
+         * @param buffer Buffer a liberar
+         */
+        static void deleteBuffer(GLuint buffer);
+
+        /**
+         * @brief Olvida todo el estado; la siguiente llamada de cada tipo se envía siempre
+         */
+        static void invalidate();
+
+        /**
+         * @brief Obtiene los contadores de llamadas enviadas y omitidas
+         *
+         * @return const GLStateStats& Contadores desde el inicio o el último resetStats()
+         */
+        static const GLStateStats& stats();
+
+        /**
+         * @brief Pone a cero los contadores (por ejemplo, al empezar cada frame)
+         */
+        static void resetStats();
+    };
+}
+
+#endif // GL_STATE_CACHE_HPP
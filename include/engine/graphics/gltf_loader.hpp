@@ -0,0 +1,196 @@
+/**
+ * @file gltf_loader.hpp
+ * @brief Importador de modelos glTF 2.0 (.gltf y .glb)
+ *
+ * Lee la escena, sus mallas, materiales y jerarquía de nodos. Los archivos
+ * binarios (.glb y .bin) se proyectan en memoria y, cuando el buffer view de
+ * un primitivo ya tiene un formato de vértice soportado por Mesh, sus bytes
+ * se pasan directamente a la GPU sin conversión. El resto de accessors se
+ * convierten en paralelo.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef GLTF_LOADER_HPP
+#define GLTF_LOADER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/material.hpp"
+#include "engine/graphics/mesh.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct GltfLoadParams
+     * @brief Parámetros de configuración de GltfLoader
+     */
+    struct GltfLoadParams {
+        /**
+         * @brief Número de hilos para convertir accessors (0 = hardware_concurrency)
+         *
+         * @default 0
+         */
+        unsigned threadCount = 0;
+
+        /**
+         * @brief Escena a cargar (-1 = la escena por defecto del archivo)
+         *
+         * @default -1
+         */
+        int scene = -1;
+    };
+
+    /**
+     * @struct GltfMeshRange
+     * @brief Primitivos de una malla glTF dentro de GltfModel::meshes
+     */
+    struct GltfMeshRange {
+        /** @brief Nombre de la malla en el archivo */
+        std::string name;
+
+        /** @brief Índice del primer primitivo en GltfModel::meshes */
+        size_t first = 0;
+
+        /** @brief Número de primitivos */
+        size_t count = 0;
+    };
+
+    /**
+     * @struct GltfNode
+     * @brief Nodo de la jerarquía con su transformación ya resuelta
+     */
+    struct GltfNode {
+        /** @brief Nombre del nodo en el archivo */
+        std::string name;
+
+        /** @brief Índice del nodo padre en GltfModel::nodes, o -1 si es raíz */
+        int parent = -1;
+
+        /** @brief Índice en GltfModel::meshRanges, o -1 si el nodo no tiene malla */
+        int mesh = -1;
+
+        /** @brief Transformación respecto al padre */
+        glm::mat4 local = glm::mat4(1.0f);
+
+        /** @brief Transformación respecto a la raíz de la escena (matriz de modelo) */
+        glm::mat4 world = glm::mat4(1.0f);
+    };
+
+    /**
+     * @struct GltfLoadStats
+     * @brief Cuántos buffers se subieron sin conversión
+     */
+    struct GltfLoadStats {
+        /** @brief Primitivos cuyos vértices se subieron directamente desde el archivo */
+        size_t zeroCopyVertexBuffers = 0;
+
+        /** @brief Primitivos cuyos vértices se convirtieron al formato de Mesh */
+        size_t convertedVertexBuffers = 0;
+
+        /** @brief Primitivos cuyos índices se subieron directamente desde el archivo */
+        size_t zeroCopyIndexBuffers = 0;
+
+        /** @brief Primitivos cuyos índices se convirtieron (a 16 bits, o a 32 si hay más de 65536 vértices) */
+        size_t convertedIndexBuffers = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const GltfLoadStats& stats)
+    {
+        os << "Vertex buffers: " << stats.zeroCopyVertexBuffers << " zero-copy, "
+           << stats.convertedVertexBuffers << " converted | "
+           << "Index buffers: " << stats.zeroCopyIndexBuffers << " zero-copy, "
+           << stats.convertedIndexBuffers << " converted";
+        return os;
+    }
+
+    /**
+     * @struct GltfModel
+     * @brief Modelo glTF subido a la GPU
+     *
+     * Las texturas se comparten entre los materiales que las usan y pertenecen
+     * a materials, por lo que el modelo debe vivir mientras se dibujen sus mallas.
+     */
+    struct GltfModel {
+        /** @brief Materiales con sus texturas cargadas */
+        std::vector<engine::core::Material> materials;
+
+        /** @brief Una malla por primitivo */
+        std::vector<Mesh> meshes;
+
+        /** @brief Índice en materials de cada primitivo, o -1 si no tiene material */
+        std::vector<int> meshMaterials;
+
+        /** @brief Primitivos de cada malla glTF */
+        std::vector<GltfMeshRange> meshRanges;
+
+        /** @brief Todos los nodos del archivo, en el mismo orden */
+        std::vector<GltfNode> nodes;
+
+        /** @brief Nodos de la escena cargada en orden de recorrido (padres antes que hijos) */
+        std::vector<size_t> sceneNodes;
+
+        /** @brief Estadísticas de la carga */
+        GltfLoadStats stats;
+    };
+
+    /**
+     * @class GltfLoader
+     * @brief Carga archivos glTF 2.0 en formato JSON (.gltf) o binario (.glb)
+     *
+     * Soporta primitivos de triángulos con POSITION, NORMAL, TEXCOORD_0 y
+     * COLOR_0, índices de 8, 16 y 32 bits, buffers externos, embebidos en el
+     * GLB o como data URI, y KHR_mesh_quantization.
+     *
+     * Los vértices se suben sin conversión cuando todos los atributos de un
+     * primitivo comparten buffer view y usan formatos que Mesh entiende
+     * (float, o unorm16 en posiciones y coordenadas de textura y unorm8 en
+     * colores). Los índices de 16 y 32 bits sin stride se suben siempre
+     * directamente. Los primitivos con algún índice fuera de sus vértices se
+     * descartan con un error y no aparecen en meshRanges.
+     *
+     * Los materiales PBR se aproximan a engine::core::Material: el color base
+     * es el difuso, la especular se interpola con el factor metálico y el
+     * brillo se deriva de la rugosidad. La textura de color base es
+     * diffuseMap y, si el material usa KHR_materials_specular, su textura es
+     * specularMap.
+     *
+     * @example
+     * @code
+     * GltfModel model = GltfLoader::load("../../assets/models/scene.glb");
+     * for (size_t node : model.sceneNodes) {
+     *     if (model.nodes[node].mesh < 0)
+     *         continue;
+     *     shader.setUniform("uModel", model.nodes[node].world);
+     *     const GltfMeshRange& range = model.meshRanges[model.nodes[node].mesh];
+     *     for (size_t i = range.first; i < range.first + range.count; ++i)
+     *         model.meshes[i].draw(shader);
+     * }
+     * @endcode
+     *
+     * @note Las mallas se crean con MeshResidency::GPU_ONLY y las texturas
+     * sin inversión vertical (el origen UV de glTF está arriba a la izquierda)
+     */
+    class GltfLoader
+    {
+    public:
+        GltfLoader() = delete;
+
+        /**
+         * @brief Carga un archivo glTF y crea sus mallas, materiales, texturas y nodos
+         *
+         * @param path Ruta del archivo .gltf o .glb
+         * @param params Parámetros de carga
+         * @return GltfModel Modelo cargado (vacío si el archivo no se pudo leer)
+         */
+        static GltfModel load(const char* path, const GltfLoadParams& params = GltfLoadParams());
+    };
+}
+
+#endif // GLTF_LOADER_HPP
@@ -18,8 +18,13 @@
 
 #include <glad/glad.h>
 #include <vector>
+#include <span>
+#include <limits>
+#include <ostream>
+#include <glm/glm.hpp>
 #include "engine/graphics/shader.hpp"
 #include "engine/graphics/texture.hpp"
+#include "engine/graphics/stream_buffer.hpp"
 #include "engine/core/vertex.hpp"
 
 namespace engine::graphics 
@@ -79,6 +84,204 @@ namespace engine::graphics
         return static_cast<int>(a) & static_cast<int>(b);
     }
 
+    /**
+     * @enum PositionFormat
+     * @brief Formato en GPU del atributo de posición
+     */
+    enum class PositionFormat {
+        FLOAT,          /**< 3 x float32 (12 bytes) */
+        HALF_FLOAT,     /**< 3 x float16 (8 bytes con relleno) */
+        UNORM16,        /**< 3 x unorm16 relativo a la caja envolvente (8 bytes con relleno) */
+    };
+
+    /**
+     * @struct MeshQuantization
+     * @brief Parámetros opcionales de cuantización de atributos de vértice
+     * 
+     * Por defecto todos los atributos se suben como GL_FLOAT. Cada campo activa
+     * un formato compacto para un atributo; los vértices se empaquetan entonces
+     * sin los atributos que la malla no usa.
+     * 
+     * Formatos que debe tener en cuenta el vertex shader:
+     * - UNORM16: la posición llega en [0,1]; multiplicar el modelo por
+     *   Mesh::positionDequantization() para recuperar la escala y el offset
+     * - octahedralNormals: la normal llega como vec2 en [-1,1] y se decodifica con
+     * @code
+     * vec3 decodeOctahedral(vec2 e) {
+     *     vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+     *     if (n.z < 0.0) n.xy = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+     *     return normalize(n);
+     * }
+     * @endcode
+     * - unorm8Colors y unorm16TexCoords son transparentes (atributos normalizados)
+     * 
+     * @example
+     * @code
+     * MeshQuantization quantization;
+     * quantization.position = PositionFormat::HALF_FLOAT;
+     * quantization.unorm16TexCoords = true;
+     * Mesh mesh(vertices, indices, textures, attributes, quantization);
+     * std::cout << mesh.memoryStats() << std::endl;
+     * @endcode
+     */
+    struct MeshQuantization {
+        /** @brief Formato de la posición @default PositionFormat::FLOAT */
+        PositionFormat position = PositionFormat::FLOAT;
+
+        /** @brief Normales codificadas en octaedro como 2 x snorm16 @default false */
+        bool octahedralNormals = false;
+
+        /** @brief Colores RGBA como 4 x unorm8 @default false */
+        bool unorm8Colors = false;
+
+        /** 
+         * @brief Coordenadas de textura como 2 x unorm16 @default false 
+         * 
+         * @note Si alguna coordenada está fuera de [0,1] se mantiene GL_FLOAT
+         */
+        bool unorm16TexCoords = false;
+    };
+
+    /**
+     * @struct IndexRange
+     * @brief Rango contiguo del buffer de índices de una malla
+     */
+    struct IndexRange {
+        /** @brief Primer índice del rango (en índices, no en bytes) */
+        GLuint firstIndex;
+
+        /** @brief Número de índices del rango */
+        GLsizei indexCount;
+    };
+
+    /**
+     * @struct MeshMemoryStats
+     * @brief Memoria de GPU usada por una malla frente al formato sin cuantizar
+     * 
+     * La referencia es engine::core::Vertex completo (48 bytes) con índices de 32 bits.
+     */
+    struct MeshMemoryStats {
+        /** @brief Bytes por vértice en la GPU */
+        size_t vertexStride = 0;
+
+        /** @brief Bytes del VBO */
+        size_t vertexBytes = 0;
+
+        /** @brief Bytes del EBO */
+        size_t indexBytes = 0;
+
+        /** @brief Bytes del VBO con engine::core::Vertex sin cuantizar */
+        size_t baselineVertexBytes = 0;
+
+        /** @brief Bytes del EBO con índices de 32 bits */
+        size_t baselineIndexBytes = 0;
+
+        /**
+         * @brief Fracción del ancho de banda de vértices respecto al formato completo
+         * 
+         * @return float vertexStride / sizeof(engine::core::Vertex)
+         */
+        float vertexBandwidthRatio() const
+        {
+            return static_cast<float>(vertexStride) / sizeof(engine::core::Vertex);
+        }
+
+        /**
+         * @brief Bytes ahorrados entre VBO y EBO
+         * 
+         * @return size_t Diferencia respecto al formato sin cuantizar
+         */
+        size_t savedBytes() const
+        {
+            return (baselineVertexBytes + baselineIndexBytes) - (vertexBytes + indexBytes);
+        }
+    };
+
+    /**
+     * @brief Escribe un resumen legible de MeshMemoryStats
+     */
+    inline std::ostream& operator<<(std::ostream& os, const MeshMemoryStats& stats)
+    {
+        return os << "vertex " << stats.vertexBytes << "/" << stats.baselineVertexBytes << " B"
+                  << " (" << stats.vertexStride << " B/vertex, "
+                  << static_cast<int>(stats.vertexBandwidthRatio() * 100.0f + 0.5f) << "% bandwidth)"
+                  << ", index " << stats.indexBytes << "/" << stats.baselineIndexBytes << " B"
+                  << ", saved " << stats.savedBytes() << " B";
+    }
+
+    /**
+     * @struct MeshGpuLayout
+     * @brief Descripción del formato de los buffers de una malla en la GPU
+     * 
+     * Junto con los bytes del VBO y del EBO permite reconstruir una malla sin
+     * volver a empaquetar sus vértices (ver MeshCache).
+     */
+    struct MeshGpuLayout {
+        /** @brief Atributos presentes en los vértices */
+        VertexAttributes attributes = VertexAttributes::POSITION;
+
+        /** @brief Formatos de cuantización de los atributos */
+        MeshQuantization quantization;
+
+        /** @brief Bytes por vértice en el VBO */
+        GLsizei vertexStride = 0;
+
+        /** @brief Offsets en bytes de posición, color, coordenadas de textura y normal */
+        size_t attributeOffsets[4] = {0, 0, 0, 0};
+
+        /** @brief Escala para recuperar posiciones UNORM16 */
+        glm::vec3 positionScale = glm::vec3(1.0f);
+
+        /** @brief Offset para recuperar posiciones UNORM16 */
+        glm::vec3 positionOffset = glm::vec3(0.0f);
+
+        /** @brief Tipo de los índices (GL_UNSIGNED_SHORT o GL_UNSIGNED_INT) */
+        GLenum indexType = GL_UNSIGNED_INT;
+
+        /** @brief Número de vértices del VBO */
+        GLsizei vertexCount = 0;
+
+        /** @brief Número de índices del EBO */
+        GLsizei indexCount = 0;
+
+        /** @brief Primer vértice de la malla dentro del VBO (distinto de 0 en buffers compartidos) */
+        GLint baseVertex = 0;
+
+        /** @brief Desplazamiento en bytes del primer índice dentro del EBO */
+        GLintptr indexOffset = 0;
+
+        /** @brief Esquina mínima de la caja envolvente (infinita si se desconoce) */
+        glm::vec3 boundsMin = glm::vec3(-std::numeric_limits<float>::max());
+
+        /** @brief Esquina máxima de la caja envolvente (infinita si se desconoce) */
+        glm::vec3 boundsMax = glm::vec3(std::numeric_limits<float>::max());
+
+        /**
+         * @brief Tamaño en bytes del VBO
+         */
+        size_t vertexBytes() const
+        {
+            return static_cast<size_t>(vertexCount) * vertexStride;
+        }
+
+        /**
+         * @brief Tamaño en bytes del EBO
+         */
+        size_t indexBytes() const
+        {
+            return static_cast<size_t>(indexCount) * (indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+        }
+    };
+
+    /**
+     * @enum MeshResidency
+     * @brief Política de residencia de la geometría en memoria de CPU
+     */
+    enum class MeshResidency {
+        KEEP_CPU_COPY,  /**< Conserva vértices e índices en CPU tras subirlos (accesibles con vertices()/indices()) */
+        GPU_ONLY,       /**< Libera la copia en CPU tras subirla; la geometría solo vive en la GPU */
+    };
+
     /**
      * @class Mesh
      * @brief Maneja la creación y renderizado de mallas 3D
@@ -88,7 +291,7 @@ namespace engine::graphics
      * gestionar los buffers de GPU y renderizar la geometría con shaders y texturas.
      * 
      * @note La malla gestiona automáticamente los recursos de OpenGL (VAO, VBO, EBO)
-     * @note La clase no es copiable para evitar problemas de gestión de recursos GPU
+     * @note La clase no es copiable pero sí movible, por lo que puede guardarse en un std::vector
      */
     class Mesh 
     {
@@ -111,14 +314,104 @@ namespace engine::graphics
         /** @brief Element Buffer Object ID de OpenGL */
         GLuint m_EBO;
 
+        /** @brief Número de vértices que se dibujan */
+        GLsizei m_vertexCount;
+
+        /** @brief Número de índices que se dibujan (0 para renderizado por arrays) */
+        GLsizei m_indexCount;
+
+        /** @brief Primer vértice dentro del VBO (baseVertex en renderizado indexado) */
+        GLint m_baseVertex;
+
+        /** @brief Desplazamiento en bytes del primer índice dentro del EBO */
+        GLintptr m_indexOffset;
+
+        /** @brief Indica si el VBO y EBO pertenecen a la malla o a otro objeto (StreamBuffer, PrimitiveBuffer) */
+        bool m_ownsBuffers;
+
+        /** @brief Buffer de datos por instancia (se crea en el primer drawInstanced) */
+        GLuint m_instanceVBO;
+
+        /** @brief Capacidad actual en bytes del buffer de instancias */
+        GLsizeiptr m_instanceCapacity;
+
         /** @brief Máscara de bits que indica los atributos presentes en los vértices */
         VertexAttributes m_attributes;
 
+        /** @brief Formatos de cuantización de los atributos */
+        MeshQuantization m_quantization;
+
+        /** @brief Tipo de los índices en el EBO (GL_UNSIGNED_SHORT o GL_UNSIGNED_INT) */
+        GLenum m_indexType;
+
+        /** @brief Bytes por vértice en el VBO */
+        GLsizei m_vertexStride;
+
+        /** @brief Offsets en bytes de posición, color, coordenadas de textura y normal */
+        size_t m_attributeOffsets[4];
+
+        /** @brief Escala para recuperar posiciones UNORM16 */
+        glm::vec3 m_positionScale;
+
+        /** @brief Offset para recuperar posiciones UNORM16 */
+        glm::vec3 m_positionOffset;
+
+        /** @brief Esquina mínima de la caja envolvente en espacio del objeto */
+        glm::vec3 m_boundsMin;
+
+        /** @brief Esquina máxima de la caja envolvente en espacio del objeto */
+        glm::vec3 m_boundsMax;
+
+        /** @brief Política de residencia de m_vertexs y m_indexs tras la subida */
+        MeshResidency m_residency;
+
+        /** @brief Número de índices por rango de drawRanges (reutilizado entre frames) */
+        std::vector<GLsizei> m_rangeCounts;
+
+        /** @brief Offsets en bytes por rango de drawRanges (reutilizado entre frames) */
+        std::vector<const void*> m_rangeOffsets;
+
+        /** @brief Base vertex por rango de drawRanges (reutilizado entre frames) */
+        std::vector<GLint> m_rangeBaseVertices;
+
+        /**
+         * @brief Empaqueta los vértices según m_quantization
+         * 
+         * Calcula el stride y los offsets de los atributos presentes y
+         * escribe cada vértice en su formato compacto.
+         * 
+         * @return std::vector<unsigned char> Bytes listos para el VBO
+         */
+        std::vector<unsigned char> packVertices();
+
+        /**
+         * @brief Configura en el VAO los atributos presentes, en locations consecutivas
+         */
+        void setupAttributes();
+
+        /**
+         * @brief Sube los índices con el tipo más pequeño posible
+         * 
+         * Usa índices de 16 bits si la malla tiene menos de 65536 vértices.
+         * Con MeshResidency::GPU_ONLY la conversión se hace sobre el propio
+         * m_indexs, sin reservar memoria adicional.
+         */
+        void uploadIndices();
+
+        /**
+         * @brief Libera los objetos de OpenGL que pertenecen a la malla
+         * 
+         * Usado por el destructor y el operador de asignación por movimiento.
+         * Los identificadores a 0 (mallas movidas) se ignoran.
+         */
+        void release();
+
         /**
          * @brief Configura los buffers de OpenGL para la malla
          * 
          * Método interno que crea y configura el VAO, VBO y EBO en la GPU
-         * con los datos de vértices e índices proporcionados.
+         * con los datos de vértices e índices proporcionados. Si la malla
+         * se alimenta de un StreamBuffer, el VAO apunta a sus buffers.
          * 
          * @throws std::runtime_error Si falla la configuración de los buffers
          */
@@ -152,7 +445,32 @@ namespace engine::graphics
          */
         void setupNormalAttribute(GLuint location);
 
+        /**
+         * @brief Sube los datos por instancia y configura sus atributos en el VAO
+         * 
+         * Hace crecer el buffer de instancias si es necesario (duplicando su
+         * capacidad), lo reasigna (orphaning) para no esperar a draws anteriores y copia
+         * cada arreglo en su región. Los atributos ausentes se desactivan y
+         * toman un valor constante (matriz identidad y tinte blanco).
+         * 
+         * @param models Matrices de modelo por instancia
+         * @param normalMatrices Matrices normales por instancia (opcional)
+         * @param tints Colores de tinte por instancia (opcional)
+         */
+        void uploadInstances(std::span<const glm::mat4> models,
+                             std::span<const glm::mat3> normalMatrices,
+                             std::span<const glm::vec4> tints);
+
     public:
+        /** @brief Location de la matriz de modelo por instancia (ocupa 4 locations) */
+        static constexpr GLuint INSTANCE_MODEL_LOCATION = 4;
+
+        /** @brief Location de la matriz normal por instancia (ocupa 3 locations) */
+        static constexpr GLuint INSTANCE_NORMAL_LOCATION = 8;
+
+        /** @brief Location del color de tinte por instancia */
+        static constexpr GLuint INSTANCE_TINT_LOCATION = 11;
+
         /**
          * @brief Constructor que crea una malla a partir de geometría y texturas
          * 
@@ -160,6 +478,9 @@ namespace engine::graphics
          * en los buffers de GPU correspondientes mediante setup(). Detecta automáticamente
          * los atributos presentes en los vértices.
          * 
+         * Si no se proporcionan índices, los vértices duplicados se sueldan con
+         * VertexWelder y la malla se dibuja de forma indexada.
+         * 
          * @param vertexs Vector de vértices que definen la geometría
          * @param indexs Vector de índices para renderizado indexado
          * @param textures Vector de texturas a aplicar a la malla
@@ -198,6 +519,121 @@ namespace engine::graphics
              const std::vector<engine::graphics::Texture*>& textures,
              const VertexAttributes attributes);
         
+        /**
+         * @brief Constructor que crea una malla con atributos cuantizados
+         * 
+         * Igual que el constructor con atributos, pero empaqueta en la GPU solo
+         * los atributos presentes usando los formatos compactos indicados.
+         * 
+         * @param vertexs Vector de vértices que definen la geometría
+         * @param indexs Vector de índices para renderizado indexado
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Máscara de bits que especifica los atributos presentes
+         * @param quantization Formatos de cuantización por atributo
+         * @param residency Conservar o no la copia en CPU tras la subida
+         */
+        Mesh(const std::vector<engine::core::Vertex>& vertexs, 
+             const std::vector<GLuint>& indexs, 
+             const std::vector<engine::graphics::Texture*>& textures,
+             const VertexAttributes attributes,
+             const MeshQuantization& quantization,
+             MeshResidency residency = MeshResidency::KEEP_CPU_COPY);
+
+        /**
+         * @brief Constructor que toma la propiedad de la geometría sin copiarla
+         * 
+         * Igual que los constructores anteriores, pero mueve los vectores a la
+         * malla en lugar de copiarlos. Combinado con MeshResidency::GPU_ONLY,
+         * la geometría se libera de la CPU justo después de subirse.
+         * 
+         * @param vertexs Vector de vértices (se mueve a la malla)
+         * @param indexs Vector de índices (se mueve a la malla)
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Máscara de bits que especifica los atributos presentes
+         * @param quantization Formatos de cuantización por atributo
+         * @param residency Conservar o no la copia en CPU tras la subida
+         * 
+         * @example
+         * @code
+         * std::vector<Mesh> scene;
+         * scene.emplace_back(std::move(obj.vertexs), std::move(obj.indexs), textures,
+         *                    VertexAttributes::POSITION | VertexAttributes::NORMAL,
+         *                    MeshQuantization(), MeshResidency::GPU_ONLY);
+         * @endcode
+         */
+        Mesh(std::vector<engine::core::Vertex>&& vertexs, 
+             std::vector<GLuint>&& indexs, 
+             const std::vector<engine::graphics::Texture*>& textures,
+             const VertexAttributes attributes = VertexAttributes::POSITION,
+             const MeshQuantization& quantization = MeshQuantization(),
+             MeshResidency residency = MeshResidency::KEEP_CPU_COPY);
+
+        /**
+         * @brief Constructor que sube buffers ya empaquetados en formato GPU
+         * 
+         * Los bytes se pasan tal cual a glBufferStorage (almacenamiento inmutable),
+         * sin copias intermedias en CPU. Pensado para datos proyectados en memoria
+         * desde un archivo de caché.
+         * 
+         * @param layout Formato de los buffers
+         * @param vertexData Bytes del VBO (layout.vertexBytes())
+         * @param indexData Bytes del EBO (layout.indexBytes())
+         * @param textures Vector de texturas a aplicar a la malla
+         * 
+         * @note layout.baseVertex y layout.indexOffset se ignoran: los buffers
+         * creados contienen solo esta malla
+         * 
+         * @note La malla resultante no tiene copia en CPU (MeshResidency::GPU_ONLY)
+         */
+        Mesh(const MeshGpuLayout& layout,
+             const void* vertexData,
+             const void* indexData,
+             const std::vector<engine::graphics::Texture*>& textures);
+
+        /**
+         * @brief Constructor que crea una malla dinámica alimentada por StreamBuffers
+         * 
+         * La malla no copia ni posee geometría: su VAO apunta directamente a los
+         * buffers persistentes, y cada frame se indica con setStreamRange() qué
+         * región escrita por el productor debe dibujarse.
+         * 
+         * @param vertexStream StreamBuffer con los vértices (engine::core::Vertex)
+         * @param indexStream StreamBuffer con los índices GLuint, o nullptr para renderizado por arrays
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Máscara de bits que especifica los atributos presentes
+         * 
+         * @note Los StreamBuffer deben vivir más que la malla
+         * 
+         * @example
+         * @code
+         * StreamBuffer vertexStream(GL_ARRAY_BUFFER, 1 << 20);
+         * Mesh graph(vertexStream, nullptr, {}, VertexAttributes::POSITION | VertexAttributes::COLOR);
+         * @endcode
+         */
+        Mesh(engine::graphics::StreamBuffer& vertexStream,
+             engine::graphics::StreamBuffer* indexStream,
+             const std::vector<engine::graphics::Texture*>& textures,
+             const VertexAttributes attributes);
+
+        /**
+         * @brief Constructor que crea una vista sobre buffers compartidos con otras mallas
+         * 
+         * La malla solo crea su VAO: dibuja layout.vertexCount vértices a partir
+         * de layout.baseVertex y layout.indexCount índices a partir de
+         * layout.indexOffset, sin copiar ni poseer la geometría.
+         * 
+         * @param vertexBuffer VBO con los vértices en el formato de layout
+         * @param indexBuffer EBO con los índices, o 0 para renderizado por arrays
+         * @param layout Formato y región de la malla dentro de los buffers
+         * @param textures Vector de texturas a aplicar a la malla
+         * 
+         * @note Los buffers deben vivir más que la malla (ver PrimitiveBuffer)
+         */
+        Mesh(GLuint vertexBuffer,
+             GLuint indexBuffer,
+             const MeshGpuLayout& layout,
+             const std::vector<engine::graphics::Texture*>& textures);
+
         /**
          * @brief Destructor - libera los recursos de OpenGL
          * 
@@ -222,6 +658,21 @@ namespace engine::graphics
          */
         Mesh& operator=(const Mesh&) = delete;
 
+        /**
+         * @brief Constructor de movimiento
+         * 
+         * Transfiere los objetos de OpenGL y la geometría en CPU; la malla
+         * de origen queda vacía y su destructor no libera nada.
+         */
+        Mesh(Mesh&& other) noexcept;
+
+        /**
+         * @brief Operador de asignación por movimiento
+         * 
+         * Libera los recursos actuales y toma los de la otra malla.
+         */
+        Mesh& operator=(Mesh&& other) noexcept;
+
         /**
          * @brief Renderiza la malla usando el shader especificado
          * 
@@ -240,6 +691,61 @@ namespace engine::graphics
          */
         void draw(const engine::graphics::Shader& shader);
 
+        /**
+         * @brief Renderiza solo algunos rangos del buffer de índices
+         * 
+         * Emite todos los rangos con una única llamada a glMultiDrawElementsBaseVertex.
+         * Útil para dibujar el resultado de un culling por clusters.
+         * 
+         * @param shader Shader a utilizar para el renderizado
+         * @param ranges Rangos de índices a dibujar
+         * 
+         * @note Solo tiene efecto en mallas indexadas
+         */
+        void drawRanges(const engine::graphics::Shader& shader, std::span<const IndexRange> ranges);
+
+        /**
+         * @brief Indica qué región de los StreamBuffer se dibuja en este frame
+         * 
+         * @param firstVertex Primer vértice (StreamAllocation::first de los vértices)
+         * @param vertexCount Número de vértices escritos
+         * @param indexOffset Desplazamiento en bytes de los índices (StreamAllocation::offset)
+         * @param indexCount Número de índices escritos (0 para renderizado por arrays)
+         * 
+         * @note Solo tiene efecto en mallas creadas a partir de StreamBuffers
+         */
+        void setStreamRange(GLint firstVertex, GLsizei vertexCount,
+                            GLintptr indexOffset = 0, GLsizei indexCount = 0);
+
+        /**
+         * @brief Renderiza N copias de la malla en una sola llamada de dibujo
+         * 
+         * Copia las transformaciones por instancia a un buffer con divisor 1 y
+         * dibuja todas las instancias con glDrawElementsInstanced (o
+         * glDrawArraysInstanced si no hay índices). El vertex shader debe leer
+         * los datos por instancia en las locations fijas:
+         * - INSTANCE_MODEL_LOCATION: mat4 de modelo
+         * - INSTANCE_NORMAL_LOCATION: mat3 normal (identidad si no se pasa)
+         * - INSTANCE_TINT_LOCATION: vec4 de tinte (blanco si no se pasa)
+         * 
+         * @param shader Shader a utilizar para el renderizado
+         * @param models Matrices de modelo, una por instancia
+         * @param normalMatrices Matrices normales; vacío o del mismo tamaño que models
+         * @param tints Colores de tinte; vacío o del mismo tamaño que models
+         * 
+         * @note Si los tamaños no coinciden se muestra un error y no se dibuja nada
+         * 
+         * @example
+         * @code
+         * std::vector<glm::mat4> models = {...};
+         * mesh.drawInstanced(shader, models);
+         * @endcode
+         */
+        void drawInstanced(const engine::graphics::Shader& shader,
+                           std::span<const glm::mat4> models,
+                           std::span<const glm::mat3> normalMatrices = {},
+                           std::span<const glm::vec4> tints = {});
+
         /**
          * @brief Verifica si la malla tiene atributo de posición
          * 
@@ -268,12 +774,117 @@ namespace engine::graphics
          */
         bool hasNormal() const;
         
+        /**
+         * @brief Obtiene la matriz que deshace la cuantización de posiciones
+         * 
+         * Para posiciones UNORM16 devuelve translate(offset) * scale(extensión de la
+         * caja envolvente); para el resto de formatos, la identidad.
+         * 
+         * @return glm::mat4 Matriz a multiplicar por la derecha de la matriz de modelo
+         */
+        glm::mat4 positionDequantization() const;
+
+        /**
+         * @brief Obtiene la memoria de GPU de la malla y el ahorro por cuantización
+         * 
+         * @return MeshMemoryStats Bytes de VBO/EBO frente al formato sin cuantizar
+         */
+        MeshMemoryStats memoryStats() const;
+
+        /**
+         * @brief Indica si la malla conserva su geometría en CPU
+         * 
+         * @return bool false con MeshResidency::GPU_ONLY o en mallas de StreamBuffer
+         */
+        bool hasCpuCopy() const;
+
+        /**
+         * @brief Obtiene los vértices conservados en CPU
+         * 
+         * @return const std::vector<engine::core::Vertex>& Vértices (vacío si !hasCpuCopy())
+         */
+        const std::vector<engine::core::Vertex>& vertices() const;
+
+        /**
+         * @brief Obtiene los índices conservados en CPU
+         * 
+         * @return const std::vector<GLuint>& Índices (vacío si !hasCpuCopy())
+         */
+        const std::vector<GLuint>& indices() const;
+
+        /**
+         * @brief Obtiene las texturas de la malla
+         * 
+         * @return const std::vector<engine::graphics::Texture*>& Texturas en orden de unidad
+         */
+        const std::vector<engine::graphics::Texture*>& textures() const;
+
+        /**
+         * @brief Obtiene la máscara de atributos de la malla
+         * 
+         * @return VertexAttributes Atributos presentes en los vértices
+         */
+        VertexAttributes attributes() const;
+
+        /**
+         * @brief Obtiene los formatos de cuantización de la malla
+         * 
+         * @return const MeshQuantization& Cuantización aplicada al VBO
+         */
+        const MeshQuantization& quantization() const;
+
+        /**
+         * @brief Obtiene el formato de los buffers de la malla en la GPU
+         * 
+         * @return MeshGpuLayout Descripción del VBO y el EBO
+         */
+        MeshGpuLayout gpuLayout() const;
+
+        /**
+         * @brief Obtiene la esquina mínima de la caja envolvente
+         * 
+         * Se calcula en setup() a partir de las posiciones. Las mallas creadas
+         * desde un MeshGpuLayout usan sus límites, y las alimentadas por un
+         * StreamBuffer tienen una caja infinita (nunca se descartan).
+         * 
+         * @return glm::vec3 Mínimo de las posiciones en espacio del objeto
+         */
+        glm::vec3 boundsMin() const;
+
+        /**
+         * @brief Obtiene la esquina máxima de la caja envolvente
+         * 
+         * @return glm::vec3 Máximo de las posiciones en espacio del objeto
+         */
+        glm::vec3 boundsMax() const;
+
+        /**
+         * @brief Obtiene el tipo de índice usado en el EBO
+         * 
+         * @return GLenum GL_UNSIGNED_SHORT o GL_UNSIGNED_INT
+         */
+        GLenum indexType() const;
+
         /**
          * @brief Obtiene el ID del Vertex Array Object
          * 
          * @return GLuint Identificador del VAO en OpenGL
          */
         GLuint VAO() const;
+
+        /**
+         * @brief Obtiene el ID del Vertex Buffer Object
+         * 
+         * @return GLuint Identificador del VBO en OpenGL
+         */
+        GLuint VBO() const;
+
+        /**
+         * @brief Obtiene el ID del Element Buffer Object
+         * 
+         * @return GLuint Identificador del EBO en OpenGL (0 si no hay índices)
+         */
+        GLuint EBO() const;
         
         /**
          * @brief Obtiene el número de vértices en la malla
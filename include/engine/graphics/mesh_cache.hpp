@@ -0,0 +1,110 @@
+/**
+ * @file mesh_cache.hpp
+ * @brief Caché binaria versionada de mallas (.emesh)
+ *
+ * Guarda los buffers de una malla exactamente como están en la GPU (ya
+ * empaquetados y cuantizados) para que los siguientes arranques no tengan
+ * que analizar la geometría original. La carga proyecta el archivo en
+ * memoria y pasa los punteros directamente a glBufferStorage, sin vectores
+ * intermedios, por lo que el tiempo de carga queda limitado por la E/S.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MESH_CACHE_HPP
+#define MESH_CACHE_HPP
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/mesh_lod.hpp"
+#include "engine/graphics/texture.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @class MeshCache
+     * @brief Lectura y escritura de archivos .emesh
+     *
+     * Formato (little-endian):
+     * - Cabecera de 64 bytes: magic "EMSH", versión, número de niveles,
+     *   caja y esfera envolventes y tamaño total del archivo.
+     * - Tabla de niveles: por cada LOD, el descriptor del layout de vértices
+     *   (atributos, cuantización, stride, offsets y descuantización), el tipo
+     *   y número de índices, el error geométrico y la posición de sus datos.
+     * - Bloques de vértices e índices de cada nivel, alineados a BLOB_ALIGNMENT.
+     *
+     * Un archivo con otra versión se rechaza y debe regenerarse desde la
+     * geometría original.
+     *
+     * @example
+     * @code
+     * std::optional<Mesh> mesh = MeshCache::load("../../assets/models/scene.emesh");
+     * if (!mesh) {
+     *     ObjModel model = ObjLoader::load("../../assets/models/scene.obj");
+     *     MeshCache::save("../../assets/models/scene.emesh", model.meshes[0]);
+     * }
+     * @endcode
+     */
+    class MeshCache
+    {
+    public:
+        MeshCache() = delete;
+
+        /** @brief Versión del formato; se incrementa con cada cambio incompatible */
+        static constexpr uint32_t VERSION = 1;
+
+        /** @brief Alineación en bytes de los bloques de vértices e índices */
+        static constexpr size_t BLOB_ALIGNMENT = 64;
+
+        /**
+         * @brief Guarda una malla como archivo de un solo nivel
+         *
+         * Los bytes se leen de los buffers de la GPU, así que funciona también
+         * con mallas MeshResidency::GPU_ONLY y conserva su cuantización.
+         *
+         * @param path Ruta del archivo a escribir
+         * @param mesh Malla a guardar (requiere contexto OpenGL activo)
+         * @return bool true si el archivo se escribió correctamente
+         */
+        static bool save(const char* path, const Mesh& mesh);
+
+        /**
+         * @brief Guarda todos los niveles de una MeshLOD
+         *
+         * @param path Ruta del archivo a escribir
+         * @param lod Cadena de niveles a guardar (requiere contexto OpenGL activo)
+         * @return bool true si el archivo se escribió correctamente
+         */
+        static bool save(const char* path, const MeshLOD& lod);
+
+        /**
+         * @brief Carga el nivel 0 de un archivo .emesh
+         *
+         * @param path Ruta del archivo
+         * @param textures Texturas a aplicar a la malla
+         * @return std::optional<Mesh> Malla GPU_ONLY, o vacío si el archivo no es válido
+         */
+        static std::optional<Mesh> load(const char* path,
+                                        const std::vector<engine::graphics::Texture*>& textures = {});
+
+        /**
+         * @brief Carga todos los niveles de un archivo .emesh
+         *
+         * @param path Ruta del archivo
+         * @param textures Texturas a aplicar a cada nivel
+         * @param pixelErrorThreshold Error máximo en píxeles al elegir un nivel
+         * @return std::optional<MeshLOD> Niveles cargados, o vacío si el archivo no es válido
+         */
+        static std::optional<MeshLOD> loadLOD(const char* path,
+                                              const std::vector<engine::graphics::Texture*>& textures = {},
+                                              float pixelErrorThreshold = 1.0f);
+    };
+}
+
+#endif // MESH_CACHE_HPP
@@ -0,0 +1,240 @@
+/**
+ * @file mesh_lod.hpp
+ * @brief Cadena de niveles de detalle (LOD) generada por simplificación con cuádricas
+ *
+ * Construye versiones simplificadas de una malla mediante colapso de aristas
+ * guiado por métricas de error cuádricas (Garland-Heckbert) y elige cada
+ * frame el nivel a dibujar según el error proyectado en pantalla.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MESH_LOD_HPP
+#define MESH_LOD_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/vertex.hpp"
+#include "engine/graphics/camera.hpp"
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/shader.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct MeshLODParams
+     * @brief Parámetros de configuración de MeshLOD
+     */
+    struct MeshLODParams {
+        /**
+         * @brief Número total de niveles, incluido el original (se limita a [2, 5])
+         *
+         * @default 4
+         */
+        size_t levelCount = 4;
+
+        /**
+         * @brief Fracción de triángulos que conserva cada nivel respecto al anterior
+         *
+         * @default 0.5f
+         */
+        float reductionRatio = 0.5f;
+
+        /**
+         * @brief Error máximo en píxeles que se acepta al elegir un nivel
+         *
+         * @default 1.0f
+         */
+        float pixelErrorThreshold = 1.0f;
+    };
+
+    /**
+     * @struct SimplifyResult
+     * @brief Resultado de MeshLOD::simplify
+     */
+    struct SimplifyResult {
+        /** @brief Índices de la malla simplificada (referencian los vértices originales) */
+        std::vector<GLuint> indexs;
+
+        /** @brief Distancia máxima estimada a la superficie original, en unidades del objeto */
+        float error = 0.0f;
+    };
+
+    /**
+     * @class MeshLOD
+     * @brief Malla con varios niveles de detalle seleccionados por error en pantalla
+     *
+     * Cada nivel se obtiene del anterior con colapsos de media arista: un vértice
+     * se funde con un vecino sin crear vértices nuevos, por lo que posiciones,
+     * coordenadas de textura y normales siguen siendo exactas. Los vértices del
+     * borde de la malla nunca se eliminan, así que las siluetas abiertas se
+     * conservan. En las costuras (misma posición con distintos UV o normales)
+     * todas las copias se colapsan juntas y solo a lo largo de la costura, de
+     * modo que las aristas duras y los cortes de UV se mantienen en su sitio.
+     *
+     * La selección estima cuántos píxeles ocupa el error geométrico del nivel
+     * a la distancia del objeto, usando Camera::fov() y la altura del viewport,
+     * y elige el nivel más simple cuyo error no supera el umbral.
+     *
+     * @example
+     * @code
+     * Mesh source(std::move(vertices), std::move(indices), textures, attributes);
+     * MeshLOD lod(std::move(source));
+     * // En el bucle de render:
+     * shader.setUniform("model", model);
+     * lod.draw(shader, camera, model, window.height);
+     * @endcode
+     *
+     * @note La clase no es copiable para evitar problemas de gestión de recursos GPU
+     */
+    class MeshLOD
+    {
+    private:
+        /** @brief Mallas de cada nivel, de más a menos detallada */
+        std::vector<Mesh> m_levels;
+
+        /** @brief Error geométrico de cada nivel en unidades del objeto */
+        std::vector<float> m_errors;
+
+        /** @brief Centro de la esfera envolvente en espacio de objeto */
+        glm::vec3 m_center;
+
+        /** @brief Radio de la esfera envolvente en espacio de objeto */
+        float m_radius;
+
+        /** @brief Umbral de error en píxeles */
+        float m_pixelErrorThreshold;
+
+    public:
+        /**
+         * @brief Construye la cadena de LOD a partir de una malla con copia en CPU
+         *
+         * La malla original se mueve al nivel 0; el resto de niveles se generan
+         * a partir de sus vértices e índices y se suben con MeshResidency::GPU_ONLY.
+         *
+         * @param source Malla original (debe tener hasCpuCopy())
+         * @param params Parámetros de generación y selección
+         */
+        explicit MeshLOD(Mesh&& source, const MeshLODParams& params = MeshLODParams());
+
+        /**
+         * @brief Constructor a partir de niveles ya generados (p. ej. leídos de MeshCache)
+         *
+         * @param levels Mallas de cada nivel, de más a menos detalle
+         * @param errors Error geométrico de cada nivel (mismo tamaño que levels)
+         * @param center Centro de la esfera envolvente en espacio de objeto
+         * @param radius Radio de la esfera envolvente
+         * @param pixelErrorThreshold Error máximo en píxeles al elegir un nivel
+         */
+        MeshLOD(std::vector<Mesh>&& levels, std::vector<float>&& errors,
+                const glm::vec3& center, float radius, float pixelErrorThreshold = 1.0f);
+
+        MeshLOD(const MeshLOD&) = delete;
+        MeshLOD& operator=(const MeshLOD&) = delete;
+        MeshLOD(MeshLOD&&) noexcept = default;
+        MeshLOD& operator=(MeshLOD&&) noexcept = default;
+
+        /**
+         * @brief Simplifica una malla hasta un número de índices objetivo
+         *
+         * @param vertexs Vértices de la malla
+         * @param indexs Índices de la malla (lista de triángulos)
+         * @param targetIndexCount Número de índices deseado
+         * @return SimplifyResult Índices simplificados y error alcanzado
+         *
+         * @note Puede quedarse por encima del objetivo si no hay más colapsos válidos
+         */
+        static SimplifyResult simplify(const std::vector<engine::core::Vertex>& vertexs,
+                                       const std::vector<GLuint>& indexs,
+                                       size_t targetIndexCount);
+
+        /**
+         * @brief Elige el nivel a dibujar para una instancia
+         *
+         * @param camera Cámara activa
+         * @param model Matriz de modelo de la instancia
+         * @param viewportHeight Altura del viewport en píxeles
+         * @return size_t Índice del nivel (0 = máximo detalle)
+         */
+        size_t selectLevel(const Camera& camera, const glm::mat4& model, float viewportHeight) const;
+
+        /**
+         * @brief Dibuja el nivel adecuado para una instancia
+         *
+         * @param shader Shader a utilizar (la matriz de modelo debe estar ya asignada)
+         * @param camera Cámara activa
+         * @param model Matriz de modelo de la instancia
+         * @param viewportHeight Altura del viewport en píxeles
+         */
+        void draw(const engine::graphics::Shader& shader, const Camera& camera,
+                  const glm::mat4& model, float viewportHeight);
+
+        /**
+         * @brief Obtiene la malla de un nivel
+         *
+         * @param level Índice del nivel
+         * @return Mesh& Malla del nivel
+         */
+        Mesh& level(size_t level);
+
+        /**
+         * @brief Obtiene la malla de un nivel (solo lectura)
+         *
+         * @param level Índice del nivel
+         * @return const Mesh& Malla del nivel
+         */
+        const Mesh& level(size_t level) const;
+
+        /**
+         * @brief Obtiene el error geométrico de un nivel
+         *
+         * @param level Índice del nivel
+         * @return float Error en unidades del objeto
+         */
+        float error(size_t level) const;
+
+        /**
+         * @brief Obtiene el número de niveles generados
+         *
+         * Puede ser menor que MeshLODParams::levelCount si la malla no admite
+         * más simplificación.
+         *
+         * @return size_t Cantidad de niveles
+         */
+        size_t levelCount() const;
+
+        /**
+         * @brief Obtiene el centro de la esfera envolvente
+         *
+         * @return glm::vec3 Centro en espacio de objeto
+         */
+        glm::vec3 center() const;
+
+        /**
+         * @brief Obtiene el radio de la esfera envolvente
+         *
+         * @return float Radio en unidades del objeto
+         */
+        float radius() const;
+
+        /**
+         * @brief Obtiene el umbral de error en píxeles
+         *
+         * @return float Umbral de error
+         */
+        float pixelErrorThreshold() const;
+
+        /**
+         * @brief Establece el umbral de error en píxeles
+         *
+         * @param threshold Nuevo umbral (valores mayores eligen niveles más simples)
+         */
+        void setPixelErrorThreshold(float threshold);
+    };
+}
+
+#endif // MESH_LOD_HPP
@@ -0,0 +1,181 @@
+/**
+ * @file mesh_optimizer.hpp
+ * @brief Optimización de buffers de índices y vértices antes de crear una Mesh
+ *
+ * Reordena triángulos para la caché post-transform de vértices (Tipsify),
+ * opcionalmente reordena grupos de triángulos para reducir overdraw y
+ * reasigna los vértices en orden de primer uso para mejorar la localidad
+ * de lectura del VBO.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MESH_OPTIMIZER_HPP
+#define MESH_OPTIMIZER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <ostream>
+#include <vector>
+#include "engine/core/vertex.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct MeshOptimizerParams
+     * @brief Parámetros de configuración de MeshOptimizer::optimize
+     */
+    struct MeshOptimizerParams {
+        /**
+         * @brief Tamaño de la caché FIFO simulada, en vértices
+         *
+         * @default 16
+         */
+        GLuint cacheSize = 16;
+
+        /**
+         * @brief Reordena clusters de triángulos para reducir overdraw
+         *
+         * @default false
+         */
+        bool optimizeOverdraw = false;
+
+        /**
+         * @brief ACMR máximo relativo que se acepta al partir en clusters para overdraw
+         *
+         * 1.05 permite empeorar la caché hasta un 5% a cambio de clusters más pequeños.
+         *
+         * @default 1.05f
+         */
+        float overdrawThreshold = 1.05f;
+
+        /**
+         * @brief Reasigna los vértices en orden de primer uso (descarta los no usados)
+         *
+         * @default true
+         */
+        bool optimizeVertexFetch = true;
+    };
+
+    /**
+     * @struct MeshOptimizerStats
+     * @brief Métricas de caché de vértices antes y después de optimizar
+     *
+     * - ACMR (average cache miss ratio): fallos de caché por triángulo. 3.0 es el
+     *   peor caso y ~0.5 el óptimo para mallas regulares.
+     * - ATVR (average transform to vertex ratio): fallos de caché por vértice
+     *   referenciado. 1.0 es el óptimo (cada vértice se transforma una vez).
+     */
+    struct MeshOptimizerStats {
+        float acmrBefore = 0.0f;
+        float acmrAfter = 0.0f;
+        float atvrBefore = 0.0f;
+        float atvrAfter = 0.0f;
+    };
+
+    /**
+     * @brief Escribe un resumen legible de MeshOptimizerStats
+     */
+    inline std::ostream& operator<<(std::ostream& os, const MeshOptimizerStats& stats)
+    {
+        return os << "ACMR " << stats.acmrBefore << " -> " << stats.acmrAfter
+                  << ", ATVR " << stats.atvrBefore << " -> " << stats.atvrAfter;
+    }
+
+    /**
+     * @class MeshOptimizer
+     * @brief Pasada de optimización de geometría para usar antes de construir una Mesh
+     *
+     * @example
+     * @code
+     * std::vector<engine::core::Vertex> vertices = loadVertices();
+     * std::vector<GLuint> indices = loadIndices();
+     * MeshOptimizerStats stats = MeshOptimizer::optimize(vertices, indices);
+     * std::cout << stats << std::endl;
+     * Mesh mesh(vertices, indices, textures, attributes);
+     * @endcode
+     *
+     * @note Los índices deben formar triángulos completos (múltiplo de 3) y
+     * referirse a vértices existentes; si no, se muestra un error y la
+     * malla se deja sin cambios
+     */
+    class MeshOptimizer
+    {
+    public:
+        MeshOptimizer() = delete;
+
+        /**
+         * @brief Ejecuta todas las etapas de optimización sobre la malla
+         *
+         * Las etapas son: caché de vértices (Tipsify), overdraw (opcional)
+         * y localidad de lectura de vértices. Modifica los vectores in situ.
+         *
+         * @param vertexs Vértices de la malla
+         * @param indexs Índices de la malla (lista de triángulos)
+         * @param params Parámetros de optimización
+         * @return MeshOptimizerStats ACMR y ATVR antes y después
+         */
+        static MeshOptimizerStats optimize(std::vector<engine::core::Vertex>& vertexs,
+                                           std::vector<GLuint>& indexs,
+                                           const MeshOptimizerParams& params = MeshOptimizerParams());
+
+        /**
+         * @brief Reordena los triángulos para la caché post-transform (Tipsify)
+         *
+         * @param indexs Índices de la malla (lista de triángulos)
+         * @param vertexCount Número de vértices de la malla
+         * @param cacheSize Tamaño de la caché objetivo
+         * @return std::vector<GLuint> Índices reordenados
+         */
+        static std::vector<GLuint> optimizeVertexCache(const std::vector<GLuint>& indexs,
+                                                       size_t vertexCount,
+                                                       GLuint cacheSize);
+
+        /**
+         * @brief Reordena clusters de triángulos de fuera hacia dentro para reducir overdraw
+         *
+         * Parte el buffer (ya optimizado para caché) en clusters donde la caché
+         * se vacía o el ACMR supera el umbral, y los ordena según lo que
+         * apuntan hacia fuera respecto al centro de la malla.
+         *
+         * @param indexs Índices optimizados con optimizeVertexCache
+         * @param vertexs Vértices de la malla (se usan sus posiciones)
+         * @param cacheSize Tamaño de la caché objetivo
+         * @param threshold ACMR relativo máximo aceptado
+         * @return std::vector<GLuint> Índices reordenados
+         */
+        static std::vector<GLuint> optimizeOverdraw(const std::vector<GLuint>& indexs,
+                                                    const std::vector<engine::core::Vertex>& vertexs,
+                                                    GLuint cacheSize,
+                                                    float threshold);
+
+        /**
+         * @brief Reasigna los vértices en el orden en que los usa el buffer de índices
+         *
+         * Los vértices no referenciados se descartan.
+         *
+         * @param vertexs Vértices de la malla (se reordenan in situ)
+         * @param indexs Índices de la malla (se reescriben in situ)
+         */
+        static void optimizeVertexFetch(std::vector<engine::core::Vertex>& vertexs,
+                                        std::vector<GLuint>& indexs);
+
+        /**
+         * @brief Calcula el ACMR simulando una caché FIFO
+         *
+         * @return float Fallos de caché por triángulo
+         */
+        static float computeACMR(const std::vector<GLuint>& indexs, size_t vertexCount, GLuint cacheSize);
+
+        /**
+         * @brief Calcula el ATVR simulando una caché FIFO
+         *
+         * @return float Fallos de caché por vértice referenciado
+         */
+        static float computeATVR(const std::vector<GLuint>& indexs, size_t vertexCount, GLuint cacheSize);
+    };
+}
+
+#endif // MESH_OPTIMIZER_HPP
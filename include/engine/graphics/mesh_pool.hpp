@@ -0,0 +1,260 @@
+/**
+ * @file mesh_pool.hpp
+ * @brief Clase MeshPool para agrupar muchas mallas en buffers compartidos
+ *
+ * Esta clase sub-asigna la geometría de muchas mallas dentro de unos pocos
+ * buffers grandes de vértices e índices que comparten un único VAO, y
+ * envía lotes completos de objetos con glMultiDrawElementsIndirect.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MESH_POOL_HPP
+#define MESH_POOL_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <vector>
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/shader.hpp"
+#include "engine/core/vertex.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct MeshHandle
+     * @brief Región de una malla dentro de los buffers del MeshPool
+     *
+     * Se obtiene al añadir geometría al pool y se usa para registrar
+     * draws de esa malla. Un handle con indexCount == 0 no es válido.
+     */
+    struct MeshHandle {
+        /** @brief Primer índice de la malla dentro del EBO compartido */
+        GLuint firstIndex = 0;
+
+        /** @brief Número de índices de la malla */
+        GLuint indexCount = 0;
+
+        /** @brief Desplazamiento que se suma a cada índice (primer vértice) */
+        GLint baseVertex = 0;
+
+        /** @brief Número de vértices de la malla */
+        GLuint vertexCount = 0;
+
+        /**
+         * @brief Verifica si el handle apunta a una malla del pool
+         *
+         * @return bool true si la malla tiene índices, false en caso contrario
+         */
+        bool isValid() const { return indexCount != 0; }
+    };
+
+    /**
+     * @struct ObjectData
+     * @brief Datos por objeto leídos por el shader desde el SSBO del pool
+     *
+     * Sigue el layout std430, por lo que el shader debe declarar
+     * la misma estructura en el mismo orden.
+     */
+    struct ObjectData {
+        /** @brief Matriz de modelo del objeto */
+        glm::mat4 model = glm::mat4(1.0f);
+
+        /** @brief Color de tinte del objeto */
+        glm::vec4 tint = glm::vec4(1.0f);
+    };
+
+    /**
+     * @class MeshPool
+     * @brief Sub-asigna mallas en buffers compartidos y las dibuja con multi-draw indirect
+     *
+     * Todas las mallas del pool comparten el mismo formato de vértice, VAO,
+     * VBO y EBO, por lo que dibujar miles de mallas distintas no requiere
+     * cambiar de VAO. Cada frame se registran los objetos con submit() y se
+     * envían todos en una sola llamada con flush().
+     *
+     * Los datos por objeto se guardan en un SSBO en el binding OBJECT_DATA_BINDING,
+     * indexado con gl_BaseInstance (cada comando indirecto usa su índice de
+     * draw como baseInstance):
+     *
+     * @code
+     * struct ObjectData { mat4 model; vec4 tint; };
+     * layout (std430, binding = 0) readonly buffer Objects { ObjectData uObjects[]; };
+     *
+     * void main() {
+     *     ObjectData object = uObjects[gl_BaseInstance];
+     *     gl_Position = uProjection * uView * object.model * vec4(aPos, 1.0);
+     * }
+     * @endcode
+     *
+     * @note Las locations de los atributos siguen el mismo orden que Mesh
+     * @note La clase no es copiable para evitar problemas de gestión de recursos GPU
+     */
+    class MeshPool
+    {
+    private:
+        /**
+         * @struct DrawCommand
+         * @brief Comando de dibujo indirecto con el layout que espera OpenGL
+         */
+        struct DrawCommand {
+            GLuint count;
+            GLuint instanceCount;
+            GLuint firstIndex;
+            GLint baseVertex;
+            GLuint baseInstance;
+        };
+
+        /** @brief Vertex Array Object compartido por todas las mallas */
+        GLuint m_VAO;
+
+        /** @brief Vertex Buffer Object compartido */
+        GLuint m_VBO;
+
+        /** @brief Element Buffer Object compartido */
+        GLuint m_EBO;
+
+        /** @brief Buffer con los comandos de dibujo indirecto */
+        GLuint m_indirectBuffer;
+
+        /** @brief Shader Storage Buffer con los datos por objeto */
+        GLuint m_objectBuffer;
+
+        /** @brief Capacidad máxima de vértices del VBO */
+        GLuint m_maxVertices;
+
+        /** @brief Capacidad máxima de índices del EBO */
+        GLuint m_maxIndices;
+
+        /** @brief Número máximo de draws por flush */
+        GLuint m_maxDraws;
+
+        /** @brief Vértices ya ocupados en el VBO */
+        GLuint m_usedVertices;
+
+        /** @brief Índices ya ocupados en el EBO */
+        GLuint m_usedIndices;
+
+        /** @brief Máscara de atributos del formato de vértice del pool */
+        VertexAttributes m_attributes;
+
+        /** @brief Comandos registrados en el frame actual */
+        std::vector<DrawCommand> m_commands;
+
+        /** @brief Datos por objeto registrados en el frame actual */
+        std::vector<ObjectData> m_objects;
+
+        /**
+         * @brief Crea el VAO y reserva el almacenamiento de todos los buffers
+         */
+        void setup();
+
+    public:
+        /** @brief Binding del SSBO con los datos por objeto */
+        static constexpr GLuint OBJECT_DATA_BINDING = 0;
+
+        /**
+         * @brief Constructor que reserva los buffers compartidos del pool
+         *
+         * @param attributes Formato de vértice común a todas las mallas del pool
+         * @param maxVertices Número máximo de vértices que puede contener el pool
+         * @param maxIndices Número máximo de índices que puede contener el pool
+         * @param maxDraws Número máximo de objetos por flush
+         *
+         * @example
+         * @code
+         * MeshPool pool(VertexAttributes::POSITION | VertexAttributes::NORMAL,
+         *               1 << 20, 3 << 20, 4096);
+         * @endcode
+         */
+        MeshPool(const VertexAttributes attributes,
+                 GLuint maxVertices,
+                 GLuint maxIndices,
+                 GLuint maxDraws);
+
+        /**
+         * @brief Destructor - libera los recursos de OpenGL
+         */
+        ~MeshPool();
+
+        MeshPool(const MeshPool&) = delete;
+        MeshPool& operator=(const MeshPool&) = delete;
+
+        /**
+         * @brief Copia una malla a los buffers compartidos
+         *
+         * @param vertexs Vértices de la malla
+         * @param indexs Índices de la malla, relativos a su primer vértice
+         * @return MeshHandle Región asignada; inválida si no hay espacio
+         *
+         * @note Si no queda espacio se muestra un error por consola
+         */
+        MeshHandle add(const std::vector<engine::core::Vertex>& vertexs,
+                       const std::vector<GLuint>& indexs);
+
+        /**
+         * @brief Registra un objeto para dibujarse en el siguiente flush
+         *
+         * @param mesh Malla del pool a dibujar
+         * @param object Datos por objeto que leerá el shader
+         *
+         * @note Los draws que excedan maxDraws se descartan con un error por consola
+         */
+        void submit(const MeshHandle& mesh, const ObjectData& object);
+
+        /**
+         * @brief Dibuja todos los objetos registrados con una sola llamada
+         *
+         * Sube los comandos y los datos por objeto, y los dibuja con
+         * glMultiDrawElementsIndirect. Después vacía la lista de draws.
+         *
+         * @param shader Shader a utilizar para el renderizado
+         */
+        void flush(const engine::graphics::Shader& shader);
+
+        /**
+         * @brief Descarta los draws registrados sin dibujarlos
+         */
+        void clearDraws();
+
+        /**
+         * @brief Libera toda la geometría del pool
+         *
+         * Los handles obtenidos anteriormente dejan de ser válidos.
+         */
+        void reset();
+
+        /**
+         * @brief Obtiene el ID del Vertex Array Object compartido
+         *
+         * @return GLuint Identificador del VAO en OpenGL
+         */
+        GLuint VAO() const;
+
+        /**
+         * @brief Obtiene el número de vértices ocupados en el pool
+         *
+         * @return size_t Cantidad de vértices
+         */
+        size_t vertexCount() const;
+
+        /**
+         * @brief Obtiene el número de índices ocupados en el pool
+         *
+         * @return size_t Cantidad de índices
+         */
+        size_t indexCount() const;
+
+        /**
+         * @brief Obtiene el número de draws registrados para el siguiente flush
+         *
+         * @return size_t Cantidad de draws pendientes
+         */
+        size_t drawCount() const;
+    };
+}
+
+#endif // MESH_POOL_HPP
@@ -0,0 +1,271 @@
+/**
+ * @file meshlet.hpp
+ * @brief División de mallas en meshlets con culling por cluster en CPU
+ *
+ * Reordena el buffer de índices en clusters pequeños (meshlets) de hasta 64
+ * vértices y 124 triángulos, calcula para cada uno una esfera envolvente y
+ * un cono de normales, y descarta cada frame los clusters fuera del frustum
+ * o completamente de espaldas a la cámara antes de enviar la malla a la GPU.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef MESHLET_HPP
+#define MESHLET_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <ostream>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/vertex.hpp"
+#include "engine/graphics/camera.hpp"
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/shader.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct Meshlet
+     * @brief Cluster de triángulos contiguo en el buffer de índices
+     */
+    struct Meshlet {
+        /** @brief Primer índice del cluster */
+        GLuint firstIndex;
+
+        /** @brief Número de índices del cluster (3 por triángulo) */
+        GLuint indexCount;
+
+        /** @brief Número de vértices distintos que referencia */
+        GLuint vertexCount;
+    };
+
+    /**
+     * @struct MeshletBounds
+     * @brief Esferas envolventes y conos de normales en formato SoA
+     *
+     * Cada arreglo tiene un elemento por meshlet, lo que permite evaluar
+     * varios clusters a la vez con instrucciones SIMD.
+     *
+     * Un cluster está de espaldas a una cámara en c si
+     * dot(centro - c, eje) >= cutoff * |centro - c| + radio.
+     * Un cutoff de 1 desactiva el test (normales demasiado dispersas).
+     */
+    struct MeshletBounds {
+        std::vector<float> centerX;
+        std::vector<float> centerY;
+        std::vector<float> centerZ;
+        std::vector<float> radius;
+        std::vector<float> coneAxisX;
+        std::vector<float> coneAxisY;
+        std::vector<float> coneAxisZ;
+        std::vector<float> coneCutoff;
+    };
+
+    /**
+     * @struct MeshletData
+     * @brief Resultado de MeshletMesh::build
+     */
+    struct MeshletData {
+        /** @brief Índices reordenados: los triángulos de cada meshlet son contiguos */
+        std::vector<GLuint> indexs;
+
+        /** @brief Rangos de cada meshlet dentro de indexs */
+        std::vector<Meshlet> meshlets;
+
+        /** @brief Cotas de cada meshlet */
+        MeshletBounds bounds;
+    };
+
+    /**
+     * @struct MeshletCullStats
+     * @brief Resultado del último MeshletMesh::cull
+     */
+    struct MeshletCullStats {
+        size_t meshletCount = 0;
+        size_t frustumCulled = 0;
+        size_t coneCulled = 0;
+        size_t triangleCount = 0;
+        size_t visibleTriangles = 0;
+
+        /**
+         * @brief Fracción de triángulos descartados antes de llegar a la GPU
+         *
+         * @return float Valor en [0, 1]
+         */
+        float rejectedRatio() const
+        {
+            return triangleCount > 0 ? 1.0f - static_cast<float>(visibleTriangles) / triangleCount : 0.0f;
+        }
+    };
+
+    /**
+     * @brief Escribe un resumen legible de MeshletCullStats
+     */
+    inline std::ostream& operator<<(std::ostream& os, const MeshletCullStats& stats)
+    {
+        return os << stats.meshletCount << " meshlets (" << stats.frustumCulled << " frustum, "
+                  << stats.coneCulled << " cone culled), " << stats.visibleTriangles << "/"
+                  << stats.triangleCount << " triangles, "
+                  << static_cast<int>(stats.rejectedRatio() * 100.0f + 0.5f) << "% rejected";
+    }
+
+    /**
+     * @class MeshletMesh
+     * @brief Malla dividida en meshlets que se descartan por cluster antes de dibujar
+     *
+     * cull() prueba 4 meshlets a la vez (SSE cuando está disponible) contra los
+     * planos del frustum y el cono de normales, y guarda los meshlets visibles
+     * como rangos de índices compactados (los meshlets consecutivos se unen).
+     * draw() emite esos rangos con una sola llamada de dibujo.
+     *
+     * Para obtener clusters compactos conviene optimizar antes la malla con
+     * MeshOptimizer, ya que la construcción sigue la localidad del buffer de índices.
+     *
+     * @example
+     * @code
+     * MeshletMesh model(std::move(vertices), indices, textures,
+     *                   VertexAttributes::POSITION | VertexAttributes::NORMAL);
+     * // En el bucle de render:
+     * model.cull(camera, modelMatrix, aspectRatio);
+     * model.draw(shader);
+     * std::cout << model.cullStats() << std::endl;
+     * @endcode
+     *
+     * @note El cono de normales es exacto con escalas uniformes en la matriz de modelo
+     */
+    class MeshletMesh
+    {
+    private:
+        /** @brief Malla con el buffer de índices ordenado por meshlets */
+        Mesh m_mesh;
+
+        /** @brief Meshlets de la malla */
+        std::vector<Meshlet> m_meshlets;
+
+        /** @brief Cotas de los meshlets */
+        MeshletBounds m_bounds;
+
+        /** @brief Rangos visibles tras el último cull() */
+        std::vector<IndexRange> m_visibleRanges;
+
+        /** @brief Estadísticas del último cull() */
+        MeshletCullStats m_stats;
+
+    public:
+        /** @brief Máximo de vértices por meshlet */
+        static constexpr GLuint MAX_VERTICES = 64;
+
+        /** @brief Máximo de triángulos por meshlet */
+        static constexpr GLuint MAX_TRIANGLES = 124;
+
+        /**
+         * @brief Construye la malla a partir de datos de meshlets ya generados
+         *
+         * @param vertexs Vértices de la malla (se mueven a la malla)
+         * @param data Resultado de build() para esos vértices
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Máscara de bits que especifica los atributos presentes
+         * @param quantization Formatos de cuantización por atributo
+         * @param residency Conservar o no la copia en CPU tras la subida
+         */
+        MeshletMesh(std::vector<engine::core::Vertex>&& vertexs,
+                    MeshletData&& data,
+                    const std::vector<engine::graphics::Texture*>& textures,
+                    const VertexAttributes attributes = VertexAttributes::POSITION,
+                    const MeshQuantization& quantization = MeshQuantization(),
+                    MeshResidency residency = MeshResidency::KEEP_CPU_COPY);
+
+        /**
+         * @brief Genera los meshlets y construye la malla
+         *
+         * @param vertexs Vértices de la malla (se mueven a la malla)
+         * @param indexs Índices de la malla (lista de triángulos)
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Máscara de bits que especifica los atributos presentes
+         */
+        MeshletMesh(std::vector<engine::core::Vertex>&& vertexs,
+                    const std::vector<GLuint>& indexs,
+                    const std::vector<engine::graphics::Texture*>& textures,
+                    const VertexAttributes attributes = VertexAttributes::POSITION);
+
+        MeshletMesh(const MeshletMesh&) = delete;
+        MeshletMesh& operator=(const MeshletMesh&) = delete;
+        MeshletMesh(MeshletMesh&&) noexcept = default;
+        MeshletMesh& operator=(MeshletMesh&&) noexcept = default;
+
+        /**
+         * @brief Divide una malla en meshlets
+         *
+         * Crece cada meshlet de forma voraz por triángulos adyacentes, priorizando
+         * los que añaden menos vértices nuevos y los que mejor siguen la normal
+         * media del cluster.
+         *
+         * @param vertexs Vértices de la malla
+         * @param indexs Índices de la malla (vacío = vértices sin indexar)
+         * @param maxVertices Máximo de vértices por meshlet
+         * @param maxTriangles Máximo de triángulos por meshlet
+         * @return MeshletData Índices reordenados, meshlets y cotas
+         */
+        static MeshletData build(const std::vector<engine::core::Vertex>& vertexs,
+                                 const std::vector<GLuint>& indexs,
+                                 GLuint maxVertices = MAX_VERTICES,
+                                 GLuint maxTriangles = MAX_TRIANGLES);
+
+        /**
+         * @brief Descarta los meshlets invisibles y prepara los rangos a dibujar
+         *
+         * @param camera Cámara activa
+         * @param model Matriz de modelo de la malla
+         * @param aspectRatio Relación de aspecto usada en la proyección
+         * @return size_t Número de triángulos visibles
+         */
+        size_t cull(const Camera& camera, const glm::mat4& model, float aspectRatio);
+
+        /**
+         * @brief Dibuja los meshlets visibles tras el último cull()
+         *
+         * @param shader Shader a utilizar para el renderizado
+         */
+        void draw(const engine::graphics::Shader& shader);
+
+        /**
+         * @brief Dibuja todos los meshlets sin descartar ninguno
+         *
+         * @param shader Shader a utilizar para el renderizado
+         */
+        void drawAll(const engine::graphics::Shader& shader);
+
+        /**
+         * @brief Obtiene la malla subyacente
+         *
+         * @return Mesh& Malla con el buffer de índices ordenado por meshlets
+         */
+        Mesh& mesh();
+
+        /**
+         * @brief Obtiene los meshlets
+         *
+         * @return const std::vector<Meshlet>& Meshlets de la malla
+         */
+        const std::vector<Meshlet>& meshlets() const;
+
+        /**
+         * @brief Obtiene las cotas de los meshlets
+         *
+         * @return const MeshletBounds& Esferas y conos en formato SoA
+         */
+        const MeshletBounds& bounds() const;
+
+        /**
+         * @brief Obtiene las estadísticas del último cull()
+         *
+         * @return const MeshletCullStats& Estadísticas de descarte
+         */
+        const MeshletCullStats& cullStats() const;
+    };
+}
+
+#endif // MESHLET_HPP
@@ -0,0 +1,189 @@
+/**
+ * @file obj_loader.hpp
+ * @brief Importador de modelos Wavefront OBJ/MTL
+ *
+ * Proyecta el archivo en memoria, lo divide en bloques alineados a línea que
+ * se analizan en paralelo, y une y suelda el resultado en vértices
+ * engine::core::Vertex e índices listos para crear objetos Mesh y Material.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef OBJ_LOADER_HPP
+#define OBJ_LOADER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/material.hpp"
+#include "engine/core/vertex.hpp"
+#include "engine/graphics/mesh.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct ObjLoadParams
+     * @brief Parámetros de configuración de ObjLoader
+     */
+    struct ObjLoadParams {
+        /**
+         * @brief Número de hilos a usar (0 = hardware_concurrency)
+         *
+         * @default 0
+         */
+        unsigned threadCount = 0;
+
+        /**
+         * @brief Tolerancia de soldadura de vértices (ver VertexWeldParams::epsilon)
+         *
+         * @default 0.0f
+         */
+        float weldEpsilon = 0.0f;
+
+        /**
+         * @brief Optimiza cada malla con MeshOptimizer tras soldarla
+         *
+         * @default false
+         */
+        bool optimize = false;
+
+        /**
+         * @brief Invierte la coordenada v de las texturas (v' = 1 - v)
+         *
+         * @default false
+         */
+        bool flipTexCoordsV = false;
+
+        /**
+         * @brief Política de residencia de las mallas creadas por ObjLoader::load
+         *
+         * @default MeshResidency::GPU_ONLY
+         */
+        MeshResidency residency = MeshResidency::GPU_ONLY;
+    };
+
+    /**
+     * @struct ObjMaterialData
+     * @brief Material leído de un archivo MTL
+     */
+    struct ObjMaterialData {
+        /** @brief Nombre del material (newmtl) */
+        std::string name;
+
+        /** @brief Color ambiental (Ka) */
+        glm::vec3 ambient = glm::vec3(0.2f);
+
+        /** @brief Color difuso (Kd) */
+        glm::vec3 diffuse = glm::vec3(0.8f);
+
+        /** @brief Color especular (Ks) */
+        glm::vec3 specular = glm::vec3(0.0f);
+
+        /** @brief Exponente especular (Ns) */
+        float shininess = 32.0f;
+
+        /** @brief Ruta del mapa difuso (map_Kd), relativa al directorio del OBJ */
+        std::string diffuseMap;
+
+        /** @brief Ruta del mapa especular (map_Ks), relativa al directorio del OBJ */
+        std::string specularMap;
+    };
+
+    /**
+     * @struct ObjMeshData
+     * @brief Geometría soldada de todas las caras que usan un mismo material
+     */
+    struct ObjMeshData {
+        /** @brief Índice en ObjData::materials, o -1 si las caras no tienen material */
+        int material = -1;
+
+        /** @brief Vértices únicos */
+        std::vector<engine::core::Vertex> vertexs;
+
+        /** @brief Índices (lista de triángulos) */
+        std::vector<GLuint> indexs;
+    };
+
+    /**
+     * @struct ObjData
+     * @brief Contenido de un OBJ en memoria de CPU
+     */
+    struct ObjData {
+        /** @brief Una malla por material usado (en orden de primera aparición) */
+        std::vector<ObjMeshData> meshes;
+
+        /** @brief Materiales de las bibliotecas MTL referenciadas */
+        std::vector<ObjMaterialData> materials;
+
+        /** @brief Atributos presentes en el archivo (posición siempre, el resto si aparecen) */
+        VertexAttributes attributes = VertexAttributes::POSITION;
+    };
+
+    /**
+     * @struct ObjModel
+     * @brief Modelo OBJ subido a la GPU
+     *
+     * Las texturas de los materiales pertenecen a materials, por lo que el
+     * modelo debe vivir mientras se dibujen sus mallas.
+     */
+    struct ObjModel {
+        /** @brief Materiales con sus texturas cargadas */
+        std::vector<engine::core::Material> materials;
+
+        /** @brief Una malla por material usado */
+        std::vector<Mesh> meshes;
+
+        /** @brief Índice en materials de cada malla, o -1 si no tiene material */
+        std::vector<int> meshMaterials;
+    };
+
+    /**
+     * @class ObjLoader
+     * @brief Carga archivos Wavefront OBJ con sus bibliotecas MTL
+     *
+     * Soporta v (con color opcional por vértice), vt, vn, caras poligonales
+     * (se triangulan en abanico), índices negativos, mtllib y usemtl.
+     * Las caras se agrupan por material y cada grupo se suelda con
+     * VertexWelder para obtener una malla indexada.
+     *
+     * @example
+     * @code
+     * ObjModel model = ObjLoader::load("../../assets/models/cube.obj");
+     * for (size_t i = 0; i < model.meshes.size(); ++i) {
+     *     const Material& material = model.materials[model.meshMaterials[i]];
+     *     shader.setUniform("uMaterial.diffuse", material.diffuse);
+     *     model.meshes[i].draw(shader);
+     * }
+     * @endcode
+     */
+    class ObjLoader
+    {
+    public:
+        ObjLoader() = delete;
+
+        /**
+         * @brief Lee y procesa un OBJ en memoria de CPU (no requiere contexto OpenGL)
+         *
+         * @param path Ruta del archivo OBJ
+         * @param data Resultado; se sobrescribe
+         * @param params Parámetros de carga
+         * @return bool true si el archivo se pudo leer
+         */
+        static bool parse(const char* path, ObjData& data, const ObjLoadParams& params = ObjLoadParams());
+
+        /**
+         * @brief Carga un OBJ y crea sus mallas, materiales y texturas
+         *
+         * @param path Ruta del archivo OBJ
+         * @param params Parámetros de carga
+         * @return ObjModel Modelo cargado (vacío si el archivo no se pudo leer)
+         */
+        static ObjModel load(const char* path, const ObjLoadParams& params = ObjLoadParams());
+    };
+}
+
+#endif // OBJ_LOADER_HPP
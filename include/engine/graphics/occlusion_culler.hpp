@@ -0,0 +1,251 @@
+/**
+ * @file occlusion_culler.hpp
+ * @brief Culling por oclusión en CPU con un buffer de profundidad jerárquico
+ *
+ * Rasteriza unos pocos oclusores (paredes, suelos, objetos grandes) en un
+ * buffer de profundidad de baja resolución repartido en tiles entre varios
+ * hilos persistentes, construye a partir de él una pirámide de profundidades
+ * máximas y comprueba contra ella la caja en pantalla de cada objeto antes de
+ * dibujarlo. No usa la GPU, así que funciona también sin contexto OpenGL.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef OCCLUSION_CULLER_HPP
+#define OCCLUSION_CULLER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/parallel.hpp"
+#include "engine/graphics/frustum.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct OcclusionCullerParams
+     * @brief Parámetros de configuración de OcclusionCuller
+     */
+    struct OcclusionCullerParams {
+        /**
+         * @brief Ancho del buffer de profundidad en píxeles (se redondea a múltiplo de 4)
+         *
+         * @default 256
+         */
+        int width = 256;
+
+        /**
+         * @brief Alto del buffer de profundidad en píxeles
+         *
+         * @default 128
+         */
+        int height = 128;
+
+        /**
+         * @brief Número de hilos para rasterizar los tiles (0 = hardware_concurrency)
+         *
+         * @default 0
+         */
+        unsigned threadCount = 0;
+    };
+
+    /**
+     * @struct OcclusionStats
+     * @brief Resultado del último frame
+     */
+    struct OcclusionStats {
+        /** @brief Triángulos de oclusores rasterizados (tras descartar caras traseras y recortar) */
+        size_t occluderTriangles = 0;
+
+        /** @brief Objetos comprobados */
+        size_t testedObjects = 0;
+
+        /** @brief Objetos fuera del frustum */
+        size_t frustumCulled = 0;
+
+        /** @brief Objetos dentro del frustum pero tapados por los oclusores */
+        size_t occluded = 0;
+
+        /** @brief Objetos que hay que dibujar */
+        size_t visible = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const OcclusionStats& stats)
+    {
+        os << "Occluder triangles: " << stats.occluderTriangles << " | Objects: " << stats.testedObjects
+           << " (" << stats.frustumCulled << " outside frustum, " << stats.occluded << " occluded, "
+           << stats.visible << " visible)";
+        return os;
+    }
+
+    /**
+     * @class OcclusionCuller
+     * @brief Buffer de profundidad por software para descartar objetos tapados
+     *
+     * La profundidad se guarda como 1/w (w = distancia a lo largo de la vista),
+     * que se interpola linealmente en pantalla y no pierde precisión con un
+     * plano cercano muy pequeño. Un objeto está tapado si el punto más cercano
+     * de su caja queda detrás del oclusor más lejano en todos los píxeles que
+     * cubre su rectángulo en pantalla.
+     *
+     * @example
+     * @code
+     * OcclusionCuller culler;
+     * culler.beginFrame(camera.getProjectionMatrix(aspectRatio) * camera.getViewMatrix());
+     * for (const Wall& wall : walls)
+     *     culler.addOccluder(wall.boundsMin, wall.boundsMax, wall.model);
+     * culler.rasterize();
+     *
+     * culler.cull(boxes, visible);
+     * for (GLuint object : visible) {
+     *     shader.setUniform("uModel", models[object]);
+     *     mesh.draw(shader);
+     * }
+     * @endcode
+     *
+     * @note Los oclusores se muestrean en el centro de cada píxel. Por la baja
+     * resolución, un objeto que asoma menos de un píxel por el borde de un
+     * oclusor puede descartarse
+     *
+     * @note La clase no es copiable: los hilos que rasterizan los tiles se
+     * crean en el constructor y se reutilizan en cada rasterize()
+     */
+    class OcclusionCuller {
+        private:
+        /** @brief Triángulo en pantalla preparado para rasterizar con funciones de arista */
+        struct ScreenTriangle {
+            float edgeA[3];
+            float edgeB[3];
+            float edgeC[3];
+            float depthA;
+            float depthB;
+            float depthC;
+            int minX;
+            int minY;
+            int maxX;
+            int maxY;
+        };
+
+        int m_width;
+        int m_height;
+        engine::core::WorkerPool m_workers;
+        glm::mat4 m_viewProjection;
+        Frustum m_frustum;
+        std::vector<ScreenTriangle> m_triangles;
+        std::vector<glm::vec4> m_clipPositions;
+        std::vector<std::vector<float>> m_levels;
+        OcclusionStats m_stats;
+
+        void addClipTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c);
+        void rasterizeTile(int tileX, int tileY);
+        void buildLevels();
+        bool isOccluded(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const;
+        glm::ivec2 levelSize(size_t level) const;
+
+        public:
+        /**
+         * @brief Crea el buffer de profundidad vacío
+         *
+         * @param params Resolución y número de hilos
+         */
+        explicit OcclusionCuller(const OcclusionCullerParams& params = OcclusionCullerParams());
+
+        /**
+         * @brief Empieza un frame: borra la profundidad y los oclusores
+         *
+         * @param viewProjection Matriz de proyección por matriz de vista de la cámara
+         */
+        void beginFrame(const glm::mat4& viewProjection);
+
+        /**
+         * @brief Añade una malla como oclusor
+         *
+         * @param positions Posiciones de los vértices en espacio del objeto
+         * @param indexs Tres índices por triángulo, en sentido antihorario visto de frente
+         * @param model Matriz de modelo del oclusor
+         */
+        void addOccluder(std::span<const glm::vec3> positions,
+                         std::span<const GLuint> indexs,
+                         const glm::mat4& model);
+
+        /**
+         * @brief Añade una caja sólida como oclusor
+         *
+         * @param boundsMin Esquina mínima en espacio del objeto
+         * @param boundsMax Esquina máxima en espacio del objeto
+         * @param model Matriz de modelo del oclusor
+         */
+        void addOccluder(const glm::vec3& boundsMin, const glm::vec3& boundsMax, const glm::mat4& model);
+
+        /**
+         * @brief Rasteriza los oclusores añadidos y construye la pirámide de profundidad
+         */
+        void rasterize();
+
+        /**
+         * @brief Comprueba si una caja es visible
+         *
+         * @param boundsMin Esquina mínima en espacio del mundo
+         * @param boundsMax Esquina máxima en espacio del mundo
+         * @return bool false si la caja está fuera del frustum o tapada por completo
+         */
+        bool isVisible(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const;
+
+        /**
+         * @brief Descarta las cajas fuera del frustum o tapadas por los oclusores
+         *
+         * @param boxes Cajas en espacio del mundo
+         * @param visible Recibe los índices de las cajas visibles en orden creciente
+         * @return size_t Número de cajas visibles
+         */
+        size_t cull(const BoxBatch& boxes, std::vector<GLuint>& visible);
+
+        /**
+         * @brief Obtiene un nivel de la pirámide de profundidad
+         *
+         * El nivel 0 tiene la resolución completa y cada nivel siguiente guarda,
+         * por cada bloque de 2x2, la profundidad más lejana (el menor 1/w).
+         * Las filas empiezan por la parte inferior de la pantalla.
+         *
+         * @param level Nivel de la pirámide
+         * @return const std::vector<float>& Valores 1/w por píxel (0 = vacío)
+         */
+        const std::vector<float>& depth(size_t level = 0) const;
+
+        /**
+         * @brief Obtiene el número de niveles de la pirámide
+         *
+         * @return size_t Niveles, hasta 1x1
+         */
+        size_t levelCount() const;
+
+        /**
+         * @brief Obtiene el ancho del buffer de profundidad
+         *
+         * @return int Ancho en píxeles
+         */
+        int width() const;
+
+        /**
+         * @brief Obtiene el alto del buffer de profundidad
+         *
+         * @return int Alto en píxeles
+         */
+        int height() const;
+
+        /**
+         * @brief Obtiene las estadísticas del frame actual
+         *
+         * @return const OcclusionStats& Oclusores y objetos descartados
+         */
+        const OcclusionStats& stats() const;
+    };
+}
+
+#endif // OCCLUSION_CULLER_HPP
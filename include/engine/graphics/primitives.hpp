@@ -0,0 +1,587 @@
+/**
+ * @file primitives.hpp
+ * @brief Geometría primitiva generada en tiempo de compilación
+ *
+ * Generadores constexpr de cubo, esfera UV, icoesfera, plano, cilindro y
+ * toro. La teselación es un parámetro de plantilla, por lo que vértices e
+ * índices se calculan durante la compilación en std::array constantes
+ * (en .rodata) y se suben una sola vez a un buffer compartido con
+ * PrimitiveBuffer, sin construir vectores en el arranque.
+ *
+ * Todas las primitivas están centradas en el origen, caben en un cubo de
+ * lado 1, tienen orientación antihoraria vista desde fuera y generan
+ * posición, coordenadas de textura y normal (color blanco).
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef PRIMITIVES_HPP
+#define PRIMITIVES_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/vertex.hpp"
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/texture.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct PrimitiveView
+     * @brief Vista no propietaria de los vértices e índices de una primitiva
+     */
+    struct PrimitiveView {
+        /** @brief Vértices de la primitiva */
+        std::span<const engine::core::Vertex> vertexs;
+
+        /** @brief Índices (lista de triángulos), relativos al primer vértice */
+        std::span<const GLuint> indexs;
+    };
+
+    /**
+     * @struct PrimitiveData
+     * @brief Vértices e índices de una primitiva con tamaño fijo en compilación
+     *
+     * @tparam VertexCount Número de vértices
+     * @tparam IndexCount Número de índices
+     */
+    template <size_t VertexCount, size_t IndexCount>
+    struct PrimitiveData {
+        std::array<engine::core::Vertex, VertexCount> vertexs;
+        std::array<GLuint, IndexCount> indexs;
+
+        constexpr operator PrimitiveView() const
+        {
+            return { vertexs, indexs };
+        }
+    };
+
+    namespace primitives
+    {
+        // --------------------------------------------------------------
+        // Matemáticas constexpr (std::sin, std::cos y std::sqrt no lo son)
+        // --------------------------------------------------------------
+
+        constexpr double PI = 3.14159265358979323846;
+
+        constexpr double sine(double x)
+        {
+            // Reducción a [-pi, pi) y serie de Taylor hasta x^23
+            double turns = (x + PI) / (2.0 * PI);
+            long long whole = static_cast<long long>(turns);
+            if (turns < static_cast<double>(whole))
+                --whole;
+            x -= static_cast<double>(whole) * 2.0 * PI;
+
+            double term = x;
+            double sum = x;
+            for (int n = 1; n < 12; ++n) {
+                term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+                sum += term;
+            }
+            return sum;
+        }
+
+        constexpr double cosine(double x)
+        {
+            return sine(x + PI * 0.5);
+        }
+
+        constexpr double squareRoot(double x)
+        {
+            if (x <= 0.0)
+                return 0.0;
+
+            double guess = x > 1.0 ? x : 1.0;
+            for (int i = 0; i < 64; ++i) {
+                double next = 0.5 * (guess + x / guess);
+                if (next == guess)
+                    break;
+                guess = next;
+            }
+            return guess;
+        }
+
+        constexpr glm::vec3 normalized(const glm::vec3& v)
+        {
+            float length = static_cast<float>(squareRoot(static_cast<double>(v.x) * v.x +
+                                                         static_cast<double>(v.y) * v.y +
+                                                         static_cast<double>(v.z) * v.z));
+            return length > 0.0f ? v / length : v;
+        }
+
+        // --------------------------------------------------------------
+        // Generadores
+        // --------------------------------------------------------------
+
+        /**
+         * @brief Cubo de lado 1 con 4 vértices por cara (normales planas)
+         *
+         * @return PrimitiveData<24, 36> Vértices e índices del cubo
+         */
+        constexpr PrimitiveData<24, 36> cube()
+        {
+            using engine::core::Vertex;
+            return {
+                {{
+                    // Cara frontal (z = -0.5) - Normal: (0, 0, -1)
+                    Vertex({0.5f, 0.5f, -0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+                    Vertex({0.5f, -0.5f, -0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+                    Vertex({-0.5f, -0.5f, -0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+                    Vertex({-0.5f, 0.5f, -0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f)),
+
+                    // Cara trasera (z = 0.5) - Normal: (0, 0, 1)
+                    Vertex({0.5f, 0.5f, 0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+                    Vertex({0.5f, -0.5f, 0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+                    Vertex({-0.5f, -0.5f, 0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+                    Vertex({-0.5f, 0.5f, 0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(0.0f, 0.0f, 1.0f)),
+
+                    // Cara derecha (x = 0.5) - Normal: (1, 0, 0)
+                    Vertex({0.5f, 0.5f, 0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f)),
+                    Vertex({0.5f, -0.5f, 0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f)),
+                    Vertex({0.5f, -0.5f, -0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(1.0f, 0.0f, 0.0f)),
+                    Vertex({0.5f, 0.5f, -0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(1.0f, 0.0f, 0.0f)),
+
+                    // Cara izquierda (x = -0.5) - Normal: (-1, 0, 0)
+                    Vertex({-0.5f, 0.5f, -0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(-1.0f, 0.0f, 0.0f)),
+                    Vertex({-0.5f, -0.5f, -0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f)),
+                    Vertex({-0.5f, -0.5f, 0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f)),
+                    Vertex({-0.5f, 0.5f, 0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(-1.0f, 0.0f, 0.0f)),
+
+                    // Cara superior (y = 0.5) - Normal: (0, 1, 0)
+                    Vertex({0.5f, 0.5f, 0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+                    Vertex({0.5f, 0.5f, -0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+                    Vertex({-0.5f, 0.5f, -0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+                    Vertex({-0.5f, 0.5f, 0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(0.0f, 1.0f, 0.0f)),
+
+                    // Cara inferior (y = -0.5) - Normal: (0, -1, 0)
+                    Vertex({0.5f, -0.5f, -0.5f}, glm::vec2(1.0f, 1.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                    Vertex({0.5f, -0.5f, 0.5f}, glm::vec2(1.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                    Vertex({-0.5f, -0.5f, 0.5f}, glm::vec2(0.0f, 0.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                    Vertex({-0.5f, -0.5f, -0.5f}, glm::vec2(0.0f, 1.0f), glm::vec3(0.0f, -1.0f, 0.0f)),
+                }},
+                {{
+                    0, 1, 3, 1, 2, 3,           // Cara frontal
+                    4, 7, 5, 5, 7, 6,           // Cara trasera
+                    8, 9, 11, 9, 10, 11,        // Cara derecha
+                    12, 13, 15, 13, 14, 15,     // Cara izquierda
+                    16, 17, 19, 17, 18, 19,     // Cara superior
+                    20, 21, 23, 21, 22, 23,     // Cara inferior
+                }}
+            };
+        }
+
+        /**
+         * @brief Esfera de diámetro 1 parametrizada por longitud y latitud
+         *
+         * @tparam Segments Divisiones alrededor del eje Y (>= 3)
+         * @tparam Rings Divisiones de polo a polo (>= 2)
+         * @return PrimitiveData Vértices (con costura duplicada en u = 1) e índices
+         */
+        template <size_t Segments, size_t Rings>
+        constexpr PrimitiveData<(Segments + 1) * (Rings + 1), 6 * Segments * (Rings - 1)> uvSphere()
+        {
+            static_assert(Segments >= 3 && Rings >= 2, "UV sphere needs at least 3 segments and 2 rings");
+
+            PrimitiveData<(Segments + 1) * (Rings + 1), 6 * Segments * (Rings - 1)> data{};
+            for (size_t ring = 0; ring <= Rings; ++ring) {
+                double polar = PI * static_cast<double>(ring) / Rings;
+                for (size_t segment = 0; segment <= Segments; ++segment) {
+                    double azimuth = 2.0 * PI * static_cast<double>(segment) / Segments;
+                    glm::vec3 normal(static_cast<float>(sine(polar) * cosine(azimuth)),
+                                     static_cast<float>(cosine(polar)),
+                                     static_cast<float>(sine(polar) * sine(azimuth)));
+                    glm::vec2 texCoords(static_cast<float>(segment) / Segments,
+                                        1.0f - static_cast<float>(ring) / Rings);
+                    data.vertexs[ring * (Segments + 1) + segment] = engine::core::Vertex(normal * 0.5f, texCoords, normal);
+                }
+            }
+
+            // Los polos solo necesitan un triángulo por segmento
+            size_t index = 0;
+            for (size_t ring = 0; ring < Rings; ++ring) {
+                for (size_t segment = 0; segment < Segments; ++segment) {
+                    GLuint a = static_cast<GLuint>(ring * (Segments + 1) + segment);
+                    GLuint b = a + static_cast<GLuint>(Segments + 1);
+                    GLuint c = b + 1;
+                    GLuint d = a + 1;
+                    if (ring != 0) {
+                        data.indexs[index++] = a;
+                        data.indexs[index++] = d;
+                        data.indexs[index++] = b;
+                    }
+                    if (ring != Rings - 1) {
+                        data.indexs[index++] = b;
+                        data.indexs[index++] = d;
+                        data.indexs[index++] = c;
+                    }
+                }
+            }
+            return data;
+        }
+
+        /**
+         * @brief Esfera de diámetro 1 a partir de un icosaedro subdividido
+         *
+         * Cada cara del icosaedro se divide en 4^Level triángulos y los vértices
+         * de aristas compartidas no se duplican, así que la densidad es casi
+         * uniforme y sin polos.
+         *
+         * @tparam Level Nivel de subdivisión (0 = icosaedro)
+         * @return PrimitiveData Vértices (10 * 4^Level + 2) e índices
+         *
+         * @note Las coordenadas de textura valen 0; para texturizar usar uvSphere()
+         */
+        template <size_t Level>
+        constexpr PrimitiveData<10 * (size_t(1) << (2 * Level)) + 2, 60 * (size_t(1) << (2 * Level))> icosphere()
+        {
+            constexpr size_t N = size_t(1) << Level;
+            constexpr float T = 1.6180339887498949f;
+            constexpr glm::vec3 CORNERS[12] = {
+                {-1.0f, T, 0.0f}, {1.0f, T, 0.0f}, {-1.0f, -T, 0.0f}, {1.0f, -T, 0.0f},
+                {0.0f, -1.0f, T}, {0.0f, 1.0f, T}, {0.0f, -1.0f, -T}, {0.0f, 1.0f, -T},
+                {T, 0.0f, -1.0f}, {T, 0.0f, 1.0f}, {-T, 0.0f, -1.0f}, {-T, 0.0f, 1.0f},
+            };
+            constexpr size_t FACES[20][3] = {
+                {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+                {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+                {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+                {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1},
+            };
+
+            // Las 30 aristas en orden de aparición; sus puntos interiores van tras las esquinas
+            size_t edges[30][2] = {};
+            size_t edgeCount = 0;
+            for (const auto& face : FACES) {
+                for (size_t k = 0; k < 3; ++k) {
+                    size_t u = face[k], v = face[(k + 1) % 3];
+                    bool found = false;
+                    for (size_t e = 0; e < edgeCount; ++e)
+                        found = found || (edges[e][0] == v && edges[e][1] == u);
+                    if (!found) {
+                        edges[edgeCount][0] = u;
+                        edges[edgeCount][1] = v;
+                        ++edgeCount;
+                    }
+                }
+            }
+
+            auto edgePoint = [&](size_t u, size_t v, size_t k) -> size_t {
+                for (size_t e = 0; e < 30; ++e) {
+                    if (edges[e][0] == u && edges[e][1] == v)
+                        return 12 + e * (N - 1) + (k - 1);
+                    if (edges[e][0] == v && edges[e][1] == u)
+                        return 12 + e * (N - 1) + (N - k - 1);
+                }
+                return 0;
+            };
+
+            PrimitiveData<10 * N * N + 2, 60 * N * N> data{};
+            const size_t interiorBase = 12 + 30 * (N - 1);
+            const size_t interiorPerFace = N >= 3 ? (N - 1) * (N - 2) / 2 : 0;
+            size_t index = 0;
+
+            for (size_t f = 0; f < 20; ++f) {
+                const size_t a = FACES[f][0], b = FACES[f][1], c = FACES[f][2];
+
+                // Punto (i, j) de la rejilla triangular: a en (0,0), b en (N,0) y c en (N,N)
+                auto vertexId = [&](size_t i, size_t j) -> size_t {
+                    if (i == 0)                   return a;
+                    if (i == N && j == 0)         return b;
+                    if (i == N && j == N)         return c;
+                    if (j == 0)                   return edgePoint(a, b, i);
+                    if (i == N)                   return edgePoint(b, c, j);
+                    if (i == j)                   return edgePoint(a, c, i);
+                    return interiorBase + f * interiorPerFace + (i - 2) * (i - 1) / 2 + (j - 1);
+                };
+
+                for (size_t i = 0; i <= N; ++i) {
+                    for (size_t j = 0; j <= i; ++j) {
+                        glm::vec3 point = CORNERS[a] * (static_cast<float>(N - i) / N) +
+                                          CORNERS[b] * (static_cast<float>(i - j) / N) +
+                                          CORNERS[c] * (static_cast<float>(j) / N);
+                        glm::vec3 normal = normalized(point);
+                        data.vertexs[vertexId(i, j)] = engine::core::Vertex(normal * 0.5f, glm::vec2(0.0f), normal);
+                    }
+                }
+
+                for (size_t i = 0; i < N; ++i) {
+                    for (size_t j = 0; j <= i; ++j) {
+                        data.indexs[index++] = static_cast<GLuint>(vertexId(i, j));
+                        data.indexs[index++] = static_cast<GLuint>(vertexId(i + 1, j));
+                        data.indexs[index++] = static_cast<GLuint>(vertexId(i + 1, j + 1));
+                        if (j < i) {
+                            data.indexs[index++] = static_cast<GLuint>(vertexId(i, j));
+                            data.indexs[index++] = static_cast<GLuint>(vertexId(i + 1, j + 1));
+                            data.indexs[index++] = static_cast<GLuint>(vertexId(i, j + 1));
+                        }
+                    }
+                }
+            }
+            return data;
+        }
+
+        /**
+         * @brief Plano de lado 1 en XZ con normal +Y, dividido en una rejilla
+         *
+         * @tparam Divisions Celdas por lado (>= 1)
+         * @return PrimitiveData Vértices e índices de la rejilla
+         */
+        template <size_t Divisions>
+        constexpr PrimitiveData<(Divisions + 1) * (Divisions + 1), 6 * Divisions * Divisions> plane()
+        {
+            static_assert(Divisions >= 1, "Plane needs at least 1 division");
+
+            PrimitiveData<(Divisions + 1) * (Divisions + 1), 6 * Divisions * Divisions> data{};
+            for (size_t z = 0; z <= Divisions; ++z) {
+                for (size_t x = 0; x <= Divisions; ++x) {
+                    float u = static_cast<float>(x) / Divisions;
+                    float v = static_cast<float>(z) / Divisions;
+                    data.vertexs[z * (Divisions + 1) + x] = engine::core::Vertex(
+                        glm::vec3(u - 0.5f, 0.0f, v - 0.5f), glm::vec2(u, 1.0f - v), glm::vec3(0.0f, 1.0f, 0.0f));
+                }
+            }
+
+            size_t index = 0;
+            for (size_t z = 0; z < Divisions; ++z) {
+                for (size_t x = 0; x < Divisions; ++x) {
+                    GLuint a = static_cast<GLuint>(z * (Divisions + 1) + x);
+                    GLuint b = a + static_cast<GLuint>(Divisions + 1);
+                    GLuint c = b + 1;
+                    GLuint d = a + 1;
+                    data.indexs[index++] = a;
+                    data.indexs[index++] = b;
+                    data.indexs[index++] = c;
+                    data.indexs[index++] = a;
+                    data.indexs[index++] = c;
+                    data.indexs[index++] = d;
+                }
+            }
+            return data;
+        }
+
+        /**
+         * @brief Cilindro de diámetro 1 y altura 1 a lo largo de Y, con tapas
+         *
+         * @tparam Segments Divisiones alrededor del eje (>= 3)
+         * @return PrimitiveData Vértices (lateral y tapas separados por sus normales) e índices
+         */
+        template <size_t Segments>
+        constexpr PrimitiveData<4 * Segments + 6, 12 * Segments> cylinder()
+        {
+            static_assert(Segments >= 3, "Cylinder needs at least 3 segments");
+
+            PrimitiveData<4 * Segments + 6, 12 * Segments> data{};
+            const size_t sideBase = 0;
+            const size_t topBase = 2 * (Segments + 1);
+            const size_t bottomBase = topBase + Segments + 2;
+
+            data.vertexs[topBase] = engine::core::Vertex(glm::vec3(0.0f, 0.5f, 0.0f), glm::vec2(0.5f), glm::vec3(0.0f, 1.0f, 0.0f));
+            data.vertexs[bottomBase] = engine::core::Vertex(glm::vec3(0.0f, -0.5f, 0.0f), glm::vec2(0.5f), glm::vec3(0.0f, -1.0f, 0.0f));
+
+            for (size_t segment = 0; segment <= Segments; ++segment) {
+                double angle = 2.0 * PI * static_cast<double>(segment) / Segments;
+                float x = static_cast<float>(cosine(angle));
+                float z = static_cast<float>(sine(angle));
+                float u = static_cast<float>(segment) / Segments;
+                glm::vec2 capTexCoords(x * 0.5f + 0.5f, z * 0.5f + 0.5f);
+
+                data.vertexs[sideBase + 2 * segment] = engine::core::Vertex(
+                    glm::vec3(x * 0.5f, -0.5f, z * 0.5f), glm::vec2(u, 0.0f), glm::vec3(x, 0.0f, z));
+                data.vertexs[sideBase + 2 * segment + 1] = engine::core::Vertex(
+                    glm::vec3(x * 0.5f, 0.5f, z * 0.5f), glm::vec2(u, 1.0f), glm::vec3(x, 0.0f, z));
+                data.vertexs[topBase + 1 + segment] = engine::core::Vertex(
+                    glm::vec3(x * 0.5f, 0.5f, z * 0.5f), capTexCoords, glm::vec3(0.0f, 1.0f, 0.0f));
+                data.vertexs[bottomBase + 1 + segment] = engine::core::Vertex(
+                    glm::vec3(x * 0.5f, -0.5f, z * 0.5f), capTexCoords, glm::vec3(0.0f, -1.0f, 0.0f));
+            }
+
+            size_t index = 0;
+            for (size_t segment = 0; segment < Segments; ++segment) {
+                GLuint bottom0 = static_cast<GLuint>(sideBase + 2 * segment);
+                GLuint top0 = bottom0 + 1;
+                GLuint bottom1 = bottom0 + 2;
+                GLuint top1 = bottom0 + 3;
+                data.indexs[index++] = bottom0;
+                data.indexs[index++] = top0;
+                data.indexs[index++] = bottom1;
+                data.indexs[index++] = bottom1;
+                data.indexs[index++] = top0;
+                data.indexs[index++] = top1;
+
+                data.indexs[index++] = static_cast<GLuint>(topBase);
+                data.indexs[index++] = static_cast<GLuint>(topBase + 2 + segment);
+                data.indexs[index++] = static_cast<GLuint>(topBase + 1 + segment);
+
+                data.indexs[index++] = static_cast<GLuint>(bottomBase);
+                data.indexs[index++] = static_cast<GLuint>(bottomBase + 1 + segment);
+                data.indexs[index++] = static_cast<GLuint>(bottomBase + 2 + segment);
+            }
+            return data;
+        }
+
+        /**
+         * @brief Toro en el plano XZ con diámetro exterior 1
+         *
+         * El radio mayor es 0.35 y el del tubo 0.15.
+         *
+         * @tparam Segments Divisiones alrededor del eje Y (>= 3)
+         * @tparam Sides Divisiones alrededor del tubo (>= 3)
+         * @return PrimitiveData Vértices e índices del toro
+         */
+        template <size_t Segments, size_t Sides>
+        constexpr PrimitiveData<(Segments + 1) * (Sides + 1), 6 * Segments * Sides> torus()
+        {
+            static_assert(Segments >= 3 && Sides >= 3, "Torus needs at least 3 segments and 3 sides");
+
+            constexpr float MAJOR_RADIUS = 0.35f;
+            constexpr float MINOR_RADIUS = 0.15f;
+
+            PrimitiveData<(Segments + 1) * (Sides + 1), 6 * Segments * Sides> data{};
+            for (size_t segment = 0; segment <= Segments; ++segment) {
+                double theta = 2.0 * PI * static_cast<double>(segment) / Segments;
+                float cosTheta = static_cast<float>(cosine(theta));
+                float sinTheta = static_cast<float>(sine(theta));
+                for (size_t side = 0; side <= Sides; ++side) {
+                    double phi = 2.0 * PI * static_cast<double>(side) / Sides;
+                    float cosPhi = static_cast<float>(cosine(phi));
+                    float sinPhi = static_cast<float>(sine(phi));
+
+                    glm::vec3 normal(cosPhi * cosTheta, sinPhi, cosPhi * sinTheta);
+                    glm::vec3 center(MAJOR_RADIUS * cosTheta, 0.0f, MAJOR_RADIUS * sinTheta);
+                    glm::vec2 texCoords(static_cast<float>(segment) / Segments, static_cast<float>(side) / Sides);
+                    data.vertexs[segment * (Sides + 1) + side] = engine::core::Vertex(center + normal * MINOR_RADIUS, texCoords, normal);
+                }
+            }
+
+            size_t index = 0;
+            for (size_t segment = 0; segment < Segments; ++segment) {
+                for (size_t side = 0; side < Sides; ++side) {
+                    GLuint a = static_cast<GLuint>(segment * (Sides + 1) + side);
+                    GLuint b = a + static_cast<GLuint>(Sides + 1);
+                    GLuint c = b + 1;
+                    GLuint d = a + 1;
+                    data.indexs[index++] = a;
+                    data.indexs[index++] = d;
+                    data.indexs[index++] = b;
+                    data.indexs[index++] = b;
+                    data.indexs[index++] = d;
+                    data.indexs[index++] = c;
+                }
+            }
+            return data;
+        }
+
+        // --------------------------------------------------------------
+        // Primitivas con teselación por defecto, evaluadas en compilación
+        // --------------------------------------------------------------
+
+        /** @brief Cubo de lado 1 */
+        inline constexpr auto CUBE = cube();
+
+        /** @brief Esfera UV de diámetro 1 */
+        template <size_t Segments = 32, size_t Rings = 16>
+        inline constexpr auto UV_SPHERE = uvSphere<Segments, Rings>();
+
+        /** @brief Icoesfera de diámetro 1 */
+        template <size_t Level = 3>
+        inline constexpr auto ICOSPHERE = icosphere<Level>();
+
+        /** @brief Plano de lado 1 en XZ */
+        template <size_t Divisions = 1>
+        inline constexpr auto PLANE = plane<Divisions>();
+
+        /** @brief Cilindro de diámetro y altura 1 */
+        template <size_t Segments = 32>
+        inline constexpr auto CYLINDER = cylinder<Segments>();
+
+        /** @brief Toro de diámetro exterior 1 */
+        template <size_t Segments = 32, size_t Sides = 16>
+        inline constexpr auto TORUS = torus<Segments, Sides>();
+    }
+
+    /**
+     * @class PrimitiveBuffer
+     * @brief Sube varias primitivas a un único VBO/EBO y crea mallas que lo comparten
+     *
+     * Los vértices se copian a la GPU directamente desde los arrays constantes
+     * (sin vectores intermedios) y cada malla creada con mesh() es una vista
+     * con su propio VAO sobre la región de su primitiva.
+     *
+     * @example
+     * @code
+     * PrimitiveBuffer shapes({ primitives::CUBE, primitives::UV_SPHERE<> });
+     * Mesh box = shapes.mesh(0, {&diffuseMap});
+     * Mesh ball = shapes.mesh(1, {}, VertexAttributes::POSITION | VertexAttributes::NORMAL);
+     * @endcode
+     *
+     * @note El PrimitiveBuffer debe vivir más que las mallas creadas con mesh()
+     */
+    class PrimitiveBuffer
+    {
+    private:
+        /** @brief Vertex Buffer Object compartido */
+        GLuint m_VBO;
+
+        /** @brief Element Buffer Object compartido */
+        GLuint m_EBO;
+
+        /** @brief Región y formato de cada primitiva dentro de los buffers */
+        std::vector<MeshGpuLayout> m_layouts;
+
+    public:
+        /**
+         * @brief Constructor que sube todas las primitivas con una sola reserva por buffer
+         *
+         * @param primitives Primitivas a subir, en el orden en que se referenciarán
+         */
+        explicit PrimitiveBuffer(std::initializer_list<PrimitiveView> primitives);
+
+        /**
+         * @brief Destructor - libera los buffers de OpenGL
+         */
+        ~PrimitiveBuffer();
+
+        PrimitiveBuffer(const PrimitiveBuffer&) = delete;
+        PrimitiveBuffer& operator=(const PrimitiveBuffer&) = delete;
+
+        /**
+         * @brief Crea una malla que dibuja una de las primitivas
+         *
+         * @param primitive Índice de la primitiva (orden del constructor)
+         * @param textures Vector de texturas a aplicar a la malla
+         * @param attributes Atributos a habilitar en el VAO
+         * @return Mesh Vista sobre los buffers compartidos
+         */
+        Mesh mesh(size_t primitive,
+                  const std::vector<engine::graphics::Texture*>& textures = {},
+                  const VertexAttributes attributes = VertexAttributes::POSITION |
+                                                      VertexAttributes::TEXCOORDS |
+                                                      VertexAttributes::NORMAL) const;
+
+        /**
+         * @brief Obtiene la región de una primitiva dentro de los buffers
+         *
+         * @param primitive Índice de la primitiva
+         * @return const MeshGpuLayout& Formato, baseVertex e indexOffset de la primitiva
+         */
+        const MeshGpuLayout& layout(size_t primitive) const;
+
+        /**
+         * @brief Obtiene el número de primitivas subidas
+         *
+         * @return size_t Cantidad de primitivas
+         */
+        size_t primitiveCount() const;
+    };
+}
+
+#endif // PRIMITIVES_HPP
@@ -0,0 +1,140 @@
+/**
+ * @file program_cache.hpp
+ * @brief Caché en disco de binarios de programas de shaders
+ *
+ * Compilar y enlazar GLSL desde texto cuesta decenas de milisegundos por
+ * programa. ProgramCache guarda el resultado de glGetProgramBinary en un
+ * directorio, indexado por un hash del código fuente de todas las etapas y
+ * de las cadenas del driver (vendor, renderer y versión), y en el siguiente
+ * arranque restaura el programa con glProgramBinary sin pasar por el
+ * compilador. Un cambio en el código o en el driver produce otra clave, y
+ * un binario que el driver rechace se descarta y se vuelve a compilar.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef PROGRAM_CACHE_HPP
+#define PROGRAM_CACHE_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <initializer_list>
+#include <ostream>
+#include <string_view>
+
+namespace engine::graphics
+{
+    /**
+     * @struct ProgramCacheStats
+     * @brief Contadores de uso de la caché desde el inicio de la aplicación
+     */
+    struct ProgramCacheStats {
+        /** @brief Programas restaurados desde disco */
+        size_t hits = 0;
+
+        /** @brief Programas que hubo que compilar */
+        size_t misses = 0;
+
+        /** @brief Binarios escritos en disco */
+        size_t stores = 0;
+
+        /** @brief Binarios rechazados por el driver o ilegibles */
+        size_t rejected = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const ProgramCacheStats& stats)
+    {
+        os << "Program cache: " << stats.hits << " hits, " << stats.misses << " misses, "
+           << stats.stores << " stored, " << stats.rejected << " rejected";
+        return os;
+    }
+
+    /**
+     * @class ProgramCache
+     * @brief Caché global de binarios de programas, usada por Shader al construirse
+     *
+     * @example
+     * @code
+     * ProgramCache::setDirectory("cache/shaders");
+     * Shader shader("shaders/vertex.vert", "shaders/fragment.frag"); // compila o restaura
+     * std::cout << ProgramCache::stats() << std::endl;
+     * @endcode
+     *
+     * @note Requiere un contexto OpenGL activo. Si el driver no ofrece ningún
+     * formato de binario (GL_NUM_PROGRAM_BINARY_FORMATS == 0) la caché no hace nada
+     */
+    class ProgramCache {
+        private:
+        static std::filesystem::path directoryPath;
+        static ProgramCacheStats cacheStats;
+
+        static std::filesystem::path entryPath(uint64_t key);
+
+        public:
+        ProgramCache() = delete;
+
+        /**
+         * @brief Cambia el directorio de la caché
+         *
+         * @param directory Directorio donde guardar los binarios; vacío desactiva la caché
+         *
+         * @default "shader_cache" relativo al directorio de trabajo
+         */
+        static void setDirectory(const std::filesystem::path& directory);
+
+        /**
+         * @brief Obtiene el directorio de la caché
+         *
+         * @return const std::filesystem::path& Directorio actual (vacío si está desactivada)
+         */
+        static const std::filesystem::path& directory();
+
+        /**
+         * @brief Calcula la clave de un programa
+         *
+         * @param sources Código fuente de cada etapa, en orden de enlazado
+         * @return uint64_t Hash FNV-1a de las fuentes y de las cadenas del driver
+         */
+        static uint64_t key(std::initializer_list<std::string_view> sources);
+
+        /**
+         * @brief Restaura un programa guardado
+         *
+         * @param key Clave calculada con key()
+         * @return GLuint Programa enlazado, o 0 si no está en caché o el driver lo rechaza
+         */
+        static GLuint load(uint64_t key);
+
+        /**
+         * @brief Guarda el binario de un programa enlazado
+         *
+         * Se escribe en un fichero temporal que después se renombra, de modo
+         * que otro proceso nunca lee un binario a medio escribir.
+         *
+         * @param key Clave calculada con key()
+         * @param program Programa enlazado con GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+         */
+        static void store(uint64_t key, GLuint program);
+
+        /**
+         * @brief Indica si la caché está activa
+         *
+         * @return bool true si hay directorio y el driver admite binarios
+         */
+        static bool enabled();
+
+        /**
+         * @brief Obtiene los contadores de la caché
+         *
+         * @return const ProgramCacheStats& Aciertos, fallos y binarios guardados
+         */
+        static const ProgramCacheStats& stats();
+    };
+}
+
+#endif // PROGRAM_CACHE_HPP
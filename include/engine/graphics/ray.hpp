@@ -0,0 +1,45 @@
+/**
+ * @file ray.hpp
+ * @brief Rayo en espacio del mundo para consultas de picking
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef RAY_HPP
+#define RAY_HPP
+
+#pragma once
+
+#include <glm/glm.hpp>
+
+namespace engine::graphics
+{
+    /**
+     * @struct Ray
+     * @brief Semirrecta origin + t * direction con t >= 0
+     *
+     * @example
+     * @code
+     * Ray ray = camera.screenRay(Mouse::positionX(), Mouse::positionY(), width, height);
+     * glm::vec3 point = ray.at(hit.distance);
+     * @endcode
+     */
+    struct Ray {
+        glm::vec3 origin;
+        glm::vec3 direction;
+
+        /**
+         * @brief Obtiene el punto del rayo a una distancia dada
+         *
+         * @param distance Distancia desde el origen (en unidades de direction)
+         * @return glm::vec3 Punto origin + distance * direction
+         */
+        glm::vec3 at(float distance) const
+        {
+            return origin + distance * direction;
+        }
+    };
+}
+
+#endif // RAY_HPP
@@ -18,13 +18,59 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
+#include <cstdint>
+#include <cstring>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 #include <iostream> 
 #include <fstream>
 #include <sstream>
+#include "engine/graphics/shader_preprocessor.hpp"
 
 namespace engine::graphics {
+    /**
+     * @brief Hash FNV-1a de 64 bits del nombre de una variable uniforme
+     *
+     * @param name Nombre tal y como aparece en GLSL (p. ej. "uLight.position")
+     * @return uint64_t Hash del nombre, nunca 0
+     */
+    constexpr uint64_t hashUniformName(const char* name)
+    {
+        uint64_t hash = 14695981039346656037ull;
+        for (; *name != '\0'; ++name) {
+            hash ^= static_cast<unsigned char>(*name);
+            hash *= 1099511628211ull;
+        }
+
+        return hash != 0 ? hash : 1;
+    }
+
+    /**
+     * @struct UniformName
+     * @brief Nombre de una variable uniforme junto a su hash
+     *
+     * Se construye implícitamente desde un const char*, así que
+     * setUniform("uModel", model) sigue funcionando. Declarándolo constexpr
+     * el hash se calcula en compilación y la búsqueda no recorre la cadena.
+     *
+     * @example
+     * @code
+     * static constexpr UniformName MODEL("uModel");
+     * shader.setUniform(MODEL, model);
+     * @endcode
+     */
+    struct UniformName {
+        const char* name;
+        uint64_t hash;
+
+        constexpr UniformName(const char* uniformName)
+            : name(uniformName)
+            , hash(hashUniformName(uniformName))
+        {}
+    };
+
     /**
      * @class Shader
      * @brief Maneja la carga, compilación y uso de programas de shaders OpenGL
@@ -34,12 +80,99 @@ namespace engine::graphics {
      * enlazarlos en un programa y establecer variables uniformes de manera segura.
      * 
      * @note Los shaders deben estar escritos en GLSL y seguir el estándar Core Profile
+     *
+     * @note Si el programa declara el bloque uniforme "Camera" (ver CameraUniforms),
+     * se asocia al binding CAMERA_UNIFORM_BINDING al enlazarse, así que recibe las
+     * matrices que publique Camera::publish() sin llamar a setUniform
      */
     class Shader {
         private:
+        /** @brief Entrada de la tabla de uniforms con la copia del último valor enviado */
+        struct UniformSlot {
+            uint64_t hash = 0;
+            GLint location = -1;
+            bool hasValue = false;
+            GLenum type = 0;
+            void (*upload)(GLuint program, GLint location, const void* value) = nullptr;
+            alignas(16) unsigned char value[sizeof(glm::mat4)];
+        };
+
         /** @brief Identificador del programa de shaders en OpenGL */
         GLuint m_ID;
 
+        /** @brief Tabla hash plana con sondeo lineal (capacidad potencia de dos, 0 = libre) */
+        std::vector<UniformSlot> m_uniforms;
+
+        /** @brief Entradas ocupadas en m_uniforms, incluidos los nombres que no existen */
+        size_t m_uniformCount;
+
+        /** @brief Uniforms activos encontrados al enlazar */
+        size_t m_activeUniformCount;
+
+        /** @brief Bindings pedidos con bindBlock(), para reaplicarlos en replaceProgram() */
+        std::vector<std::pair<std::string, GLuint>> m_blockBindings;
+
+        void initialize();
+        void reflectUniforms();
+        void insertUniform(uint64_t hash, GLint location);
+        void growUniforms();
+        UniformSlot* findSlot(uint64_t hash);
+        UniformSlot* findUniform(const UniformName& name);
+
+        /** @brief Tipo GLSL de cada tipo de setUniform: distingue valores del mismo tamaño */
+        template <typename T>
+        static constexpr GLenum uniformType()
+        {
+            if constexpr (std::is_same_v<T, bool>) return GL_BOOL;
+            else if constexpr (std::is_same_v<T, int>) return GL_INT;
+            else if constexpr (std::is_same_v<T, float>) return GL_FLOAT;
+            else if constexpr (std::is_same_v<T, double>) return GL_DOUBLE;
+            else if constexpr (std::is_same_v<T, glm::vec2>) return GL_FLOAT_VEC2;
+            else if constexpr (std::is_same_v<T, glm::vec3>) return GL_FLOAT_VEC3;
+            else if constexpr (std::is_same_v<T, glm::vec4>) return GL_FLOAT_VEC4;
+            else if constexpr (std::is_same_v<T, glm::mat2>) return GL_FLOAT_MAT2;
+            else if constexpr (std::is_same_v<T, glm::mat3>) return GL_FLOAT_MAT3;
+            else return GL_FLOAT_MAT4;
+        }
+
+        template <typename T>
+        static void uploadUniform(GLuint program, GLint location, const void* data)
+        {
+            T value;
+            std::memcpy(&value, data, sizeof(T));
+
+            if constexpr (std::is_same_v<T, bool>) {
+                glProgramUniform1i(program, location, static_cast<int>(value));
+            }
+            else if constexpr (std::is_same_v<T, int>) {
+                glProgramUniform1i(program, location, value);
+            }
+            else if constexpr (std::is_same_v<T, float>) {
+                glProgramUniform1f(program, location, value);
+            }
+            else if constexpr (std::is_same_v<T, double>) {
+                glProgramUniform1d(program, location, value);
+            }
+            else if constexpr (std::is_same_v<T, glm::vec2>) {
+                glProgramUniform2f(program, location, value.x, value.y);
+            }
+            else if constexpr (std::is_same_v<T, glm::vec3>) {
+                glProgramUniform3f(program, location, value.x, value.y, value.z);
+            }
+            else if constexpr (std::is_same_v<T, glm::vec4>) {
+                glProgramUniform4f(program, location, value.x, value.y, value.z, value.w);
+            }
+            else if constexpr (std::is_same_v<T, glm::mat2>) {
+                glProgramUniformMatrix2fv(program, location, 1, GL_FALSE, glm::value_ptr(value));
+            }
+            else if constexpr (std::is_same_v<T, glm::mat3>) {
+                glProgramUniformMatrix3fv(program, location, 1, GL_FALSE, glm::value_ptr(value));
+            }
+            else if constexpr (std::is_same_v<T, glm::mat4>) {
+                glProgramUniformMatrix4fv(program, location, 1, GL_FALSE, glm::value_ptr(value));
+            }
+        }
+
         public:
             /**
              * @brief Constructor que carga y compila shaders desde archivos
@@ -47,17 +180,32 @@ namespace engine::graphics {
              * Crea un programa de shaders cargando y compilando un vertex shader
              * y un fragment shader desde las rutas especificadas.
              * 
+             * Ambos archivos pasan por ShaderPreprocessor, así que pueden usar
+             * #include y comprobar con #ifdef las claves de defines.
+             * 
              * @param vertexPath Ruta al archivo del vertex shader
              * @param fragmentPath Ruta al archivo del fragment shader
+             * @param defines Claves de permutación definidas en ambas etapas
              * 
              * @throws std::runtime_error Si falla la carga o compilación de los shaders
              * 
              * @example
              * @code
              * Shader shader("shaders/vertex.vert", "shaders/fragment.frag");
+             * Shader gouraud("shaders/lighting.vert", "shaders/lighting.frag", {"GOURAUD"});
              * @endcode
              */
-            Shader(const char* vertexPath, const char* fragmentPath);
+            Shader(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines = {});
+
+            /**
+             * @brief Constructor que toma posesión de un programa ya enlazado
+             * 
+             * Lo usa ShaderLibrary para entregar los programas que compila en lote.
+             * El programa se libera en el destructor.
+             * 
+             * @param program Programa enlazado correctamente, o 0
+             */
+            explicit Shader(GLuint program);
 
             /**
              * @brief Destructor - libera los recursos del programa de shaders
@@ -92,11 +240,17 @@ namespace engine::graphics {
              * - glm::vec2, glm::vec3, glm::vec4
              * - glm::mat2, glm::mat3, glm::mat4
              * 
+             * La ubicación se busca por hash en la tabla construida al enlazar el
+             * programa, sin llamar a glGetUniformLocation. Se guarda una copia del
+             * último valor enviado y, si no cambia, no se llama a OpenGL. El valor
+             * se escribe con glProgramUniform, así que no hace falta llamar antes a use().
+             * 
              * @tparam T Tipo del valor uniforme (deducido automáticamente)
              * @param name Nombre de la variable uniforme en el shader
              * @param value Valor a asignar a la variable uniforme
              * 
              * @note Si la variable uniforme no existe, se muestra un error por consola
+             * solo la primera vez
              * 
              * @example
              * @code
@@ -106,7 +260,7 @@ namespace engine::graphics {
              * @endcode
              */
             template <typename T>
-            auto setUniform(const char* name, T value)
+            auto setUniform(const UniformName& name, T value)
                 -> std::enable_if_t<
                     std::is_same_v<T, bool> || 
                     std::is_same_v<T, int> ||
@@ -121,44 +275,61 @@ namespace engine::graphics {
                     void
                 > 
             {
-                GLint location = glGetUniformLocation(m_ID, name);
-                if (location == -1) {
-                    std::cerr << "ERROR::SHADER::UNIFORM_NOT_FOUND: " << name << std::endl;
+                UniformSlot* slot = findUniform(name);
+                if (slot == nullptr) {
                     return;
                 }
 
-                if constexpr (std::is_same_v<T, bool>) {
-                    glUniform1i(location, static_cast<int>(value));
-                }
-                else if constexpr (std::is_same_v<T, int>) {
-                    glUniform1i(location, value);
-                }
-                else if constexpr (std::is_same_v<T, float>) {
-                    glUniform1f(location, value);
-                }
-                else if constexpr (std::is_same_v<T, double>) {
-                    glUniform1d(location, value);
-                }
-                else if constexpr (std::is_same_v<T, glm::vec2>) {
-                    glUniform2f(location, value.x, value.y);
-                }
-                else if constexpr (std::is_same_v<T, glm::vec3>) {
-                    glUniform3f(location, value.x, value.y, value.z);
-                }
-                else if constexpr (std::is_same_v<T, glm::vec4>) {
-                    glUniform4f(location, value.x, value.y, value.z, value.w);
-                }
-                else if constexpr (std::is_same_v<T, glm::mat2>) {
-                    glUniformMatrix2fv(location, 1, GL_FALSE, glm::value_ptr(value));
-                }
-                else if constexpr (std::is_same_v<T, glm::mat3>) {
-                    glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
-                }
-                else if constexpr (std::is_same_v<T, glm::mat4>) {
-                    glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
+                if (slot->hasValue && slot->type == uniformType<T>() &&
+                    std::memcmp(slot->value, &value, sizeof(T)) == 0) {
+                    return;
                 }
+
+                std::memcpy(slot->value, &value, sizeof(T));
+                slot->hasValue = true;
+                slot->type = uniformType<T>();
+                slot->upload = &uploadUniform<T>;
+                uploadUniform<T>(m_ID, slot->location, &value);
             }
+
+            /**
+             * @brief Obtiene el número de variables uniformes activas del programa
+             * 
+             * @return size_t Uniforms con ubicación propia (los de bloques no cuentan),
+             * contando cada elemento de un array
+             */
+            size_t uniformCount() const;
+
+            /**
+             * @brief Asocia un bloque uniforme o de almacenamiento a un binding
+             * 
+             * Permite recibir un struct o un array de structs completo desde un
+             * BlockBuffer en lugar de establecer cada campo con setUniform.
+             * 
+             * @param name Nombre del bloque en GLSL (no el de su instancia)
+             * @param binding Binding del buffer (BlockBuffer::binding())
+             * 
+             * @example
+             * @code
+             * BlockBuffer<engine::core::Light> light(1);
+             * shader.bindBlock("Lights", light.binding());
+             * light.upload(sceneLight);
+             * @endcode
+             */
+            void bindBlock(const char* name, GLuint binding);
             
+            /**
+             * @brief Sustituye el programa por otro ya enlazado
+             * 
+             * El programa anterior se libera. Los valores enviados con setUniform
+             * y los bloques asociados con bindBlock se aplican al nuevo programa,
+             * de modo que quien use este Shader no nota el cambio salvo por el ID.
+             * Lo usa ShaderLibrary para la recarga en caliente, entre dos frames.
+             * 
+             * @param program Programa enlazado correctamente
+             */
+            void replaceProgram(GLuint program);
+
             /**
              * @brief Devuelve el identificador del Shader
              * 
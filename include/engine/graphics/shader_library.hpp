@@ -0,0 +1,323 @@
+/**
+ * @file shader_library.hpp
+ * @brief Compilación en lote y sin bloqueos de los programas de la aplicación
+ *
+ * Consultar GL_COMPILE_STATUS justo después de cada glCompileShader obliga al
+ * driver a terminar esa compilación antes de seguir, así que los programas
+ * se compilan uno detrás de otro. ShaderLibrary encola todas las etapas y
+ * todos los enlazados de golpe, activa GL_KHR_parallel_shader_compile cuando
+ * el driver lo ofrece y solo comprueba el resultado de cada programa la
+ * primera vez que se pide. Mientras tanto el hilo principal puede seguir
+ * dibujando una pantalla de carga y preguntar por el progreso sin esperar.
+ *
+ * Cada programa puede pedirse con distintas claves de permutación, y cada
+ * variante se compila la primera vez que se usa. Las etapas con el mismo
+ * código preprocesado se compilan una sola vez y se comparten entre
+ * programas. Cada variante tiene su propio programa aunque genere el mismo
+ * código que otra: una edición puede hacer que dejen de coincidir.
+ *
+ * Con watch() la biblioteca vigila cada archivo que ha leído, incluidos los
+ * #include, y update() recompila solo los programas afectados. El programa
+ * antiguo sigue en uso hasta que el nuevo enlaza; entonces se sustituye en
+ * el mismo Shader entre dos frames, y si falla se conserva el anterior.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef SHADER_LIBRARY_HPP
+#define SHADER_LIBRARY_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "engine/core/file_watcher.hpp"
+#include "engine/graphics/shader.hpp"
+#include "engine/graphics/shader_preprocessor.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct ShaderLibraryStats
+     * @brief Contadores de compilación desde que se creó la biblioteca
+     */
+    struct ShaderLibraryStats {
+        /** @brief Variantes pedidas con add() o get() */
+        size_t variants = 0;
+
+        /** @brief Programas restaurados desde ProgramCache sin compilar */
+        size_t cached = 0;
+
+        /** @brief Programas enviados al compilador */
+        size_t compiled = 0;
+
+        /** @brief Programas que no compilaron o no enlazaron */
+        size_t failed = 0;
+
+        /** @brief Etapas compiladas */
+        size_t stages = 0;
+
+        /** @brief Etapas reutilizadas de otro programa en lugar de compilarse */
+        size_t sharedStages = 0;
+
+        /** @brief Programas sustituidos por recarga en caliente */
+        size_t reloads = 0;
+
+        /** @brief Recargas descartadas porque el nuevo código no compiló o no enlazó */
+        size_t reloadFailures = 0;
+
+        /** @brief Hilos de compilación pedidos al driver (0 si no hay compilación paralela) */
+        GLuint compilerThreads = 0;
+    };
+
+    inline std::ostream& operator<<(std::ostream& os, const ShaderLibraryStats& stats)
+    {
+        os << "Variants: " << stats.variants << " | Programs: " << stats.cached
+           << " cached, " << stats.compiled << " compiled, " << stats.failed << " failed | Stages: " << stats.stages
+           << " compiled, " << stats.sharedStages << " shared | Reloads: " << stats.reloads << " ("
+           << stats.reloadFailures << " failed) | Compiler threads: ";
+        if (stats.compilerThreads == 0)
+            os << "unavailable";
+        else if (stats.compilerThreads == 0xFFFFFFFFu)
+            os << "all";
+        else
+            os << stats.compilerThreads;
+        return os;
+    }
+
+    /**
+     * @class ShaderLibrary
+     * @brief Conjunto de programas con nombre compilados en paralelo
+     *
+     * @example
+     * @code
+     * ShaderLibrary library;
+     * library.add("lighting", "shaders/lighting.vert", "shaders/lighting.frag", {"HAS_SPECULAR_MAP"});
+     * library.add("lightCube", "shaders/lighting.vert", "shaders/light_cube.frag");
+     * library.compileAll();   // lighting.vert se compila una sola vez
+     *
+     * while (!library.ready()) {
+     *     drawLoadingScreen(library.progress());
+     *     glfwSwapBuffers(window);
+     *     glfwPollEvents();
+     * }
+     *
+     * Shader& lighting = *library.get("lighting", {"HAS_SPECULAR_MAP"});
+     * Shader& gouraud = *library.get("lighting", {"GOURAUD"});   // se compila ahora
+     *
+     * library.watch();
+     * while (running) {
+     *     library.update();   // recarga lo que se haya guardado sin bloquear el frame
+     *     ...
+     * }
+     * @endcode
+     *
+     * @note Requiere un contexto OpenGL activo en el hilo que la usa. Sin la
+     * extensión, ready() no puede saber si el driver ha terminado y devuelve
+     * true; la espera se produce entonces en get()
+     */
+    class ShaderLibrary {
+        private:
+        enum class ProgramState {
+            Compiling,
+            Linked,
+            Failed
+        };
+
+        struct Stage {
+            GLuint shader = 0;
+            std::string path;
+            bool checked = false;
+        };
+
+        struct Reload {
+            GLuint program = 0;
+            Stage* vertex = nullptr;
+            Stage* fragment = nullptr;
+            uint64_t cacheKey = 0;
+            bool deferred = false;
+        };
+
+        struct Program {
+            std::string name;
+            std::string vertexPath;
+            std::string fragmentPath;
+            ShaderDefines defines;
+            std::vector<std::filesystem::path> files;
+            uint64_t cacheKey = 0;
+            Stage* vertex = nullptr;
+            Stage* fragment = nullptr;
+            GLuint program = 0;
+            ProgramState state = ProgramState::Compiling;
+            std::unique_ptr<Shader> shader;
+            Reload reload;
+        };
+
+        struct Variant {
+            ShaderDefines defines;
+            Program* program = nullptr;
+        };
+
+        struct Entry {
+            std::string name;
+            std::string vertexPath;
+            std::string fragmentPath;
+            std::vector<Variant> variants;
+        };
+
+        using MaxShaderCompilerThreadsProc = void (APIENTRYP)(GLuint count);
+
+        std::vector<std::unique_ptr<Entry>> m_entries;
+
+        /** @brief Etapas compiladas, indexadas por su código preprocesado */
+        std::unordered_map<std::string, std::unique_ptr<Stage>> m_vertexStages;
+        std::unordered_map<std::string, std::unique_ptr<Stage>> m_fragmentStages;
+
+        /** @brief Programa de cada variante pedida */
+        std::vector<std::unique_ptr<Program>> m_programs;
+
+        /** @brief Vigilancia de archivos para la recarga en caliente (nullptr si no está activa) */
+        std::unique_ptr<engine::core::FileWatcher> m_watcher;
+
+        MaxShaderCompilerThreadsProc m_maxShaderCompilerThreads;
+        bool m_parallelCompile;
+        ShaderLibraryStats m_stats;
+
+        Entry* find(const std::string& name) const;
+        Variant* findVariant(const std::string& name, const ShaderDefines& defines) const;
+        Variant& variant(Entry& entry, const ShaderDefines& defines);
+        Stage* stage(const ShaderSource& source, GLenum shaderType);
+        void queue(const Entry& entry, Variant& variant);
+        bool isComplete(const Variant& variant) const;
+        bool isLinkComplete(GLuint program) const;
+        void finish(Program& program);
+        void watchFiles(Program& program, const ShaderSource& vertex, const ShaderSource& fragment);
+        void startReload(Program& program);
+        void finishReload(Program& program);
+        void cancelReload(Program& program);
+        void releaseStage(Stage* stage);
+
+        public:
+        /**
+         * @brief Crea la biblioteca y carga GL_KHR_parallel_shader_compile si existe
+         *
+         * glad no incluye la extensión, así que su función se obtiene con el
+         * mismo cargador usado para gladLoadGLLoader.
+         *
+         * @param loader Cargador de funciones de OpenGL
+         */
+        explicit ShaderLibrary(GLADloadproc loader = reinterpret_cast<GLADloadproc>(glfwGetProcAddress));
+
+        /**
+         * @brief Destructor - libera las etapas y programas pendientes
+         *
+         * Los Shader entregados por get() dejan de ser válidos.
+         */
+        ~ShaderLibrary();
+
+        ShaderLibrary(const ShaderLibrary&) = delete;
+        ShaderLibrary& operator=(const ShaderLibrary&) = delete;
+
+        /**
+         * @brief Registra una variante de un programa para la próxima compileAll()
+         *
+         * Se puede llamar varias veces con el mismo nombre y las mismas rutas
+         * para registrar otras variantes.
+         *
+         * @param name Nombre con el que se pedirá a get()
+         * @param vertexPath Ruta al archivo del vertex shader
+         * @param fragmentPath Ruta al archivo del fragment shader
+         * @param defines Claves de permutación de la variante
+         */
+        void add(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+                 const ShaderDefines& defines = {});
+
+        /**
+         * @brief Envía al driver todas las variantes registradas sin esperar resultados
+         *
+         * Los programas que están en ProgramCache se restauran directamente.
+         *
+         * @param compilerThreads Hilos de compilación (0xFFFFFFFF = todos los que
+         * admita el driver); sin la extensión se ignora
+         */
+        void compileAll(GLuint compilerThreads = 0xFFFFFFFFu);
+
+        /**
+         * @brief Comprueba sin bloquear si una variante ha terminado de compilar
+         *
+         * @param name Nombre del programa
+         * @param defines Claves de permutación de la variante
+         * @return bool true si get() no tendrá que esperar al driver
+         */
+        bool isReady(const std::string& name, const ShaderDefines& defines = {}) const;
+
+        /**
+         * @brief Comprueba sin bloquear si todas las variantes registradas han terminado
+         *
+         * @return bool true si get() no tendrá que esperar por ninguna
+         */
+        bool ready() const;
+
+        /**
+         * @brief Fracción de variantes terminadas, para la pantalla de carga
+         *
+         * @return float Valor entre 0 y 1
+         */
+        float progress() const;
+
+        /**
+         * @brief Obtiene una variante, compilándola si nadie la había pedido
+         *
+         * Si el driver no ha terminado, espera a que lo haga. Los errores de
+         * compilación y enlazado se muestran la primera vez que se pide.
+         *
+         * @param name Nombre del programa
+         * @param defines Claves de permutación de la variante
+         * @return Shader* Programa (con ID 0 si falló), o nullptr si el nombre no está registrado
+         */
+        Shader* get(const std::string& name, const ShaderDefines& defines = {});
+
+        /**
+         * @brief Activa la recarga en caliente
+         *
+         * A partir de aquí se vigilan todos los archivos de los programas ya
+         * compilados y de los que se compilen después. Solo funciona en Linux.
+         */
+        void watch();
+
+        /**
+         * @brief Atiende la recarga en caliente; se llama una vez por frame
+         *
+         * Envía a compilar los programas cuyos archivos han cambiado y
+         * sustituye los que ya han terminado de enlazar. Con compilación
+         * paralela solo consulta su estado; sin ella el resultado se comprueba
+         * un frame después de enviarlo, cuando el driver suele haber terminado.
+         */
+        void update();
+
+        /**
+         * @brief Indica si la compilación paralela del driver está activa
+         *
+         * @return bool true si se cargó GL_KHR_parallel_shader_compile o GL_ARB_parallel_shader_compile
+         */
+        bool parallelCompile() const;
+
+        /**
+         * @brief Obtiene las estadísticas de compilación
+         *
+         * @return const ShaderLibraryStats& Variantes, programas y etapas compartidos o compilados
+         */
+        const ShaderLibraryStats& stats() const;
+    };
+}
+
+#endif // SHADER_LIBRARY_HPP
@@ -0,0 +1,94 @@
+/**
+ * @file shader_preprocessor.hpp
+ * @brief Preprocesador de GLSL: #include y claves de permutación
+ *
+ * GLSL no tiene #include, así que cada shader repetía el bloque de la cámara
+ * o la función de iluminación. ShaderPreprocessor expande los #include
+ * relativos al archivo que los contiene y coloca justo después de #version
+ * un #define por cada clave de permutación (HAS_SPECULAR_MAP, GOURAUD...),
+ * de modo que un mismo archivo produce todas sus variantes con #ifdef.
+ *
+ * Cada archivo insertado recibe un número de cadena fuente en las
+ * directivas #line, y ese número es su índice en ShaderSource::files: un
+ * error "2(14)" del driver está en la línea 14 de files[2].
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef SHADER_PREPROCESSOR_HPP
+#define SHADER_PREPROCESSOR_HPP
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace engine::graphics
+{
+    /**
+     * @brief Claves de permutación de un shader
+     *
+     * Cada elemento es "CLAVE" o "CLAVE=VALOR". El orden no importa: el
+     * preprocesador las ordena para que un mismo conjunto genere siempre el
+     * mismo código.
+     */
+    using ShaderDefines = std::vector<std::string>;
+
+    /**
+     * @struct ShaderSource
+     * @brief Código GLSL listo para compilar y archivos de los que depende
+     */
+    struct ShaderSource {
+        /** @brief Código con los #include expandidos y los #define insertados */
+        std::string code;
+
+        /** @brief Archivo principal seguido de cada #include, en orden de aparición */
+        std::vector<std::filesystem::path> files;
+
+        /** @brief false si algún archivo no se pudo leer o un #include es inválido */
+        bool valid = false;
+    };
+
+    /**
+     * @class ShaderPreprocessor
+     * @brief Expande #include e inserta #define antes de compilar GLSL
+     *
+     * @example
+     * @code
+     * // lighting.frag:
+     * //   #version 460 core
+     * //   #include "../include/camera.glsl"
+     * //   #ifdef HAS_SPECULAR_MAP ... #endif
+     * ShaderSource source = ShaderPreprocessor::load("shaders/lighting.frag", {"HAS_SPECULAR_MAP"});
+     * @endcode
+     *
+     * @note Cada archivo se inserta una sola vez por etapa, como si llevase
+     * #pragma once. Los #include se expanden siempre, también dentro de un
+     * #ifdef desactivado, porque las condiciones las evalúa el driver
+     */
+    class ShaderPreprocessor {
+        public:
+        ShaderPreprocessor() = delete;
+
+        /**
+         * @brief Lee un shader y lo preprocesa
+         *
+         * @param path Ruta al archivo principal de la etapa
+         * @param defines Claves de permutación a definir
+         * @return ShaderSource Código final y archivos leídos
+         */
+        static ShaderSource load(const std::filesystem::path& path, const ShaderDefines& defines = {});
+
+        /**
+         * @brief Ordena y elimina duplicados de un conjunto de claves
+         *
+         * @param defines Claves en cualquier orden
+         * @return ShaderDefines Forma canónica del conjunto
+         */
+        static ShaderDefines normalize(ShaderDefines defines);
+    };
+}
+
+#endif // SHADER_PREPROCESSOR_HPP
@@ -0,0 +1,197 @@
+/**
+ * @file stream_buffer.hpp
+ * @brief Clase StreamBuffer para subir datos dinámicos a la GPU sin copias
+ *
+ * Esta clase implementa un ring buffer mapeado de forma persistente
+ * (glNamedBufferStorage + GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT) dividido
+ * en particiones protegidas con glFenceSync. La CPU escribe directamente
+ * en la memoria mapeada mientras la GPU lee particiones anteriores.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef STREAM_BUFFER_HPP
+#define STREAM_BUFFER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <span>
+#include <vector>
+
+namespace engine::graphics
+{
+    /**
+     * @struct StreamAllocation
+     * @brief Región reservada dentro de la partición actual del StreamBuffer
+     *
+     * @tparam T Tipo de los elementos escritos en la región
+     */
+    template <typename T>
+    struct StreamAllocation {
+        /** @brief Memoria mapeada donde escribir los elementos */
+        std::span<T> data;
+
+        /** @brief Desplazamiento en bytes desde el inicio del buffer */
+        GLintptr offset = 0;
+
+        /** @brief Índice del primer elemento (offset / sizeof(T)), útil como baseVertex */
+        GLint first = 0;
+
+        /**
+         * @brief Verifica si la reserva tuvo éxito
+         *
+         * @return bool true si hay memoria reservada, false en caso contrario
+         */
+        bool isValid() const { return data.data() != nullptr; }
+    };
+
+    /**
+     * @class StreamBuffer
+     * @brief Ring buffer persistente y coherente para datos que cambian cada frame
+     *
+     * El buffer se divide en N particiones (3 por defecto). Cada frame el
+     * productor llama a beginFrame(), reserva memoria con allocate(), escribe
+     * directamente en ella, emite sus draws y llama a endFrame(), que coloca
+     * un fence sobre la partición. Antes de reutilizar una partición se espera
+     * su fence, de modo que la CPU nunca sobrescribe datos que la GPU aún lee
+     * y el driver nunca tiene que re-especificar el almacenamiento.
+     *
+     * @example
+     * @code
+     * StreamBuffer vertexStream(GL_ARRAY_BUFFER, 1 << 20);
+     *
+     * vertexStream.beginFrame();
+     * auto vertices = vertexStream.allocate<Vertex>(count);
+     * std::copy(points.begin(), points.end(), vertices.data.begin());
+     * mesh.setStreamRange(vertices.first, count);
+     * mesh.draw(shader);
+     * vertexStream.endFrame();
+     * @endcode
+     *
+     * @note La clase no es copiable para evitar problemas de gestión de recursos GPU
+     */
+    class StreamBuffer
+    {
+    private:
+        /** @brief Identificador del buffer en OpenGL */
+        GLuint m_ID;
+
+        /** @brief Target con el que se creó el buffer (GL_ARRAY_BUFFER, ...) */
+        GLenum m_target;
+
+        /** @brief Tamaño en bytes de cada partición */
+        GLsizeiptr m_partitionSize;
+
+        /** @brief Número de particiones del ring buffer */
+        GLuint m_partitionCount;
+
+        /** @brief Partición en la que se escribe el frame actual */
+        GLuint m_currentPartition;
+
+        /** @brief Bytes ocupados de la partición actual */
+        GLsizeiptr m_partitionUsed;
+
+        /** @brief Puntero al inicio del buffer mapeado */
+        unsigned char* m_mapped;
+
+        /** @brief Fence de cada partición (nullptr si está libre) */
+        std::vector<GLsync> m_fences;
+
+        /**
+         * @brief Reserva bytes alineados dentro de la partición actual
+         *
+         * @param bytes Número de bytes a reservar
+         * @param alignment Alineación del desplazamiento absoluto en bytes
+         * @return GLintptr Desplazamiento absoluto, o -1 si no hay espacio
+         */
+        GLintptr allocateBytes(GLsizeiptr bytes, GLsizeiptr alignment);
+
+    public:
+        /**
+         * @brief Constructor que crea y mapea el buffer persistente
+         *
+         * @param target Target del buffer (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, ...)
+         * @param partitionSize Tamaño en bytes de cada partición
+         * @param partitionCount Número de particiones (3 para triple buffering)
+         */
+        StreamBuffer(GLenum target, GLsizeiptr partitionSize, GLuint partitionCount = 3);
+
+        /**
+         * @brief Destructor - desmapea y libera el buffer y sus fences
+         */
+        ~StreamBuffer();
+
+        StreamBuffer(const StreamBuffer&) = delete;
+        StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+        /**
+         * @brief Avanza a la siguiente partición y espera a que la GPU la libere
+         *
+         * Debe llamarse una vez por frame antes de cualquier allocate().
+         */
+        void beginFrame();
+
+        /**
+         * @brief Coloca un fence sobre la partición escrita en este frame
+         *
+         * Debe llamarse después de emitir todos los draws que leen la partición.
+         */
+        void endFrame();
+
+        /**
+         * @brief Reserva espacio para count elementos de tipo T
+         *
+         * El desplazamiento se alinea a sizeof(T), de modo que first
+         * puede usarse directamente como baseVertex o primer índice.
+         *
+         * @tparam T Tipo de los elementos
+         * @param count Número de elementos
+         * @return StreamAllocation<T> Región reservada; inválida si no hay espacio
+         */
+        template <typename T>
+        StreamAllocation<T> allocate(size_t count)
+        {
+            StreamAllocation<T> allocation;
+            GLintptr offset = allocateBytes(count * sizeof(T), sizeof(T));
+            if (offset < 0)
+                return allocation;
+
+            allocation.data = std::span<T>(reinterpret_cast<T*>(m_mapped + offset), count);
+            allocation.offset = offset;
+            allocation.first = static_cast<GLint>(offset / sizeof(T));
+            return allocation;
+        }
+
+        /**
+         * @brief Obtiene el identificador del buffer en OpenGL
+         *
+         * @return GLuint Identificador del buffer
+         */
+        GLuint ID() const;
+
+        /**
+         * @brief Obtiene el target con el que se creó el buffer
+         *
+         * @return GLenum Target del buffer
+         */
+        GLenum target() const;
+
+        /**
+         * @brief Obtiene el tamaño de cada partición
+         *
+         * @return GLsizeiptr Tamaño en bytes
+         */
+        GLsizeiptr partitionSize() const;
+
+        /**
+         * @brief Obtiene los bytes libres en la partición actual
+         *
+         * @return GLsizeiptr Bytes disponibles para allocate()
+         */
+        GLsizeiptr available() const;
+    };
+}
+
+#endif // STREAM_BUFFER_HPP
@@ -83,6 +83,18 @@ namespace engine::graphics {
          * @default GL_LINEAR
          */
         GLenum magFilter = GL_LINEAR;
+
+        /** 
+         * @brief Invierte la imagen verticalmente al cargarla
+         * 
+         * OpenGL sitúa el origen de las coordenadas de textura abajo a la izquierda,
+         * mientras que las imágenes se guardan empezando por la fila superior.
+         * Los formatos con origen arriba a la izquierda (p. ej. glTF) deben
+         * desactivarlo para usar sus coordenadas sin modificar.
+         * 
+         * @default true
+         */
+        bool flipVertically = true;
     };
 
     /**
@@ -109,6 +121,14 @@ namespace engine::graphics {
         /** @brief Ruta de la textura */
         std::string m_path;
 
+        /**
+         * @brief Crea la textura en OpenGL a partir de píxeles ya decodificados
+         * 
+         * @param data Píxeles devueltos por stb_image (nullptr si falló la decodificación)
+         * @param params Parámetros de wrapping y filtrado
+         */
+        void create(unsigned char* data, const TextureParams& params);
+
     public:
         /**
          * @brief Constructor que carga y configura una textura desde archivo
@@ -139,6 +159,19 @@ namespace engine::graphics {
          */
         Texture(const char* path, const TextureParams& params = TextureParams());
 
+        /**
+         * @brief Constructor que decodifica una imagen ya cargada en memoria
+         * 
+         * Útil para imágenes embebidas en otros archivos (p. ej. en un GLB).
+         * 
+         * @param encoded Bytes de la imagen codificada (PNG, JPG, ...)
+         * @param size Tamaño en bytes
+         * @param params Estructura con los parámetros de configuración de la textura
+         * @param name Nombre descriptivo devuelto por path()
+         */
+        Texture(const unsigned char* encoded, size_t size,
+                const TextureParams& params = TextureParams(), const char* name = "");
+
         /**
          * @brief Constructor de copia eliminado
          * 
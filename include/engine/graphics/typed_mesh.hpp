@@ -0,0 +1,188 @@
+/**
+ * @file typed_mesh.hpp
+ * @brief Clase TypedMesh para mallas con layout de vértice en tiempo de compilación
+ *
+ * Variante de Mesh parametrizada por un engine::core::VertexLayout. Solo se
+ * suben a la GPU los atributos declarados en el layout; el stride y los
+ * offsets se derivan en tiempo de compilación y se entregan a Mesh como un
+ * MeshGpuLayout, así que los buffers, el VAO, los índices de 16 bits, la
+ * caja envolvente y el movimiento son los de Mesh.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef TYPED_MESH_HPP
+#define TYPED_MESH_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <limits>
+#include <vector>
+#include <glm/glm.hpp>
+#include "engine/core/vertex_layout.hpp"
+#include "engine/graphics/mesh.hpp"
+#include "engine/graphics/shader.hpp"
+#include "engine/graphics/texture.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @class TypedMesh
+     * @brief Malla cuyo formato de vértice está fijado por un VertexLayout
+     *
+     * Útil para pasadas que leen pocos atributos (depth pre-pass, sombras,
+     * proxies de luces): un layout con solo posición ocupa 12 bytes por
+     * vértice frente a los 48 de engine::core::Vertex.
+     *
+     * @tparam Layout engine::core::VertexLayout con los atributos de la malla,
+     * declarados en el orden de Mesh (posición, color, coordenadas de textura, normal)
+     *
+     * @example
+     * @code
+     * using namespace engine::core;
+     * using LightLayout = VertexLayout<attribute::Position>;
+     * TypedMesh<LightLayout> lightMesh(convertVertices<LightLayout>(cube.vertexs), cube.indexs, {});
+     * lightMesh.draw(lightCube);
+     * @endcode
+     *
+     * @note La clase no es copiable pero sí movible, igual que Mesh
+     */
+    template <typename Layout>
+    class TypedMesh
+    {
+    public:
+        /** @brief Tipo de vértice que acepta la malla */
+        using vertex_type = typename Layout::vertex_type;
+
+        static_assert(sizeof(vertex_type) == Layout::stride,
+                      "TypedVertex must be tightly packed to match its layout stride");
+        static_assert(Layout::meshOrder,
+                      "TypedMesh layouts must declare attributes in Mesh order: Position, Color, TexCoords, Normal");
+
+    private:
+        /** @brief Malla que posee los buffers y el VAO */
+        Mesh m_mesh;
+
+        static Mesh upload(const std::vector<vertex_type>& vertexs,
+                           const std::vector<GLuint>& indexs,
+                           const std::vector<engine::graphics::Texture*>& textures)
+        {
+            MeshGpuLayout layout;
+            layout.attributes = static_cast<VertexAttributes>(Layout::attributeMask);
+            layout.vertexStride = Layout::stride;
+            Layout::slotOffsets(layout.attributeOffsets);
+            layout.vertexCount = static_cast<GLsizei>(vertexs.size());
+            layout.indexCount = static_cast<GLsizei>(indexs.size());
+
+            if constexpr (Layout::template has<engine::core::attribute::Position>) {
+                if (!vertexs.empty()) {
+                    layout.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+                    layout.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+                    for (const vertex_type& vertex : vertexs) {
+                        glm::vec3 position = vertex.template get<engine::core::attribute::Position>();
+                        layout.boundsMin = glm::min(layout.boundsMin, position);
+                        layout.boundsMax = glm::max(layout.boundsMax, position);
+                    }
+                }
+            }
+
+            // Igual que Mesh: con menos de 65536 vértices los índices caben en 16 bits
+            if (vertexs.size() < 65536) {
+                std::vector<GLushort> shortIndexs(indexs.begin(), indexs.end());
+                layout.indexType = GL_UNSIGNED_SHORT;
+                return Mesh(layout, vertexs.data(), shortIndexs.data(), textures);
+            }
+
+            layout.indexType = GL_UNSIGNED_INT;
+            return Mesh(layout, vertexs.data(), indexs.data(), textures);
+        }
+
+    public:
+        /**
+         * @brief Constructor que sube la geometría compacta a la GPU
+         *
+         * @param vertexs Vértices con exactamente los atributos del layout
+         * @param indexs Vector de índices para renderizado indexado (vacío para glDrawArrays)
+         * @param textures Vector de texturas a aplicar a la malla
+         */
+        TypedMesh(const std::vector<vertex_type>& vertexs,
+                  const std::vector<GLuint>& indexs,
+                  const std::vector<engine::graphics::Texture*>& textures)
+            : m_mesh(upload(vertexs, indexs, textures))
+        {
+        }
+
+        TypedMesh(const TypedMesh&) = delete;
+        TypedMesh& operator=(const TypedMesh&) = delete;
+        TypedMesh(TypedMesh&&) noexcept = default;
+        TypedMesh& operator=(TypedMesh&&) noexcept = default;
+
+        /**
+         * @brief Renderiza la malla usando el shader especificado
+         *
+         * @param shader Shader a utilizar para el renderizado
+         */
+        void draw(const engine::graphics::Shader& shader) { m_mesh.draw(shader); }
+
+        /**
+         * @brief Obtiene la malla subyacente (dibujado instanciado, rangos, estadísticas)
+         *
+         * @return Mesh& Malla con los buffers de la GPU
+         */
+        Mesh& mesh() { return m_mesh; }
+        const Mesh& mesh() const { return m_mesh; }
+
+        /**
+         * @brief Obtiene el ID del Vertex Array Object
+         *
+         * @return GLuint Identificador del VAO en OpenGL
+         */
+        GLuint VAO() const { return m_mesh.VAO(); }
+
+        /**
+         * @brief Obtiene el número de vértices en la malla
+         *
+         * @return size_t Cantidad de vértices
+         */
+        size_t vertexCount() const { return m_mesh.vertexCount(); }
+
+        /**
+         * @brief Obtiene el número de índices en la malla
+         *
+         * @return size_t Cantidad de índices
+         */
+        size_t indexCount() const { return m_mesh.indexCount(); }
+
+        /**
+         * @brief Obtiene el tipo de los índices en la GPU
+         *
+         * @return GLenum GL_UNSIGNED_SHORT o GL_UNSIGNED_INT
+         */
+        GLenum indexType() const { return m_mesh.indexType(); }
+
+        /**
+         * @brief Obtiene la esquina mínima de la caja envolvente
+         *
+         * @return glm::vec3 Infinita si el layout no tiene posición
+         */
+        glm::vec3 boundsMin() const { return m_mesh.boundsMin(); }
+
+        /**
+         * @brief Obtiene la esquina máxima de la caja envolvente
+         *
+         * @return glm::vec3 Infinita si el layout no tiene posición
+         */
+        glm::vec3 boundsMax() const { return m_mesh.boundsMax(); }
+
+        /**
+         * @brief Obtiene el tamaño en bytes de cada vértice en la GPU
+         *
+         * @return size_t Stride del layout
+         */
+        static constexpr size_t vertexSize() { return Layout::stride; }
+    };
+}
+
+#endif // TYPED_MESH_HPP
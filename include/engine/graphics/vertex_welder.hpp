@@ -0,0 +1,90 @@
+/**
+ * @file vertex_welder.hpp
+ * @brief Soldadura de vértices para convertir sopas de triángulos en mallas indexadas
+ *
+ * Deduplica vértices idénticos (bit a bit o dentro de una tolerancia) con
+ * tablas hash repartidas entre hilos y genera un arreglo compacto de
+ * vértices más su buffer de índices.
+ *
+ * @author [Francisco Aparicio Martínez]
+ * @version 1.0
+ */
+
+#ifndef VERTEX_WELDER_HPP
+#define VERTEX_WELDER_HPP
+
+#pragma once
+
+#include <glad/glad.h>
+#include <vector>
+#include "engine/core/vertex.hpp"
+
+namespace engine::graphics
+{
+    /**
+     * @struct VertexWeldParams
+     * @brief Parámetros de configuración de VertexWelder::weld
+     */
+    struct VertexWeldParams {
+        /**
+         * @brief Tolerancia de soldadura
+         *
+         * Con 0 solo se unen vértices idénticos bit a bit. Con un valor positivo
+         * cada componente se cuantiza a una rejilla de ese tamaño y se unen los
+         * vértices que caen en la misma celda (el primero de ellos se conserva).
+         *
+         * @note Es una soldadura cuantizada, no por distancia: dos vértices a
+         * menos de epsilon que quedan a ambos lados del borde de una celda no
+         * se unen, y dos de la misma celda pueden diferir hasta epsilon en
+         * cada componente. Mirar las celdas vecinas supondría 3^12 consultas
+         * por vértice, una por combinación de las 12 componentes de Vertex
+         *
+         * @default 0.0f
+         */
+        float epsilon = 0.0f;
+
+        /**
+         * @brief Número de hilos a usar (0 = hardware_concurrency)
+         *
+         * Las entradas pequeñas se procesan siempre en un solo hilo.
+         *
+         * @default 0
+         */
+        unsigned threadCount = 0;
+    };
+
+    /**
+     * @class VertexWelder
+     * @brief Convierte vértices sin indexar en vértices únicos más índices
+     *
+     * El trabajo se reparte por hash: cada hilo es dueño de los vértices cuyo
+     * hash cae en su partición y los inserta en su propia tabla, por lo que
+     * no hay bloqueos. El orden de los vértices únicos es el de su primera
+     * aparición, así que el resultado es determinista e independiente del
+     * número de hilos.
+     *
+     * @example
+     * @code
+     * std::vector<engine::core::Vertex> soup = generateTriangles();
+     * std::vector<GLuint> indices = VertexWelder::weld(soup);
+     * Mesh mesh(soup, indices, textures, attributes);
+     * @endcode
+     */
+    class VertexWelder
+    {
+    public:
+        VertexWelder() = delete;
+
+        /**
+         * @brief Suelda los vértices duplicados
+         *
+         * @param vertexs Vértices sin indexar; se reemplazan por los vértices únicos
+         * @param params Parámetros de soldadura
+         * @return std::vector<GLuint> Un índice por vértice de entrada
+         */
+        static std::vector<GLuint> weld(std::vector<engine::core::Vertex>& vertexs,
+                                        const VertexWeldParams& params = VertexWeldParams());
+    };
+}
+
+#endif // VERTEX_WELDER_HPP
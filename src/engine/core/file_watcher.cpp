@@ -0,0 +1,123 @@
+#include "engine/core/file_watcher.hpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <system_error>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+using namespace engine::core;
+
+std::filesystem::path FileWatcher::normalize(const std::filesystem::path& file)
+{
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(file, error);
+    return (error ? file : absolute).lexically_normal();
+}
+
+bool FileWatcher::isActive() const
+{
+    return m_descriptor >= 0;
+}
+
+#ifdef __linux__
+
+FileWatcher::FileWatcher()
+    : m_descriptor(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+{
+    if (m_descriptor < 0) {
+        std::cerr << "ERROR::FILE_WATCHER::INIT_FAILED: " << std::strerror(errno) << std::endl;
+    }
+}
+
+FileWatcher::~FileWatcher()
+{
+    if (m_descriptor >= 0)
+        close(m_descriptor);
+}
+
+bool FileWatcher::watch(const std::filesystem::path& file)
+{
+    if (m_descriptor < 0)
+        return false;
+
+    const std::filesystem::path path = normalize(file);
+    const std::filesystem::path directory = path.parent_path();
+    if (m_watchedDirectories.count(directory.string()) == 0) {
+        // IN_CLOSE_WRITE cubre la escritura en el sitio; IN_MOVED_TO, el guardado por renombrado
+        int watch = inotify_add_watch(m_descriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+        if (watch < 0) {
+            std::cerr << "ERROR::FILE_WATCHER::WATCH_FAILED: " << directory.string()
+                      << " (" << std::strerror(errno) << ")" << std::endl;
+            return false;
+        }
+
+        m_directories[watch] = directory;
+        m_watchedDirectories.insert(directory.string());
+    }
+
+    m_files.insert(path.string());
+    return true;
+}
+
+const std::vector<std::filesystem::path>& FileWatcher::poll()
+{
+    m_changed.clear();
+    if (m_descriptor < 0)
+        return m_changed;
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(m_descriptor, buffer, sizeof(buffer))) > 0) {
+        for (char* cursor = buffer; cursor < buffer + length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(cursor);
+            cursor += sizeof(inotify_event) + event->len;
+
+            // Si la cola del kernel se desborda se pierden eventos: se dan todos por modificados
+            if (event->mask & IN_Q_OVERFLOW) {
+                m_changed.clear();
+                for (const std::string& file : m_files)
+                    m_changed.emplace_back(file);
+                continue;
+            }
+
+            auto directory = m_directories.find(event->wd);
+            if (directory == m_directories.end() || event->len == 0)
+                continue;
+
+            std::filesystem::path path = directory->second / event->name;
+            if (m_files.count(path.string()) != 0 &&
+                std::find(m_changed.begin(), m_changed.end(), path) == m_changed.end())
+                m_changed.push_back(std::move(path));
+        }
+    }
+
+    return m_changed;
+}
+
+#else
+
+FileWatcher::FileWatcher()
+    : m_descriptor(-1)
+{
+}
+
+FileWatcher::~FileWatcher()
+{
+}
+
+bool FileWatcher::watch(const std::filesystem::path&)
+{
+    return false;
+}
+
+const std::vector<std::filesystem::path>& FileWatcher::poll()
+{
+    return m_changed;
+}
+
+#endif
@@ -0,0 +1,136 @@
+#include "engine/core/mapped_file.hpp"
+#include <iostream>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace engine::core;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const char* path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_open(false)
+    , m_file(INVALID_HANDLE_VALUE)
+    , m_mapping(nullptr)
+{
+    m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                         OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (m_file == INVALID_HANDLE_VALUE) {
+        std::cerr << "ERROR::MAPPED_FILE::OPEN_FAILED: " << path << std::endl;
+        return;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_file, &size)) {
+        std::cerr << "ERROR::MAPPED_FILE::SIZE_FAILED: " << path << std::endl;
+        return;
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+    m_open = true;
+
+    // No se puede proyectar un archivo vacío
+    if (m_size == 0)
+        return;
+
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping != nullptr)
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+
+    if (m_data == nullptr) {
+        std::cerr << "ERROR::MAPPED_FILE::MAP_FAILED: " << path << std::endl;
+        m_open = false;
+        m_size = 0;
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data != nullptr)
+        UnmapViewOfFile(m_data);
+    if (m_mapping != nullptr)
+        CloseHandle(m_mapping);
+    if (m_file != INVALID_HANDLE_VALUE)
+        CloseHandle(m_file);
+}
+
+#else
+
+MappedFile::MappedFile(const char* path)
+    : m_data(nullptr)
+    , m_size(0)
+    , m_open(false)
+    , m_descriptor(-1)
+{
+    m_descriptor = ::open(path, O_RDONLY);
+    if (m_descriptor < 0) {
+        std::cerr << "ERROR::MAPPED_FILE::OPEN_FAILED: " << path << std::endl;
+        return;
+    }
+
+    struct stat status;
+    if (::fstat(m_descriptor, &status) != 0) {
+        std::cerr << "ERROR::MAPPED_FILE::SIZE_FAILED: " << path << std::endl;
+        return;
+    }
+    m_size = static_cast<size_t>(status.st_size);
+    m_open = true;
+
+    // No se puede proyectar un archivo vacío
+    if (m_size == 0)
+        return;
+
+    void* mapping = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_descriptor, 0);
+    if (mapping == MAP_FAILED) {
+        std::cerr << "ERROR::MAPPED_FILE::MAP_FAILED: " << path << std::endl;
+        m_open = false;
+        m_size = 0;
+        return;
+    }
+
+    ::madvise(mapping, m_size, MADV_SEQUENTIAL);
+    m_data = static_cast<const char*>(mapping);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_data != nullptr)
+        ::munmap(const_cast<char*>(m_data), m_size);
+    if (m_descriptor >= 0)
+        ::close(m_descriptor);
+}
+
+#endif
+
+bool MappedFile::isOpen() const
+{
+    return m_open;
+}
+
+const char* MappedFile::data() const
+{
+    return m_data;
+}
+
+size_t MappedFile::size() const
+{
+    return m_size;
+}
+
+std::string_view MappedFile::view() const
+{
+    return std::string_view(m_data, m_size);
+}
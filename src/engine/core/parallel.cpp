@@ -0,0 +1,85 @@
+#include "engine/core/parallel.hpp"
+
+using namespace engine::core;
+
+WorkerPool::WorkerPool(unsigned threadCount)
+    : m_function(nullptr)
+    , m_count(0)
+    , m_next(0)
+    , m_busy(0)
+    , m_generation(0)
+    , m_stop(false)
+{
+    const unsigned total = resolveThreadCount(threadCount);
+    m_threads.reserve(total - 1);
+    for (unsigned t = 1; t < total; ++t)
+        m_threads.emplace_back(&WorkerPool::workerLoop, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_start.notify_all();
+    for (std::thread& thread : m_threads)
+        thread.join();
+}
+
+unsigned WorkerPool::threadCount() const
+{
+    return static_cast<unsigned>(m_threads.size()) + 1;
+}
+
+void WorkerPool::run(size_t count, const std::function<void(size_t)>& function)
+{
+    if (m_threads.empty() || count <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            function(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_function = &function;
+        m_count = count;
+        m_next = 0;
+        m_busy = m_threads.size();
+        ++m_generation;
+    }
+    m_start.notify_all();
+
+    work();
+
+    // Todos los hilos pasan por cada trabajo, aunque no quede nada que hacer,
+    // para que ninguno lea m_function después de que run() haya vuelto
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this]() { return m_busy == 0; });
+    m_function = nullptr;
+}
+
+void WorkerPool::work()
+{
+    for (size_t i = m_next++; i < m_count; i = m_next++)
+        (*m_function)(i);
+}
+
+void WorkerPool::workerLoop()
+{
+    uint64_t generation = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_start.wait(lock, [&]() { return m_stop || m_generation != generation; });
+        if (m_stop)
+            return;
+
+        generation = m_generation;
+        lock.unlock();
+        work();
+        lock.lock();
+
+        if (--m_busy == 0)
+            m_done.notify_one();
+    }
+}
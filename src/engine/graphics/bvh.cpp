@@ -0,0 +1,640 @@
+#include "engine/graphics/bvh.hpp"
+#include "engine/core/parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    /** Primitivas por tarea al repartir trabajo plano entre hilos */
+    constexpr size_t CHUNK_SIZE = 16384;
+
+    /** Tamaño mínimo de un subárbol para construirlo en otro hilo */
+    constexpr GLuint PARALLEL_SUBTREE_SIZE = 8192;
+
+    /** Máximo de cubetas por eje */
+    constexpr GLuint MAX_BINS = 32;
+
+    /** Profundidad a partir de la que se divide por la mitad sin SAH, para acotar la pila */
+    constexpr GLuint MEDIAN_SPLIT_DEPTH = 48;
+
+    /** Tamaño de la pila de recorrido: MEDIAN_SPLIT_DEPTH + 32 niveles de divisiones por la mitad */
+    constexpr size_t STACK_SIZE = 96;
+
+    /** Coste de atravesar un nodo relativo al de probar una primitiva */
+    constexpr float TRAVERSAL_COST = 1.0f;
+
+    float halfArea(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+    {
+        glm::vec3 extent = boundsMax - boundsMin;
+        return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+    }
+
+    struct Bin {
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+        GLuint count;
+    };
+
+    /** Caja de una primitiva junto a su índice, para particionar sin accesos indirectos */
+    struct PrimitiveRef {
+        glm::vec3 boundsMin;
+        GLuint index;
+        glm::vec3 boundsMax;
+
+        glm::vec3 centroid() const
+        {
+            return 0.5f * (boundsMin + boundsMax);
+        }
+    };
+
+    /**
+     * Estado compartido de la construcción. Cada subárbol trabaja sobre un
+     * rango disjunto de primitives y reserva sus nodos con un contador
+     * atómico, así que varios hilos pueden dividir nodos a la vez sin bloqueos.
+     */
+    struct BuildContext {
+        std::vector<PrimitiveRef> primitives;
+        BvhNode* nodes;
+        std::atomic<GLuint> nodeCount;
+        std::atomic<int> spareThreads;
+        GLuint maxLeafSize;
+        GLuint binCount;
+    };
+
+    GLuint binOf(float centroid, float centroidMin, float scale, GLuint binCount)
+    {
+        return std::min(binCount - 1, static_cast<GLuint>(std::max(0.0f, (centroid - centroidMin) * scale)));
+    }
+
+    void subdivide(BuildContext& context, GLuint nodeIndex, GLuint depth)
+    {
+        BvhNode& node = context.nodes[nodeIndex];
+        const GLuint first = node.leftFirst;
+        const GLuint count = node.count;
+
+        node.boundsMin = glm::vec3(FLT_MAX);
+        node.boundsMax = glm::vec3(-FLT_MAX);
+        glm::vec3 centroidMin(FLT_MAX);
+        glm::vec3 centroidMax(-FLT_MAX);
+        for (GLuint i = first; i < first + count; ++i) {
+            const PrimitiveRef& primitive = context.primitives[i];
+            node.boundsMin = glm::min(node.boundsMin, primitive.boundsMin);
+            node.boundsMax = glm::max(node.boundsMax, primitive.boundsMax);
+            centroidMin = glm::min(centroidMin, primitive.centroid());
+            centroidMax = glm::max(centroidMax, primitive.centroid());
+        }
+
+        if (count <= 1)
+            return;
+
+        // Mejor plano de corte entre cubetas para los tres ejes. Con pocas
+        // primitivas basta con una cubeta por primitiva y el barrido es más corto
+        const GLuint binCount = std::min(context.binCount, std::max(2u, count));
+        const float nodeArea = halfArea(node.boundsMin, node.boundsMax);
+        float bestCost = FLT_MAX;
+        int bestAxis = -1;
+        GLuint bestSplit = 0;
+        glm::vec3 scale(0.0f);
+
+        if (depth < MEDIAN_SPLIT_DEPTH) {
+            Bin bins[3][MAX_BINS];
+            for (int axis = 0; axis < 3; ++axis) {
+                float extent = centroidMax[axis] - centroidMin[axis];
+                scale[axis] = extent > 0.0f ? binCount / extent : 0.0f;
+                for (GLuint b = 0; b < binCount; ++b)
+                    bins[axis][b] = Bin{ glm::vec3(FLT_MAX), glm::vec3(-FLT_MAX), 0 };
+            }
+
+            for (GLuint i = first; i < first + count; ++i) {
+                const PrimitiveRef& primitive = context.primitives[i];
+                const glm::vec3 centroid = primitive.centroid();
+                for (int axis = 0; axis < 3; ++axis) {
+                    if (scale[axis] == 0.0f)
+                        continue;
+                    Bin& bin = bins[axis][binOf(centroid[axis], centroidMin[axis], scale[axis], binCount)];
+                    bin.boundsMin = glm::min(bin.boundsMin, primitive.boundsMin);
+                    bin.boundsMax = glm::max(bin.boundsMax, primitive.boundsMax);
+                    ++bin.count;
+                }
+            }
+
+            for (int axis = 0; axis < 3; ++axis) {
+                if (scale[axis] == 0.0f)
+                    continue;
+
+                // Barrido de izquierda a derecha y de derecha a izquierda acumulando cajas
+                std::array<float, MAX_BINS> leftCost;
+                glm::vec3 sweepMin(FLT_MAX), sweepMax(-FLT_MAX);
+                GLuint sweepCount = 0;
+                for (GLuint b = 0; b + 1 < binCount; ++b) {
+                    const Bin& bin = bins[axis][b];
+                    sweepCount += bin.count;
+                    if (bin.count > 0) {
+                        sweepMin = glm::min(sweepMin, bin.boundsMin);
+                        sweepMax = glm::max(sweepMax, bin.boundsMax);
+                    }
+                    leftCost[b] = sweepCount > 0 ? sweepCount * halfArea(sweepMin, sweepMax) : 0.0f;
+                }
+
+                sweepMin = glm::vec3(FLT_MAX);
+                sweepMax = glm::vec3(-FLT_MAX);
+                sweepCount = 0;
+                for (GLuint b = binCount - 1; b > 0; --b) {
+                    const Bin& bin = bins[axis][b];
+                    sweepCount += bin.count;
+                    if (bin.count > 0) {
+                        sweepMin = glm::min(sweepMin, bin.boundsMin);
+                        sweepMax = glm::max(sweepMax, bin.boundsMax);
+                    }
+                    if (sweepCount == 0 || sweepCount == count)
+                        continue;
+                    float cost = leftCost[b - 1] + sweepCount * halfArea(sweepMin, sweepMax);
+                    if (cost < bestCost) {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestSplit = b;
+                    }
+                }
+            }
+        }
+
+        // Dividir solo si sale más barato que probar todas las primitivas de la hoja
+        const float leafCost = static_cast<float>(count) * nodeArea;
+        const float splitCost = TRAVERSAL_COST * nodeArea + bestCost;
+        if (count <= context.maxLeafSize && (bestAxis < 0 || splitCost >= leafCost))
+            return;
+
+        GLuint leftCount;
+        if (bestAxis >= 0) {
+            auto begin = context.primitives.begin() + first;
+            auto middle = std::partition(begin, begin + count, [&](const PrimitiveRef& primitive) {
+                return binOf(primitive.centroid()[bestAxis], centroidMin[bestAxis], scale[bestAxis], binCount) < bestSplit;
+            });
+            leftCount = static_cast<GLuint>(middle - begin);
+        } else {
+            // Todos los centroides coinciden (o el árbol es demasiado profundo): mitad por índice
+            leftCount = count / 2;
+        }
+
+        const GLuint leftChild = context.nodeCount.fetch_add(2);
+        context.nodes[leftChild].leftFirst = first;
+        context.nodes[leftChild].count = leftCount;
+        context.nodes[leftChild + 1].leftFirst = first + leftCount;
+        context.nodes[leftChild + 1].count = count - leftCount;
+        node.leftFirst = leftChild;
+        node.count = 0;
+
+        const GLuint smallest = std::min(leftCount, count - leftCount);
+        if (smallest >= PARALLEL_SUBTREE_SIZE && context.spareThreads.fetch_sub(1) > 0) {
+            std::thread worker([&context, leftChild, depth]() {
+                subdivide(context, leftChild, depth + 1);
+                context.spareThreads.fetch_add(1);
+            });
+            subdivide(context, leftChild + 1, depth + 1);
+            worker.join();
+            return;
+        }
+        if (smallest >= PARALLEL_SUBTREE_SIZE)
+            context.spareThreads.fetch_add(1);
+
+        subdivide(context, leftChild, depth + 1);
+        subdivide(context, leftChild + 1, depth + 1);
+    }
+
+    /** Distancia de entrada del rayo en la caja, o FLT_MAX si no la corta antes de maxDistance */
+    inline float slab(const glm::vec3& origin, const glm::vec3& inverseDirection,
+                      const glm::vec3& boundsMin, const glm::vec3& boundsMax, float maxDistance)
+    {
+        glm::vec3 t0 = (boundsMin - origin) * inverseDirection;
+        glm::vec3 t1 = (boundsMax - origin) * inverseDirection;
+        glm::vec3 tNear = glm::min(t0, t1);
+        glm::vec3 tFar = glm::max(t0, t1);
+        float enter = std::max(std::max(tNear.x, tNear.y), std::max(tNear.z, 0.0f));
+        float exit = std::min(std::min(tFar.x, tFar.y), std::min(tFar.z, maxDistance));
+        return enter <= exit ? enter : FLT_MAX;
+    }
+
+    /** Distancia de la esquina más avanzada (o más retrasada) de la caja al plano p */
+    inline float planeDistance(const Frustum& frustum, int p, const glm::vec3& boundsMin, const glm::vec3& boundsMax, bool positive)
+    {
+        return frustum.x[p] * ((frustum.x[p] >= 0.0f) == positive ? boundsMax.x : boundsMin.x)
+             + frustum.y[p] * ((frustum.y[p] >= 0.0f) == positive ? boundsMax.y : boundsMin.y)
+             + frustum.z[p] * ((frustum.z[p] >= 0.0f) == positive ? boundsMax.z : boundsMin.z) + frustum.w[p];
+    }
+
+    /**
+     * Clasifica una caja contra los planos de mask. Devuelve false si queda
+     * fuera de alguno y quita de mask los planos que la contienen por completo.
+     */
+    inline bool classify(const Frustum& frustum, const glm::vec3& boundsMin, const glm::vec3& boundsMax, unsigned& mask)
+    {
+        for (int p = 0; p < 6; ++p) {
+            if ((mask & (1u << p)) == 0)
+                continue;
+            if (planeDistance(frustum, p, boundsMin, boundsMax, true) < 0.0f)
+                return false;
+            if (planeDistance(frustum, p, boundsMin, boundsMax, false) >= 0.0f)
+                mask &= ~(1u << p);
+        }
+        return true;
+    }
+}
+
+Bvh::Bvh()
+    : m_threadCount(1)
+{
+}
+
+void Bvh::build(const BoxBatch& boxes, const BvhBuildParams& params)
+{
+    const size_t count = boxes.size();
+    m_triangles.clear();
+    m_triangleIndexs.clear();
+    m_primitiveMin.resize(count);
+    m_primitiveMax.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        m_primitiveMin[i] = glm::vec3(boxes.minX[i], boxes.minY[i], boxes.minZ[i]);
+        m_primitiveMax[i] = glm::vec3(boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]);
+    }
+
+    buildNodes(params);
+
+    // Guarda las cajas en el orden de las hojas para recorrerlas de forma contigua
+    std::vector<glm::vec3> sortedMin(count), sortedMax(count);
+    for (size_t i = 0; i < count; ++i) {
+        sortedMin[i] = m_primitiveMin[m_primitiveIndexs[i]];
+        sortedMax[i] = m_primitiveMax[m_primitiveIndexs[i]];
+    }
+    m_primitiveMin.swap(sortedMin);
+    m_primitiveMax.swap(sortedMax);
+}
+
+void Bvh::build(std::span<const glm::vec3> positions, std::span<const GLuint> indexs, const BvhBuildParams& params)
+{
+    if (indexs.size() % 3 != 0) {
+        std::cerr << "ERROR::BVH::BUILD: Index count " << indexs.size() << " is not a multiple of 3" << std::endl;
+        return;
+    }
+
+    for (GLuint index : indexs) {
+        if (index >= positions.size()) {
+            std::cerr << "ERROR::BVH::BUILD: Index " << index << " out of range (" << positions.size()
+                      << " vertices)" << std::endl;
+            return;
+        }
+    }
+
+    const size_t count = indexs.size() / 3;
+    const unsigned threadCount = resolveThreadCount(params.threadCount);
+    m_triangleIndexs.assign(indexs.begin(), indexs.end());
+    m_primitiveMin.resize(count);
+    m_primitiveMax.resize(count);
+    parallelFor((count + CHUNK_SIZE - 1) / CHUNK_SIZE, threadCount, [&](size_t chunk) {
+        const size_t end = std::min(count, (chunk + 1) * CHUNK_SIZE);
+        for (size_t t = chunk * CHUNK_SIZE; t < end; ++t) {
+            const glm::vec3& a = positions[indexs[3 * t]];
+            const glm::vec3& b = positions[indexs[3 * t + 1]];
+            const glm::vec3& c = positions[indexs[3 * t + 2]];
+            m_primitiveMin[t] = glm::min(a, glm::min(b, c));
+            m_primitiveMax[t] = glm::max(a, glm::max(b, c));
+        }
+    });
+
+    buildNodes(params);
+
+    m_primitiveMin.clear();
+    m_primitiveMax.clear();
+    updateTriangles(positions);
+}
+
+void Bvh::buildNodes(const BvhBuildParams& params)
+{
+    const size_t count = m_primitiveMin.size();
+    m_threadCount = resolveThreadCount(params.threadCount);
+    m_nodes.clear();
+    m_primitiveIndexs.resize(count);
+    if (count == 0)
+        return;
+
+    if (count >= std::numeric_limits<GLuint>::max() / 2) {
+        std::cerr << "ERROR::BVH::BUILD: Too many primitives (" << count << ")" << std::endl;
+        m_primitiveIndexs.clear();
+        return;
+    }
+
+    BuildContext context;
+    context.primitives.resize(count);
+    parallelFor((count + CHUNK_SIZE - 1) / CHUNK_SIZE, m_threadCount, [&](size_t chunk) {
+        const size_t end = std::min(count, (chunk + 1) * CHUNK_SIZE);
+        for (size_t i = chunk * CHUNK_SIZE; i < end; ++i)
+            context.primitives[i] = PrimitiveRef{ m_primitiveMin[i], static_cast<GLuint>(i), m_primitiveMax[i] };
+    });
+
+    // Un árbol binario con hojas de al menos una primitiva tiene como mucho 2n - 1 nodos
+    m_nodes.resize(2 * count - 1);
+    context.nodes = m_nodes.data();
+    context.nodeCount = 1;
+    context.spareThreads = static_cast<int>(m_threadCount) - 1;
+    context.maxLeafSize = std::max(1u, params.maxLeafSize);
+    context.binCount = std::clamp(params.binCount, 2u, MAX_BINS);
+
+    m_nodes[0].leftFirst = 0;
+    m_nodes[0].count = static_cast<GLuint>(count);
+    subdivide(context, 0, 0);
+
+    m_nodes.resize(context.nodeCount);
+    m_nodes.shrink_to_fit();
+    for (size_t i = 0; i < count; ++i)
+        m_primitiveIndexs[i] = context.primitives[i].index;
+}
+
+void Bvh::updateTriangles(std::span<const glm::vec3> positions)
+{
+    const size_t count = m_primitiveIndexs.size();
+    m_triangles.resize(count);
+    parallelFor((count + CHUNK_SIZE - 1) / CHUNK_SIZE, m_threadCount, [&](size_t chunk) {
+        const size_t end = std::min(count, (chunk + 1) * CHUNK_SIZE);
+        for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+            const GLuint* triangle = &m_triangleIndexs[3 * static_cast<size_t>(m_primitiveIndexs[i])];
+            m_triangles[i].vertex = positions[triangle[0]];
+            m_triangles[i].edge1 = positions[triangle[1]] - positions[triangle[0]];
+            m_triangles[i].edge2 = positions[triangle[2]] - positions[triangle[0]];
+        }
+    });
+}
+
+void Bvh::refit(const BoxBatch& boxes)
+{
+    if (!m_triangleIndexs.empty() || boxes.size() != m_primitiveIndexs.size()) {
+        std::cerr << "ERROR::BVH::REFIT: Expected " << m_primitiveIndexs.size() << " boxes, got " << boxes.size()
+                  << std::endl;
+        return;
+    }
+
+    const size_t count = boxes.size();
+    parallelFor((count + CHUNK_SIZE - 1) / CHUNK_SIZE, m_threadCount, [&](size_t chunk) {
+        const size_t end = std::min(count, (chunk + 1) * CHUNK_SIZE);
+        for (size_t i = chunk * CHUNK_SIZE; i < end; ++i) {
+            GLuint box = m_primitiveIndexs[i];
+            m_primitiveMin[i] = glm::vec3(boxes.minX[box], boxes.minY[box], boxes.minZ[box]);
+            m_primitiveMax[i] = glm::vec3(boxes.maxX[box], boxes.maxY[box], boxes.maxZ[box]);
+        }
+    });
+
+    refitNodes();
+}
+
+void Bvh::refit(std::span<const glm::vec3> positions)
+{
+    if (m_triangleIndexs.empty() && !m_primitiveIndexs.empty()) {
+        std::cerr << "ERROR::BVH::REFIT: The hierarchy was built from boxes, not triangles" << std::endl;
+        return;
+    }
+
+    for (GLuint index : m_triangleIndexs) {
+        if (index >= positions.size()) {
+            std::cerr << "ERROR::BVH::REFIT: Index " << index << " out of range (" << positions.size()
+                      << " vertices)" << std::endl;
+            return;
+        }
+    }
+
+    updateTriangles(positions);
+    refitNodes();
+}
+
+void Bvh::refitNodes()
+{
+    // Las hojas son independientes entre sí: se reparten por bloques de nodos
+    const size_t nodeCount = m_nodes.size();
+    parallelFor((nodeCount + CHUNK_SIZE - 1) / CHUNK_SIZE, m_threadCount, [&](size_t chunk) {
+        const size_t end = std::min(nodeCount, (chunk + 1) * CHUNK_SIZE);
+        for (size_t n = chunk * CHUNK_SIZE; n < end; ++n) {
+            BvhNode& node = m_nodes[n];
+            if (!node.isLeaf())
+                continue;
+
+            node.boundsMin = glm::vec3(FLT_MAX);
+            node.boundsMax = glm::vec3(-FLT_MAX);
+            for (GLuint i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                if (m_triangles.empty()) {
+                    node.boundsMin = glm::min(node.boundsMin, m_primitiveMin[i]);
+                    node.boundsMax = glm::max(node.boundsMax, m_primitiveMax[i]);
+                } else {
+                    const Triangle& triangle = m_triangles[i];
+                    glm::vec3 b = triangle.vertex + triangle.edge1;
+                    glm::vec3 c = triangle.vertex + triangle.edge2;
+                    node.boundsMin = glm::min(node.boundsMin, glm::min(triangle.vertex, glm::min(b, c)));
+                    node.boundsMax = glm::max(node.boundsMax, glm::max(triangle.vertex, glm::max(b, c)));
+                }
+            }
+        }
+    });
+
+    // Los hijos siempre se reservan después que su padre: basta un recorrido inverso
+    for (size_t n = nodeCount; n-- > 0;) {
+        BvhNode& node = m_nodes[n];
+        if (node.isLeaf())
+            continue;
+        const BvhNode& left = m_nodes[node.leftFirst];
+        const BvhNode& right = m_nodes[node.leftFirst + 1];
+        node.boundsMin = glm::min(left.boundsMin, right.boundsMin);
+        node.boundsMax = glm::max(left.boundsMax, right.boundsMax);
+    }
+}
+
+size_t Bvh::cull(const Frustum& frustum, std::vector<GLuint>& visible) const
+{
+    visible.clear();
+    if (m_nodes.empty())
+        return 0;
+
+    std::array<GLuint, STACK_SIZE> nodeStack;
+    std::array<unsigned, STACK_SIZE> maskStack;
+    size_t stackSize = 0;
+    GLuint nodeIndex = 0;
+    unsigned mask = 0x3f;
+
+    for (;;) {
+        const BvhNode& node = m_nodes[nodeIndex];
+        if (classify(frustum, node.boundsMin, node.boundsMax, mask)) {
+            if (mask == 0) {
+                // Subárbol dentro del frustum: sus primitivas son un rango contiguo de las hojas
+                GLuint first = nodeIndex, last = nodeIndex;
+                while (!m_nodes[first].isLeaf())
+                    first = m_nodes[first].leftFirst;
+                while (!m_nodes[last].isLeaf())
+                    last = m_nodes[last].leftFirst + 1;
+                visible.insert(visible.end(),
+                               m_primitiveIndexs.begin() + m_nodes[first].leftFirst,
+                               m_primitiveIndexs.begin() + m_nodes[last].leftFirst + m_nodes[last].count);
+            } else if (node.isLeaf()) {
+                for (GLuint i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                    glm::vec3 boundsMin, boundsMax;
+                    if (m_triangles.empty()) {
+                        boundsMin = m_primitiveMin[i];
+                        boundsMax = m_primitiveMax[i];
+                    } else {
+                        const Triangle& triangle = m_triangles[i];
+                        glm::vec3 b = triangle.vertex + triangle.edge1;
+                        glm::vec3 c = triangle.vertex + triangle.edge2;
+                        boundsMin = glm::min(triangle.vertex, glm::min(b, c));
+                        boundsMax = glm::max(triangle.vertex, glm::max(b, c));
+                    }
+                    unsigned primitiveMask = mask;
+                    if (classify(frustum, boundsMin, boundsMax, primitiveMask))
+                        visible.push_back(m_primitiveIndexs[i]);
+                }
+            } else {
+                nodeStack[stackSize] = node.leftFirst + 1;
+                maskStack[stackSize++] = mask;
+                nodeIndex = node.leftFirst;
+                continue;
+            }
+        }
+
+        if (stackSize == 0)
+            break;
+        nodeIndex = nodeStack[--stackSize];
+        mask = maskStack[stackSize];
+    }
+
+    return visible.size();
+}
+
+bool Bvh::raycast(const Ray& ray, BvhHit& hit) const
+{
+    if (m_nodes.empty())
+        return false;
+
+    const glm::vec3 inverseDirection = 1.0f / ray.direction;
+    const float startDistance = hit.distance;
+    if (slab(ray.origin, inverseDirection, m_nodes[0].boundsMin, m_nodes[0].boundsMax, hit.distance) == FLT_MAX)
+        return false;
+
+    std::array<GLuint, STACK_SIZE> stack;
+    size_t stackSize = 0;
+    GLuint nodeIndex = 0;
+
+    for (;;) {
+        const BvhNode& node = m_nodes[nodeIndex];
+        if (node.isLeaf()) {
+            for (GLuint i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                if (m_triangles.empty()) {
+                    float distance = slab(ray.origin, inverseDirection, m_primitiveMin[i], m_primitiveMax[i], hit.distance);
+                    if (distance < hit.distance) {
+                        hit.primitive = m_primitiveIndexs[i];
+                        hit.distance = distance;
+                        hit.barycentric = glm::vec2(0.0f);
+                    }
+                    continue;
+                }
+
+                // Möller-Trumbore, sin descartar caras traseras
+                const Triangle& triangle = m_triangles[i];
+                glm::vec3 p = glm::cross(ray.direction, triangle.edge2);
+                float determinant = glm::dot(triangle.edge1, p);
+                if (std::fabs(determinant) < 1e-12f)
+                    continue;
+                float inverseDeterminant = 1.0f / determinant;
+                glm::vec3 s = ray.origin - triangle.vertex;
+                float u = glm::dot(s, p) * inverseDeterminant;
+                if (u < 0.0f || u > 1.0f)
+                    continue;
+                glm::vec3 q = glm::cross(s, triangle.edge1);
+                float v = glm::dot(ray.direction, q) * inverseDeterminant;
+                if (v < 0.0f || u + v > 1.0f)
+                    continue;
+                float distance = glm::dot(triangle.edge2, q) * inverseDeterminant;
+                if (distance >= 0.0f && distance < hit.distance) {
+                    hit.primitive = m_primitiveIndexs[i];
+                    hit.distance = distance;
+                    hit.barycentric = glm::vec2(u, v);
+                }
+            }
+        } else {
+            // Visita primero el hijo más cercano para acotar antes hit.distance
+            GLuint closer = node.leftFirst, farther = node.leftFirst + 1;
+            float closerDistance = slab(ray.origin, inverseDirection, m_nodes[closer].boundsMin, m_nodes[closer].boundsMax, hit.distance);
+            float fartherDistance = slab(ray.origin, inverseDirection, m_nodes[farther].boundsMin, m_nodes[farther].boundsMax, hit.distance);
+            if (fartherDistance < closerDistance) {
+                std::swap(closer, farther);
+                std::swap(closerDistance, fartherDistance);
+            }
+            if (closerDistance != FLT_MAX) {
+                if (fartherDistance != FLT_MAX)
+                    stack[stackSize++] = farther;
+                nodeIndex = closer;
+                continue;
+            }
+        }
+
+        // Al sacar un nodo de la pila puede que ya haya un impacto más cercano que su caja
+        bool found = false;
+        while (stackSize > 0 && !found) {
+            nodeIndex = stack[--stackSize];
+            found = slab(ray.origin, inverseDirection, m_nodes[nodeIndex].boundsMin, m_nodes[nodeIndex].boundsMax,
+                         hit.distance) != FLT_MAX;
+        }
+        if (!found)
+            break;
+    }
+
+    return hit.distance < startDistance;
+}
+
+BvhStats Bvh::stats() const
+{
+    BvhStats stats;
+    stats.nodeCount = m_nodes.size();
+    if (m_nodes.empty())
+        return stats;
+
+    const float rootArea = halfArea(m_nodes[0].boundsMin, m_nodes[0].boundsMax);
+    std::vector<std::pair<GLuint, size_t>> stack = { { 0, 0 } };
+    while (!stack.empty()) {
+        auto [nodeIndex, depth] = stack.back();
+        stack.pop_back();
+
+        const BvhNode& node = m_nodes[nodeIndex];
+        const float area = rootArea > 0.0f ? halfArea(node.boundsMin, node.boundsMax) / rootArea : 1.0f;
+        stats.maxDepth = std::max(stats.maxDepth, depth);
+        if (node.isLeaf()) {
+            ++stats.leafCount;
+            stats.sahCost += area * node.count;
+        } else {
+            stats.sahCost += area * TRAVERSAL_COST;
+            stack.push_back({ node.leftFirst, depth + 1 });
+            stack.push_back({ node.leftFirst + 1, depth + 1 });
+        }
+    }
+
+    return stats;
+}
+
+const std::vector<BvhNode>& Bvh::nodes() const
+{
+    return m_nodes;
+}
+
+const std::vector<GLuint>& Bvh::primitiveIndexs() const
+{
+    return m_primitiveIndexs;
+}
+
+size_t Bvh::primitiveCount() const
+{
+    return m_primitiveIndexs.size();
+}
+
+bool Bvh::empty() const
+{
+    return m_nodes.empty();
+}
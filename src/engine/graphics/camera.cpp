@@ -1,10 +1,12 @@
+#include "engine/graphics/camera.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <algorithm>
 
-#include "engine/graphics/camera.hpp"
 #include "engine/input/mouse.hpp"
 #include "engine/core/timer.hpp"
 
@@ -12,6 +14,12 @@ using namespace engine::graphics;
 using namespace engine::input;
 using namespace engine::core;
 
+namespace {
+    // Un único uniform buffer para todas las cámaras: lo que hay en el binding es lo último publicado
+    GLuint uniformBuffer = 0;
+    CameraUniforms publishedUniforms;
+}
+
 void Camera::updateVectors()
 {
     float cosPitch = std::cos(glm::radians(m_pitch));
@@ -49,6 +57,10 @@ Camera::Camera(const glm::vec3& position,
     , m_maxFov(std::min(120.0f, maxFov))
     , m_zNear(zNear)
     , m_zFar(zFar)
+    , m_projectionAspectRatio(0.0f)
+    , m_viewDirty(true)
+    , m_projectionDirty(true)
+    , m_uniformsDirty(true)
 {    
     if (m_minFov >= m_maxFov) {
         std::swap(m_minFov, m_maxFov);
@@ -60,36 +72,132 @@ Camera::Camera(const glm::vec3& position,
 
 glm::mat4 Camera::getViewMatrix() const
 {
-    return glm::lookAt(m_position, m_position + m_forward, m_up);
+    if (m_viewDirty) {
+        m_view = glm::lookAt(m_position, m_position + m_forward, m_up);
+        m_viewDirty = false;
+    }
+
+    return m_view;
 }
 
 glm::mat4 Camera::getProjectionMatrix(float aspectRatio) const
 {
-    return glm::perspective(glm::radians(m_fov), aspectRatio, m_zNear, m_zFar);
+    if (m_projectionDirty || aspectRatio != m_projectionAspectRatio) {
+        m_projection = glm::perspective(glm::radians(m_fov), aspectRatio, m_zNear, m_zFar);
+        m_projectionAspectRatio = aspectRatio;
+        m_projectionDirty = false;
+    }
+
+    return m_projection;
+}
+
+Frustum Camera::frustum(float aspectRatio) const
+{
+    return Frustum::fromMatrix(getProjectionMatrix(aspectRatio) * getViewMatrix());
+}
+
+Ray Camera::screenRay(double screenX, double screenY, int width, int height) const
+{
+    // Coordenadas de ventana (origen arriba a la izquierda) a NDC, y de ahí al plano a distancia 1
+    float ndcX = static_cast<float>(2.0 * screenX / width - 1.0);
+    float ndcY = static_cast<float>(1.0 - 2.0 * screenY / height);
+    float tanHalfFov = std::tan(glm::radians(m_fov) * 0.5f);
+    float aspectRatio = static_cast<float>(width) / static_cast<float>(height);
+
+    glm::vec3 direction = m_forward + m_right * (ndcX * tanHalfFov * aspectRatio) + m_up * (ndcY * tanHalfFov);
+    return Ray{ m_position, glm::normalize(direction) };
+}
+
+const CameraUniforms& Camera::uniforms(float aspectRatio) const
+{
+    if (!m_uniformsDirty && aspectRatio == m_uniforms.aspectRatio) {
+        return m_uniforms;
+    }
+
+    m_uniforms.view = getViewMatrix();
+    m_uniforms.projection = getProjectionMatrix(aspectRatio);
+    m_uniforms.viewProjection = m_uniforms.projection * m_uniforms.view;
+    m_uniforms.inverseView = glm::inverse(m_uniforms.view);
+    m_uniforms.inverseProjection = glm::inverse(m_uniforms.projection);
+    m_uniforms.position = m_position;
+    m_uniforms.zNear = m_zNear;
+    m_uniforms.zFar = m_zFar;
+    m_uniforms.fov = glm::radians(m_fov);
+    m_uniforms.aspectRatio = aspectRatio;
+    m_uniforms.padding = 0.0f;
+    m_uniformsDirty = false;
+
+    return m_uniforms;
+}
+
+void Camera::publish(float aspectRatio) const
+{
+    const CameraUniforms& data = uniforms(aspectRatio);
+
+    if (uniformBuffer == 0) {
+        glGenBuffers(1, &uniformBuffer);
+        GLStateCache::bindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(CameraUniforms), &data, GL_DYNAMIC_DRAW);
+        GLStateCache::bindBufferBase(GL_UNIFORM_BUFFER, CAMERA_UNIFORM_BINDING, uniformBuffer);
+        publishedUniforms = data;
+        return;
+    }
+
+    // Si la cámara no ha cambiado desde la última publicación no hay nada que subir
+    if (std::memcmp(&publishedUniforms, &data, sizeof(CameraUniforms)) == 0) {
+        return;
+    }
+
+    GLStateCache::bindBuffer(GL_UNIFORM_BUFFER, uniformBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(CameraUniforms), &data);
+    publishedUniforms = data;
+}
+
+size_t Camera::cull(const BoxBatch& boxes, float aspectRatio, std::vector<GLuint>& visible) const
+{
+    return frustum(aspectRatio).cull(boxes, visible);
+}
+
+size_t Camera::cull(const SphereBatch& spheres, float aspectRatio, std::vector<GLuint>& visible) const
+{
+    return frustum(aspectRatio).cull(spheres, visible);
 }
 
 void Camera::move(const glm::vec3& offset)
 {
     m_position += m_movementSpeed * offset;
+    m_viewDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::moveForward(float deltaTime)
 {
     m_position += deltaTime * m_movementSpeed * glm::normalize(glm::vec3(m_forward.x, 0.0f, m_forward.z));
+    m_viewDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::moveRight(float deltaTime)
 {
     m_position += deltaTime * m_movementSpeed * m_right;
+    m_viewDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::moveUp(float deltaTime)
 {
     m_position += deltaTime * m_movementSpeed * m_worldUp;
+    m_viewDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::rotate(float yawOffset, float pitchOffset)
 {
+    // Se llama cada frame con el desplazamiento del ratón, casi siempre nulo
+    if (yawOffset == 0.0f && pitchOffset == 0.0f) {
+        return;
+    }
+
     yawOffset *= m_mouseSensitivity;
     pitchOffset *= m_mouseSensitivity;
 
@@ -98,6 +206,8 @@ void Camera::rotate(float yawOffset, float pitchOffset)
     m_pitch = std::clamp(m_pitch, -89.0f, 89.0f);
 
     updateVectors();
+    m_viewDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::zoom(float offset)
@@ -194,7 +304,14 @@ void Camera::setZoomSensitivity(float sensitivity)
 
 void Camera::setFov(float fov)
 {
-    m_fov = std::clamp(fov, m_minFov, m_maxFov);
+    float clamped = std::clamp(fov, m_minFov, m_maxFov);
+    if (clamped == m_fov) {
+        return;
+    }
+
+    m_fov = clamped;
+    m_projectionDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::setFovLimits(float minFov, float maxFov)
@@ -207,14 +324,20 @@ void Camera::setFovLimits(float minFov, float maxFov)
     }
     
     m_fov = std::clamp(m_fov, m_minFov, m_maxFov);
+    m_projectionDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::setZNear(float zNear)
 {
     m_zNear = zNear;
+    m_projectionDirty = true;
+    m_uniformsDirty = true;
 }
 
 void Camera::setZFar(float zFar)
 {
     m_zFar = zFar;
+    m_projectionDirty = true;
+    m_uniformsDirty = true;
 }
\ No newline at end of file
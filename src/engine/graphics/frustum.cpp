@@ -0,0 +1,263 @@
+#include "engine/graphics/frustum.hpp"
+#include <bit>
+#include <cmath>
+#include <limits>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define ENGINE_FRUSTUM_AVX 1
+#elif defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ENGINE_FRUSTUM_SSE 1
+#endif
+
+using namespace engine::graphics;
+
+namespace {
+
+    /** Añade a visible los índices first + bit de cada bit activo de la máscara */
+    inline void appendLanes(unsigned mask, GLuint first, std::vector<GLuint>& visible)
+    {
+        while (mask != 0) {
+            visible.push_back(first + static_cast<GLuint>(std::countr_zero(mask)));
+            mask &= mask - 1;
+        }
+    }
+
+    /**
+     * Esquina de la caja más avanzada en la dirección de la normal de cada plano.
+     * Como los planos son los mismos para todo el lote, la elección se hace una
+     * vez por plano y el bucle SIMD solo carga los arreglos elegidos.
+     */
+    struct PositiveVertex {
+        const float* x[6];
+        const float* y[6];
+        const float* z[6];
+
+        PositiveVertex(const Frustum& frustum, const BoxBatch& boxes)
+        {
+            for (int p = 0; p < 6; ++p) {
+                x[p] = frustum.x[p] >= 0.0f ? boxes.maxX.data() : boxes.minX.data();
+                y[p] = frustum.y[p] >= 0.0f ? boxes.maxY.data() : boxes.minY.data();
+                z[p] = frustum.z[p] >= 0.0f ? boxes.maxZ.data() : boxes.minZ.data();
+            }
+        }
+    };
+}
+
+void BoxBatch::add(const glm::vec3& boundsMin, const glm::vec3& boundsMax)
+{
+    minX.push_back(boundsMin.x);
+    minY.push_back(boundsMin.y);
+    minZ.push_back(boundsMin.z);
+    maxX.push_back(boundsMax.x);
+    maxY.push_back(boundsMax.y);
+    maxZ.push_back(boundsMax.z);
+}
+
+void BoxBatch::add(const glm::vec3& boundsMin, const glm::vec3& boundsMax, const glm::mat4& model)
+{
+    // En double y acotado a ±FLT_MAX: las cajas "infinitas" (±FLT_MAX, p. ej. las
+    // mallas de un StreamBuffer) desbordarían a ±inf con cualquier giro o escala,
+    // y 0 * inf da NaN en cull(), que descartaría una malla que siempre es visible
+    glm::dvec3 worldMin(model[3]);
+    glm::dvec3 worldMax(model[3]);
+    for (int column = 0; column < 3; ++column) {
+        for (int row = 0; row < 3; ++row) {
+            double a = static_cast<double>(model[column][row]) * boundsMin[column];
+            double b = static_cast<double>(model[column][row]) * boundsMax[column];
+            worldMin[row] += std::fmin(a, b);
+            worldMax[row] += std::fmax(a, b);
+        }
+    }
+
+    const glm::dvec3 limit(std::numeric_limits<float>::max());
+    add(glm::vec3(glm::clamp(worldMin, -limit, limit)), glm::vec3(glm::clamp(worldMax, -limit, limit)));
+}
+
+void BoxBatch::reserve(size_t count)
+{
+    for (std::vector<float>* component : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ })
+        component->reserve(count);
+}
+
+void BoxBatch::clear()
+{
+    for (std::vector<float>* component : { &minX, &minY, &minZ, &maxX, &maxY, &maxZ })
+        component->clear();
+}
+
+size_t BoxBatch::size() const
+{
+    return minX.size();
+}
+
+void SphereBatch::add(const glm::vec3& center, float sphereRadius)
+{
+    centerX.push_back(center.x);
+    centerY.push_back(center.y);
+    centerZ.push_back(center.z);
+    radius.push_back(sphereRadius);
+}
+
+void SphereBatch::reserve(size_t count)
+{
+    for (std::vector<float>* component : { &centerX, &centerY, &centerZ, &radius })
+        component->reserve(count);
+}
+
+void SphereBatch::clear()
+{
+    for (std::vector<float>* component : { &centerX, &centerY, &centerZ, &radius })
+        component->clear();
+}
+
+size_t SphereBatch::size() const
+{
+    return centerX.size();
+}
+
+Frustum Frustum::fromMatrix(const glm::mat4& viewProjection)
+{
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; ++i)
+        rows[i] = glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+
+    const glm::vec4 planes[6] = {
+        rows[3] + rows[0], rows[3] - rows[0],
+        rows[3] + rows[1], rows[3] - rows[1],
+        rows[3] + rows[2], rows[3] - rows[2]
+    };
+
+    Frustum frustum;
+    for (int p = 0; p < 6; ++p) {
+        float length = glm::length(glm::vec3(planes[p]));
+        frustum.x[p] = planes[p].x / length;
+        frustum.y[p] = planes[p].y / length;
+        frustum.z[p] = planes[p].z / length;
+        frustum.w[p] = planes[p].w / length;
+    }
+    return frustum;
+}
+
+bool Frustum::intersects(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const
+{
+    for (int p = 0; p < 6; ++p) {
+        float distance = x[p] * (x[p] >= 0.0f ? boundsMax.x : boundsMin.x)
+                       + y[p] * (y[p] >= 0.0f ? boundsMax.y : boundsMin.y)
+                       + z[p] * (z[p] >= 0.0f ? boundsMax.z : boundsMin.z) + w[p];
+        if (distance < 0.0f)
+            return false;
+    }
+    return true;
+}
+
+bool Frustum::intersects(const glm::vec3& center, float radius) const
+{
+    for (int p = 0; p < 6; ++p) {
+        if (x[p] * center.x + y[p] * center.y + z[p] * center.z + w[p] < -radius)
+            return false;
+    }
+    return true;
+}
+
+size_t Frustum::cull(const BoxBatch& boxes, std::vector<GLuint>& visible) const
+{
+    const size_t count = boxes.size();
+    const PositiveVertex corner(*this, boxes);
+    visible.clear();
+    visible.reserve(count);
+
+    size_t i = 0;
+#if defined(ENGINE_FRUSTUM_AVX)
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < 6; ++p) {
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(x[p]), _mm256_loadu_ps(corner.x[p] + i)),
+                                            _mm256_mul_ps(_mm256_set1_ps(y[p]), _mm256_loadu_ps(corner.y[p] + i)));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(z[p]), _mm256_loadu_ps(corner.z[p] + i)));
+            distance = _mm256_add_ps(distance, _mm256_set1_ps(w[p]));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, zero, _CMP_GE_OQ));
+        }
+        appendLanes(static_cast<unsigned>(_mm256_movemask_ps(inside)), static_cast<GLuint>(i), visible);
+    }
+#elif defined(ENGINE_FRUSTUM_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        __m128 inside = _mm_cmpeq_ps(zero, zero);
+        for (int p = 0; p < 6; ++p) {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[p]), _mm_loadu_ps(corner.x[p] + i)),
+                                         _mm_mul_ps(_mm_set1_ps(y[p]), _mm_loadu_ps(corner.y[p] + i)));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(z[p]), _mm_loadu_ps(corner.z[p] + i)));
+            distance = _mm_add_ps(distance, _mm_set1_ps(w[p]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, zero));
+        }
+        appendLanes(static_cast<unsigned>(_mm_movemask_ps(inside)), static_cast<GLuint>(i), visible);
+    }
+#endif
+
+    // Mismo orden de operaciones que el bucle SIMD para que el resultado no dependa del tamaño del lote
+    for (; i < count; ++i) {
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p)
+            inside = x[p] * corner.x[p][i] + y[p] * corner.y[p][i] + z[p] * corner.z[p][i] + w[p] >= 0.0f;
+        if (inside)
+            visible.push_back(static_cast<GLuint>(i));
+    }
+
+    return visible.size();
+}
+
+size_t Frustum::cull(const SphereBatch& spheres, std::vector<GLuint>& visible) const
+{
+    const size_t count = spheres.size();
+    visible.clear();
+    visible.reserve(count);
+
+    size_t i = 0;
+#if defined(ENGINE_FRUSTUM_AVX)
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= count; i += 8) {
+        __m256 centerX = _mm256_loadu_ps(&spheres.centerX[i]);
+        __m256 centerY = _mm256_loadu_ps(&spheres.centerY[i]);
+        __m256 centerZ = _mm256_loadu_ps(&spheres.centerZ[i]);
+        __m256 negativeRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(&spheres.radius[i]));
+
+        __m256 inside = _mm256_cmp_ps(zero, zero, _CMP_EQ_OQ);
+        for (int p = 0; p < 6; ++p) {
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(x[p]), centerX),
+                                            _mm256_mul_ps(_mm256_set1_ps(y[p]), centerY));
+            distance = _mm256_add_ps(distance, _mm256_mul_ps(_mm256_set1_ps(z[p]), centerZ));
+            distance = _mm256_add_ps(distance, _mm256_set1_ps(w[p]));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ));
+        }
+        appendLanes(static_cast<unsigned>(_mm256_movemask_ps(inside)), static_cast<GLuint>(i), visible);
+    }
+#elif defined(ENGINE_FRUSTUM_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= count; i += 4) {
+        __m128 centerX = _mm_loadu_ps(&spheres.centerX[i]);
+        __m128 centerY = _mm_loadu_ps(&spheres.centerY[i]);
+        __m128 centerZ = _mm_loadu_ps(&spheres.centerZ[i]);
+        __m128 negativeRadius = _mm_sub_ps(zero, _mm_loadu_ps(&spheres.radius[i]));
+
+        __m128 inside = _mm_cmpeq_ps(zero, zero);
+        for (int p = 0; p < 6; ++p) {
+            __m128 distance = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(x[p]), centerX),
+                                         _mm_mul_ps(_mm_set1_ps(y[p]), centerY));
+            distance = _mm_add_ps(distance, _mm_mul_ps(_mm_set1_ps(z[p]), centerZ));
+            distance = _mm_add_ps(distance, _mm_set1_ps(w[p]));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+        }
+        appendLanes(static_cast<unsigned>(_mm_movemask_ps(inside)), static_cast<GLuint>(i), visible);
+    }
+#endif
+
+    for (; i < count; ++i) {
+        if (intersects(glm::vec3(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]), spheres.radius[i]))
+            visible.push_back(static_cast<GLuint>(i));
+    }
+
+    return visible.size();
+}
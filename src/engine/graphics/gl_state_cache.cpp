@@ -0,0 +1,273 @@
+#include "engine/graphics/gl_state_cache.hpp"
+#include <algorithm>
+
+using namespace engine::graphics;
+
+GLuint GLStateCache::currentProgram = GLStateCache::UNKNOWN;
+GLuint GLStateCache::currentVertexArray = GLStateCache::UNKNOWN;
+GLenum GLStateCache::currentActiveTexture = GLStateCache::UNKNOWN;
+std::array<std::array<GLuint, GLStateCache::TEXTURE_TARGETS>, GLStateCache::TEXTURE_UNITS> GLStateCache::currentTextures = [] {
+    std::array<std::array<GLuint, TEXTURE_TARGETS>, TEXTURE_UNITS> textures;
+    for (auto& unit : textures)
+        unit.fill(UNKNOWN);
+    return textures;
+}();
+std::array<GLuint, GLStateCache::BUFFER_TARGETS> GLStateCache::currentBuffers = [] {
+    std::array<GLuint, BUFFER_TARGETS> buffers;
+    buffers.fill(UNKNOWN);
+    return buffers;
+}();
+std::array<GLuint, GLStateCache::CAPABILITIES> GLStateCache::currentCapabilities = [] {
+    std::array<GLuint, CAPABILITIES> capabilities;
+    capabilities.fill(UNKNOWN);
+    return capabilities;
+}();
+GLenum GLStateCache::currentBlendSource = GLStateCache::UNKNOWN;
+GLenum GLStateCache::currentBlendDestination = GLStateCache::UNKNOWN;
+GLenum GLStateCache::currentDepthFunc = GLStateCache::UNKNOWN;
+GLuint GLStateCache::currentDepthMask = GLStateCache::UNKNOWN;
+GLStateStats GLStateCache::counters;
+
+namespace {
+
+    constexpr size_t UNTRACKED = static_cast<size_t>(-1);
+
+    size_t textureTargetIndex(GLenum target)
+    {
+        switch (target) {
+        case GL_TEXTURE_2D:       return 0;
+        case GL_TEXTURE_CUBE_MAP: return 1;
+        case GL_TEXTURE_2D_ARRAY: return 2;
+        case GL_TEXTURE_3D:       return 3;
+        default:                  return UNTRACKED;
+        }
+    }
+
+    size_t bufferTargetIndex(GLenum target)
+    {
+        switch (target) {
+        case GL_ARRAY_BUFFER:          return 0;
+        case GL_ELEMENT_ARRAY_BUFFER:  return 1;
+        case GL_UNIFORM_BUFFER:        return 2;
+        case GL_SHADER_STORAGE_BUFFER: return 3;
+        case GL_DRAW_INDIRECT_BUFFER:  return 4;
+        case GL_COPY_READ_BUFFER:      return 5;
+        case GL_COPY_WRITE_BUFFER:     return 6;
+        case GL_PIXEL_UNPACK_BUFFER:   return 7;
+        default:                       return UNTRACKED;
+        }
+    }
+
+    size_t capabilityIndex(GLenum capability)
+    {
+        switch (capability) {
+        case GL_DEPTH_TEST:               return 0;
+        case GL_BLEND:                    return 1;
+        case GL_CULL_FACE:                return 2;
+        case GL_SCISSOR_TEST:             return 3;
+        case GL_STENCIL_TEST:             return 4;
+        case GL_MULTISAMPLE:              return 5;
+        case GL_FRAMEBUFFER_SRGB:         return 6;
+        case GL_POLYGON_OFFSET_FILL:      return 7;
+        default:                          return UNTRACKED;
+        }
+    }
+
+    template <typename T>
+    bool update(T& current, T value, GLStateCounter& counter)
+    {
+        if (current == value) {
+            ++counter.elided;
+            return false;
+        }
+
+        current = value;
+        ++counter.issued;
+        return true;
+    }
+
+} // namespace
+
+void GLStateCache::useProgram(GLuint program)
+{
+    if (update(currentProgram, program, counters.programs))
+        glUseProgram(program);
+}
+
+void GLStateCache::bindVertexArray(GLuint vertexArray)
+{
+    if (update(currentVertexArray, vertexArray, counters.vertexArrays)) {
+        glBindVertexArray(vertexArray);
+        currentBuffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+    }
+}
+
+void GLStateCache::activeTexture(GLenum unit)
+{
+    if (update(currentActiveTexture, unit, counters.activeTexture))
+        glActiveTexture(unit);
+}
+
+void GLStateCache::bindTexture(GLenum unit, GLenum target, GLuint texture)
+{
+    const size_t unitIndex = unit - GL_TEXTURE0;
+    const size_t targetIndex = textureTargetIndex(target);
+    if (unitIndex >= TEXTURE_UNITS || targetIndex == UNTRACKED) {
+        activeTexture(unit);
+        glBindTexture(target, texture);
+        ++counters.textures.issued;
+        return;
+    }
+
+    // Si la textura ya está en su unidad tampoco hace falta cambiar la unidad activa
+    if (currentTextures[unitIndex][targetIndex] == texture) {
+        ++counters.textures.elided;
+        return;
+    }
+
+    activeTexture(unit);
+    update(currentTextures[unitIndex][targetIndex], texture, counters.textures);
+    glBindTexture(target, texture);
+}
+
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer)
+{
+    const size_t index = bufferTargetIndex(target);
+    if (index == UNTRACKED) {
+        glBindBuffer(target, buffer);
+        ++counters.buffers.issued;
+        return;
+    }
+
+    if (update(currentBuffers[index], buffer, counters.buffers))
+        glBindBuffer(target, buffer);
+}
+
+void GLStateCache::bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+{
+    glBindBufferBase(target, index, buffer);
+    ++counters.buffers.issued;
+
+    const size_t targetIndex = bufferTargetIndex(target);
+    if (targetIndex != UNTRACKED)
+        currentBuffers[targetIndex] = buffer;
+}
+
+void GLStateCache::setCapability(GLenum capability, bool enabled)
+{
+    const size_t index = capabilityIndex(capability);
+    if (index == UNTRACKED)
+        ++counters.capabilities.issued;
+    else if (!update(currentCapabilities[index], static_cast<GLuint>(enabled), counters.capabilities))
+        return;
+
+    if (enabled)
+        glEnable(capability);
+    else
+        glDisable(capability);
+}
+
+void GLStateCache::enable(GLenum capability)
+{
+    setCapability(capability, true);
+}
+
+void GLStateCache::disable(GLenum capability)
+{
+    setCapability(capability, false);
+}
+
+void GLStateCache::blendFunc(GLenum source, GLenum destination)
+{
+    if (currentBlendSource == source && currentBlendDestination == destination) {
+        ++counters.capabilities.elided;
+        return;
+    }
+
+    currentBlendSource = source;
+    currentBlendDestination = destination;
+    ++counters.capabilities.issued;
+    glBlendFunc(source, destination);
+}
+
+void GLStateCache::depthFunc(GLenum func)
+{
+    if (update(currentDepthFunc, func, counters.capabilities))
+        glDepthFunc(func);
+}
+
+void GLStateCache::depthMask(GLboolean mask)
+{
+    if (update(currentDepthMask, static_cast<GLuint>(mask), counters.capabilities))
+        glDepthMask(mask);
+}
+
+// OpenGL desenlaza un objeto al borrarlo, y su identificador puede volver a
+// usarse: la caché pasa a 0 para que un objeto nuevo con ese ID se enlace
+
+void GLStateCache::deleteProgram(GLuint program)
+{
+    if (program == 0)
+        return;
+
+    // Un programa en uso solo se marca para borrar; sigue activo hasta el siguiente glUseProgram
+    if (currentProgram == program)
+        currentProgram = UNKNOWN;
+    glDeleteProgram(program);
+}
+
+void GLStateCache::deleteVertexArray(GLuint vertexArray)
+{
+    if (vertexArray == 0)
+        return;
+
+    if (currentVertexArray == vertexArray) {
+        currentVertexArray = 0;
+        currentBuffers[bufferTargetIndex(GL_ELEMENT_ARRAY_BUFFER)] = UNKNOWN;
+    }
+    glDeleteVertexArrays(1, &vertexArray);
+}
+
+void GLStateCache::deleteTexture(GLuint texture)
+{
+    if (texture == 0)
+        return;
+
+    for (auto& unit : currentTextures)
+        std::replace(unit.begin(), unit.end(), texture, 0u);
+    glDeleteTextures(1, &texture);
+}
+
+void GLStateCache::deleteBuffer(GLuint buffer)
+{
+    if (buffer == 0)
+        return;
+
+    std::replace(currentBuffers.begin(), currentBuffers.end(), buffer, 0u);
+    glDeleteBuffers(1, &buffer);
+}
+
+void GLStateCache::invalidate()
+{
+    currentProgram = UNKNOWN;
+    currentVertexArray = UNKNOWN;
+    currentActiveTexture = UNKNOWN;
+    for (auto& unit : currentTextures)
+        unit.fill(UNKNOWN);
+    currentBuffers.fill(UNKNOWN);
+    currentCapabilities.fill(UNKNOWN);
+    currentBlendSource = UNKNOWN;
+    currentBlendDestination = UNKNOWN;
+    currentDepthFunc = UNKNOWN;
+    currentDepthMask = UNKNOWN;
+}
+
+const GLStateStats& GLStateCache::stats()
+{
+    return counters;
+}
+
+void GLStateCache::resetStats()
+{
+    counters = GLStateStats();
+}
@@ -0,0 +1,1116 @@
+#include "engine/graphics/gltf_loader.hpp"
+#include "engine/core/mapped_file.hpp"
+#include "engine/core/parallel.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <string_view>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace
+{
+    constexpr size_t POSITION_SLOT = 0;
+    constexpr size_t COLOR_SLOT = 1;
+    constexpr size_t TEXCOORDS_SLOT = 2;
+    constexpr size_t NORMAL_SLOT = 3;
+    constexpr size_t SLOT_COUNT = 4;
+
+    /** Atributos glTF en el orden de los slots de Mesh */
+    constexpr const char* ATTRIBUTE_NAMES[SLOT_COUNT] = { "POSITION", "COLOR_0", "TEXCOORD_0", "NORMAL" };
+    constexpr VertexAttributes ATTRIBUTE_FLAGS[SLOT_COUNT] = {
+        VertexAttributes::POSITION, VertexAttributes::COLOR, VertexAttributes::TEXCOORDS, VertexAttributes::NORMAL
+    };
+    /** Componentes de cada atributo tal como los espera Mesh en formato float */
+    constexpr size_t OUTPUT_COMPONENTS[SLOT_COUNT] = { 3, 4, 2, 3 };
+
+    /** Vértices convertidos por tarea paralela */
+    constexpr size_t VERTEX_CHUNK = 16384;
+
+    constexpr uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+    constexpr uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+    constexpr uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+    constexpr int TRIANGLES_MODE = 4;
+
+    // ------------------------------------------------------------------
+    // JSON
+    // ------------------------------------------------------------------
+
+    struct JsonValue {
+        enum class Type { NONE, BOOLEAN, NUMBER, STRING, ARRAY, OBJECT };
+
+        Type type = Type::NONE;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<JsonValue> elements;
+        std::vector<std::string> keys;
+
+        const JsonValue& operator[](std::string_view key) const;
+        const JsonValue& operator[](size_t index) const;
+
+        bool has(std::string_view key) const
+        {
+            return &(*this)[key] != &null();
+        }
+
+        size_t size() const
+        {
+            return type == Type::ARRAY ? elements.size() : 0;
+        }
+
+        double asNumber(double fallback) const
+        {
+            return type == Type::NUMBER ? number : fallback;
+        }
+
+        int asInt(int fallback) const
+        {
+            return type == Type::NUMBER ? static_cast<int>(number) : fallback;
+        }
+
+        static const JsonValue& null()
+        {
+            static const JsonValue value;
+            return value;
+        }
+    };
+
+    const JsonValue& JsonValue::operator[](std::string_view key) const
+    {
+        if (type == Type::OBJECT) {
+            for (size_t i = 0; i < keys.size(); ++i) {
+                if (keys[i] == key)
+                    return elements[i];
+            }
+        }
+        return null();
+    }
+
+    const JsonValue& JsonValue::operator[](size_t index) const
+    {
+        return type == Type::ARRAY && index < elements.size() ? elements[index] : null();
+    }
+
+    class JsonReader
+    {
+    private:
+        static constexpr int MAX_DEPTH = 256;
+
+        const char* m_cursor;
+        const char* m_end;
+
+        void skipBlanks()
+        {
+            while (m_cursor < m_end && (*m_cursor == ' ' || *m_cursor == '\t' || *m_cursor == '\n' || *m_cursor == '\r'))
+                ++m_cursor;
+        }
+
+        bool consume(char c)
+        {
+            skipBlanks();
+            if (m_cursor < m_end && *m_cursor == c) {
+                ++m_cursor;
+                return true;
+            }
+            return false;
+        }
+
+        bool consumeWord(std::string_view word)
+        {
+            if (static_cast<size_t>(m_end - m_cursor) < word.size() || std::string_view(m_cursor, word.size()) != word)
+                return false;
+            m_cursor += word.size();
+            return true;
+        }
+
+        static void appendUtf8(std::string& out, uint32_t codepoint)
+        {
+            if (codepoint < 0x80) {
+                out += static_cast<char>(codepoint);
+            }
+            else if (codepoint < 0x800) {
+                out += static_cast<char>(0xC0 | (codepoint >> 6));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else if (codepoint < 0x10000) {
+                out += static_cast<char>(0xE0 | (codepoint >> 12));
+                out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+            else {
+                out += static_cast<char>(0xF0 | (codepoint >> 18));
+                out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+                out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+                out += static_cast<char>(0x80 | (codepoint & 0x3F));
+            }
+        }
+
+        bool parseHex4(uint32_t& value)
+        {
+            if (m_end - m_cursor < 4)
+                return false;
+            value = 0;
+            for (int i = 0; i < 4; ++i) {
+                char c = *m_cursor++;
+                value <<= 4;
+                if (c >= '0' && c <= '9')      value |= static_cast<uint32_t>(c - '0');
+                else if (c >= 'a' && c <= 'f') value |= static_cast<uint32_t>(c - 'a' + 10);
+                else if (c >= 'A' && c <= 'F') value |= static_cast<uint32_t>(c - 'A' + 10);
+                else return false;
+            }
+            return true;
+        }
+
+        bool parseString(std::string& out)
+        {
+            if (!consume('"'))
+                return false;
+
+            while (m_cursor < m_end && *m_cursor != '"') {
+                char c = *m_cursor++;
+                if (c != '\\') {
+                    out += c;
+                    continue;
+                }
+                if (m_cursor >= m_end)
+                    return false;
+
+                switch (*m_cursor++) {
+                    case '"':  out += '"';  break;
+                    case '\\': out += '\\'; break;
+                    case '/':  out += '/';  break;
+                    case 'b':  out += '\b'; break;
+                    case 'f':  out += '\f'; break;
+                    case 'n':  out += '\n'; break;
+                    case 'r':  out += '\r'; break;
+                    case 't':  out += '\t'; break;
+                    case 'u': {
+                        uint32_t codepoint;
+                        if (!parseHex4(codepoint))
+                            return false;
+                        if (codepoint >= 0xD800 && codepoint < 0xDC00 && consumeWord("\\u")) {
+                            uint32_t low;
+                            if (!parseHex4(low))
+                                return false;
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                        }
+                        appendUtf8(out, codepoint);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+
+            if (m_cursor >= m_end)
+                return false;
+            ++m_cursor;
+            return true;
+        }
+
+        bool parseNumber(double& out)
+        {
+            const char* start = m_cursor;
+            while (m_cursor < m_end && (std::strchr("+-.eE", *m_cursor) != nullptr || (*m_cursor >= '0' && *m_cursor <= '9')))
+                ++m_cursor;
+            std::from_chars_result result = std::from_chars(start, m_cursor, out);
+            return result.ec == std::errc() && result.ptr == m_cursor;
+        }
+
+        bool parseValue(JsonValue& value, int depth)
+        {
+            if (depth > MAX_DEPTH)
+                return false;
+
+            skipBlanks();
+            if (m_cursor >= m_end)
+                return false;
+
+            switch (*m_cursor) {
+                case '{': {
+                    ++m_cursor;
+                    value.type = JsonValue::Type::OBJECT;
+                    if (consume('}'))
+                        return true;
+                    do {
+                        value.keys.emplace_back();
+                        value.elements.emplace_back();
+                        if (!parseString(value.keys.back()) || !consume(':') ||
+                            !parseValue(value.elements.back(), depth + 1))
+                            return false;
+                    } while (consume(','));
+                    return consume('}');
+                }
+                case '[': {
+                    ++m_cursor;
+                    value.type = JsonValue::Type::ARRAY;
+                    if (consume(']'))
+                        return true;
+                    do {
+                        value.elements.emplace_back();
+                        if (!parseValue(value.elements.back(), depth + 1))
+                            return false;
+                    } while (consume(','));
+                    return consume(']');
+                }
+                case '"':
+                    value.type = JsonValue::Type::STRING;
+                    return parseString(value.string);
+                case 't':
+                    value.type = JsonValue::Type::BOOLEAN;
+                    value.boolean = true;
+                    return consumeWord("true");
+                case 'f':
+                    value.type = JsonValue::Type::BOOLEAN;
+                    return consumeWord("false");
+                case 'n':
+                    return consumeWord("null");
+                default:
+                    value.type = JsonValue::Type::NUMBER;
+                    return parseNumber(value.number);
+            }
+        }
+
+    public:
+        explicit JsonReader(std::string_view text)
+            : m_cursor(text.data())
+            , m_end(text.data() + text.size())
+        {
+        }
+
+        bool parse(JsonValue& root)
+        {
+            if (!parseValue(root, 0))
+                return false;
+            skipBlanks();
+            return m_cursor == m_end;
+        }
+    };
+
+    // ------------------------------------------------------------------
+    // Buffers y accessors
+    // ------------------------------------------------------------------
+
+    struct BufferData {
+        const unsigned char* data = nullptr;
+        size_t size = 0;
+    };
+
+    struct AccessorView {
+        /** Primer elemento (nullptr si el accessor no tiene buffer view y vale cero) */
+        const unsigned char* data = nullptr;
+        /** Final del buffer que contiene los datos */
+        const unsigned char* bufferEnd = nullptr;
+        size_t count = 0;
+        size_t stride = 0;
+        size_t elementSize = 0;
+        size_t byteOffset = 0;
+        int bufferView = -1;
+        int components = 0;
+        GLenum componentType = GL_FLOAT;
+        bool normalized = false;
+        bool sparse = false;
+    };
+
+    size_t componentSize(GLenum componentType)
+    {
+        switch (componentType) {
+            case GL_BYTE:
+            case GL_UNSIGNED_BYTE:  return 1;
+            case GL_SHORT:
+            case GL_UNSIGNED_SHORT: return 2;
+            case GL_UNSIGNED_INT:
+            case GL_FLOAT:          return 4;
+            default:                return 0;
+        }
+    }
+
+    int componentCount(const std::string& type)
+    {
+        if (type == "SCALAR") return 1;
+        if (type == "VEC2")   return 2;
+        if (type == "VEC3")   return 3;
+        if (type == "VEC4")   return 4;
+        return 0;
+    }
+
+    bool readAccessor(const JsonValue& json, const std::vector<BufferData>& buffers, int index, AccessorView& view)
+    {
+        const JsonValue& accessor = json["accessors"][static_cast<size_t>(index)];
+        if (accessor.type != JsonValue::Type::OBJECT) {
+            std::cerr << "ERROR::GLTF_LOADER::INVALID_ACCESSOR: " << index << std::endl;
+            return false;
+        }
+
+        view.count = static_cast<size_t>(accessor["count"].asNumber(0));
+        view.componentType = static_cast<GLenum>(accessor["componentType"].asInt(0));
+        view.components = componentCount(accessor["type"].string);
+        view.normalized = accessor["normalized"].boolean;
+        view.sparse = accessor.has("sparse");
+        view.elementSize = componentSize(view.componentType) * static_cast<size_t>(view.components);
+        view.stride = view.elementSize;
+        view.byteOffset = static_cast<size_t>(accessor["byteOffset"].asNumber(0));
+        view.bufferView = accessor["bufferView"].asInt(-1);
+
+        if (view.elementSize == 0) {
+            std::cerr << "ERROR::GLTF_LOADER::UNSUPPORTED_ACCESSOR_FORMAT: " << index << std::endl;
+            return false;
+        }
+        if (view.sparse)
+            std::cerr << "ERROR::GLTF_LOADER::SPARSE_ACCESSOR_UNSUPPORTED: " << index << ", using base values" << std::endl;
+        if (view.bufferView < 0)
+            return true;
+
+        const JsonValue& bufferView = json["bufferViews"][static_cast<size_t>(view.bufferView)];
+        int buffer = bufferView["buffer"].asInt(-1);
+        size_t viewOffset = static_cast<size_t>(bufferView["byteOffset"].asNumber(0));
+        size_t viewLength = static_cast<size_t>(bufferView["byteLength"].asNumber(0));
+        if (size_t byteStride = static_cast<size_t>(bufferView["byteStride"].asNumber(0)); byteStride > 0)
+            view.stride = byteStride;
+
+        bool valid = buffer >= 0 && static_cast<size_t>(buffer) < buffers.size() &&
+                     buffers[buffer].data != nullptr && viewOffset + viewLength <= buffers[buffer].size &&
+                     (view.count == 0 || view.byteOffset + (view.count - 1) * view.stride + view.elementSize <= viewLength);
+        if (!valid) {
+            std::cerr << "ERROR::GLTF_LOADER::ACCESSOR_OUT_OF_BOUNDS: " << index << std::endl;
+            return false;
+        }
+
+        view.data = buffers[buffer].data + viewOffset + view.byteOffset;
+        view.bufferEnd = buffers[buffer].data + buffers[buffer].size;
+        return true;
+    }
+
+    float readComponent(const AccessorView& view, size_t element, int component)
+    {
+        if (view.data == nullptr || component >= view.components)
+            return 0.0f;
+
+        const unsigned char* source = view.data + element * view.stride + component * componentSize(view.componentType);
+        switch (view.componentType) {
+            case GL_FLOAT: {
+                float value;
+                std::memcpy(&value, source, sizeof(value));
+                return value;
+            }
+            case GL_UNSIGNED_BYTE:
+                return view.normalized ? *source / 255.0f : static_cast<float>(*source);
+            case GL_BYTE: {
+                int8_t value = static_cast<int8_t>(*source);
+                return view.normalized ? std::max(value / 127.0f, -1.0f) : static_cast<float>(value);
+            }
+            case GL_UNSIGNED_SHORT: {
+                uint16_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return view.normalized ? value / 65535.0f : static_cast<float>(value);
+            }
+            case GL_SHORT: {
+                int16_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return view.normalized ? std::max(value / 32767.0f, -1.0f) : static_cast<float>(value);
+            }
+            case GL_UNSIGNED_INT: {
+                uint32_t value;
+                std::memcpy(&value, source, sizeof(value));
+                return static_cast<float>(value);
+            }
+            default:
+                return 0.0f;
+        }
+    }
+
+    GLuint readIndex(const AccessorView& view, size_t element)
+    {
+        const unsigned char* source = view.data + element * view.stride;
+        if (view.componentType == GL_UNSIGNED_BYTE)
+            return *source;
+        if (view.componentType == GL_UNSIGNED_SHORT) {
+            uint16_t value;
+            std::memcpy(&value, source, sizeof(value));
+            return value;
+        }
+        uint32_t value;
+        std::memcpy(&value, source, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Indica si el accessor ya tiene un formato que Mesh puede leer tal cual
+     * y ajusta la cuantización correspondiente
+     */
+    bool matchesMeshFormat(size_t slot, const AccessorView& view, MeshQuantization& quantization)
+    {
+        const bool isFloat = view.componentType == GL_FLOAT && !view.normalized;
+        switch (slot) {
+            case POSITION_SLOT:
+                if (view.components != 3)
+                    return false;
+                if (isFloat)
+                    return true;
+                if (view.componentType == GL_UNSIGNED_SHORT && view.normalized) {
+                    quantization.position = PositionFormat::UNORM16;
+                    return true;
+                }
+                return false;
+            case COLOR_SLOT:
+                if (view.components != 4)
+                    return false;
+                if (isFloat)
+                    return true;
+                if (view.componentType == GL_UNSIGNED_BYTE && view.normalized) {
+                    quantization.unorm8Colors = true;
+                    return true;
+                }
+                return false;
+            case TEXCOORDS_SLOT:
+                if (view.components != 2)
+                    return false;
+                if (isFloat)
+                    return true;
+                if (view.componentType == GL_UNSIGNED_SHORT && view.normalized) {
+                    quantization.unorm16TexCoords = true;
+                    return true;
+                }
+                return false;
+            default:
+                return view.components == 3 && isFloat;
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // Primitivos
+    // ------------------------------------------------------------------
+
+    struct PrimitivePlan {
+        int material = -1;
+        MeshGpuLayout layout;
+        const unsigned char* vertexData = nullptr;
+        const unsigned char* indexData = nullptr;
+        std::vector<unsigned char> convertedVertexs;
+        std::vector<unsigned char> convertedIndexs;
+        AccessorView attributes[SLOT_COUNT];
+        AccessorView indices;
+        GLuint maxIndex = 0;
+        bool convertVertexs = false;
+        bool convertIndexs = false;
+    };
+
+    struct ConversionTask {
+        size_t plan;
+        size_t first;
+        size_t count;
+        bool indices;
+    };
+
+    /** Intenta usar directamente el buffer view compartido por todos los atributos */
+    bool planZeroCopyVertexs(PrimitivePlan& plan)
+    {
+        const AccessorView* first = nullptr;
+        size_t minimumOffset = SIZE_MAX;
+        MeshQuantization quantization;
+
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (!(plan.layout.attributes & ATTRIBUTE_FLAGS[slot]))
+                continue;
+
+            const AccessorView& view = plan.attributes[slot];
+            if (view.data == nullptr || view.sparse || !matchesMeshFormat(slot, view, quantization))
+                return false;
+            if (first != nullptr && (view.bufferView != first->bufferView || view.stride != first->stride))
+                return false;
+
+            if (first == nullptr)
+                first = &view;
+            minimumOffset = std::min(minimumOffset, view.byteOffset);
+        }
+
+        // Los atributos deben estar intercalados: todos dentro del stride de un mismo vértice
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            const AccessorView& view = plan.attributes[slot];
+            if ((plan.layout.attributes & ATTRIBUTE_FLAGS[slot]) &&
+                view.byteOffset - minimumOffset + view.elementSize > view.stride)
+                return false;
+        }
+
+        const unsigned char* start = first->data - (first->byteOffset - minimumOffset);
+        if (start + plan.layout.vertexCount * first->stride > first->bufferEnd)
+            return false;
+
+        plan.layout.quantization = quantization;
+        plan.layout.vertexStride = static_cast<GLsizei>(first->stride);
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (plan.layout.attributes & ATTRIBUTE_FLAGS[slot])
+                plan.layout.attributeOffsets[slot] = plan.attributes[slot].byteOffset - minimumOffset;
+        }
+        plan.vertexData = start;
+        return true;
+    }
+
+    void planConvertedVertexs(PrimitivePlan& plan)
+    {
+        size_t stride = 0;
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (plan.layout.attributes & ATTRIBUTE_FLAGS[slot]) {
+                plan.layout.attributeOffsets[slot] = stride;
+                stride += OUTPUT_COMPONENTS[slot] * sizeof(float);
+            }
+        }
+        plan.layout.quantization = MeshQuantization();
+        plan.layout.vertexStride = static_cast<GLsizei>(stride);
+        plan.convertedVertexs.resize(plan.layout.vertexBytes());
+        plan.vertexData = plan.convertedVertexs.data();
+        plan.convertVertexs = true;
+    }
+
+    bool planPrimitive(const JsonValue& json, const std::vector<BufferData>& buffers,
+                       const JsonValue& primitive, PrimitivePlan& plan)
+    {
+        if (primitive["mode"].asInt(TRIANGLES_MODE) != TRIANGLES_MODE) {
+            std::cerr << "ERROR::GLTF_LOADER::UNSUPPORTED_PRIMITIVE_MODE: " << primitive["mode"].asInt(0) << std::endl;
+            return false;
+        }
+
+        const JsonValue& attributes = primitive["attributes"];
+        if (!attributes.has("POSITION")) {
+            std::cerr << "ERROR::GLTF_LOADER::MISSING_POSITION" << std::endl;
+            return false;
+        }
+
+        plan.material = primitive["material"].asInt(-1);
+        plan.layout.attributes = VertexAttributes::POSITION;
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            const JsonValue& accessor = attributes[ATTRIBUTE_NAMES[slot]];
+            if (accessor.type != JsonValue::Type::NUMBER)
+                continue;
+            if (!readAccessor(json, buffers, accessor.asInt(-1), plan.attributes[slot]))
+                return false;
+            plan.layout.attributes = plan.layout.attributes | ATTRIBUTE_FLAGS[slot];
+        }
+
+        size_t vertexCount = plan.attributes[POSITION_SLOT].count;
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if ((plan.layout.attributes & ATTRIBUTE_FLAGS[slot]) && plan.attributes[slot].count != vertexCount) {
+                std::cerr << "ERROR::GLTF_LOADER::ATTRIBUTE_COUNT_MISMATCH: " << ATTRIBUTE_NAMES[slot] << std::endl;
+                return false;
+            }
+        }
+        if (vertexCount == 0)
+            return false;
+        plan.layout.vertexCount = static_cast<GLsizei>(vertexCount);
+
+        // min/max son obligatorios en POSITION; si faltan o el formato no es float se recorren los datos
+        const AccessorView& positions = plan.attributes[POSITION_SLOT];
+        const JsonValue& positionAccessor = json["accessors"][static_cast<size_t>(attributes["POSITION"].asInt(-1))];
+        if (positions.componentType == GL_FLOAT && !positions.sparse &&
+            positionAccessor["min"].size() == 3 && positionAccessor["max"].size() == 3) {
+            for (size_t c = 0; c < 3; ++c) {
+                plan.layout.boundsMin[c] = static_cast<float>(positionAccessor["min"][c].asNumber(0));
+                plan.layout.boundsMax[c] = static_cast<float>(positionAccessor["max"][c].asNumber(0));
+            }
+        }
+        else {
+            plan.layout.boundsMin = glm::vec3(std::numeric_limits<float>::max());
+            plan.layout.boundsMax = glm::vec3(-std::numeric_limits<float>::max());
+            for (size_t i = 0; i < vertexCount; ++i) {
+                glm::vec3 position(readComponent(positions, i, 0), readComponent(positions, i, 1),
+                                   readComponent(positions, i, 2));
+                plan.layout.boundsMin = glm::min(plan.layout.boundsMin, position);
+                plan.layout.boundsMax = glm::max(plan.layout.boundsMax, position);
+            }
+        }
+
+        if (!planZeroCopyVertexs(plan))
+            planConvertedVertexs(plan);
+
+        if (primitive.has("indices")) {
+            AccessorView& indices = plan.indices;
+            if (!readAccessor(json, buffers, primitive["indices"].asInt(-1), indices) || indices.components != 1 ||
+                (indices.componentType != GL_UNSIGNED_BYTE && indices.componentType != GL_UNSIGNED_SHORT &&
+                 indices.componentType != GL_UNSIGNED_INT) || indices.data == nullptr) {
+                std::cerr << "ERROR::GLTF_LOADER::INVALID_INDICES" << std::endl;
+                return false;
+            }
+
+            plan.layout.indexCount = static_cast<GLsizei>(indices.count);
+            if (indices.componentType != GL_UNSIGNED_BYTE && indices.stride == indices.elementSize && !indices.sparse) {
+                plan.layout.indexType = indices.componentType;
+                plan.indexData = indices.data;
+            }
+            else {
+                // 16 bits solo si todos los vértices son direccionables; si no, 32 bits
+                plan.layout.indexType = vertexCount <= 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+                plan.convertedIndexs.resize(plan.layout.indexBytes());
+                plan.indexData = plan.convertedIndexs.data();
+                plan.convertIndexs = true;
+            }
+        }
+        return true;
+    }
+
+    void convertVertexs(PrimitivePlan& plan, size_t first, size_t count)
+    {
+        const size_t stride = plan.layout.vertexStride;
+        for (size_t slot = 0; slot < SLOT_COUNT; ++slot) {
+            if (!(plan.layout.attributes & ATTRIBUTE_FLAGS[slot]))
+                continue;
+
+            const AccessorView& view = plan.attributes[slot];
+            unsigned char* destination = plan.convertedVertexs.data() + first * stride + plan.layout.attributeOffsets[slot];
+            for (size_t i = first; i < first + count; ++i, destination += stride) {
+                float values[4];
+                for (size_t c = 0; c < OUTPUT_COMPONENTS[slot]; ++c)
+                    values[c] = readComponent(view, i, static_cast<int>(c));
+                // COLOR_0 puede ser RGB; el alfa por defecto es 1
+                if (slot == COLOR_SLOT && view.components == 3)
+                    values[3] = 1.0f;
+                std::memcpy(destination, values, OUTPUT_COMPONENTS[slot] * sizeof(float));
+            }
+        }
+    }
+
+    void convertIndexs(PrimitivePlan& plan, size_t first, size_t count)
+    {
+        GLuint maximum = 0;
+        if (plan.layout.indexType == GL_UNSIGNED_SHORT) {
+            for (size_t i = first; i < first + count; ++i) {
+                GLuint value = readIndex(plan.indices, i);
+                maximum = std::max(maximum, value);
+                GLushort index = static_cast<GLushort>(value);
+                std::memcpy(plan.convertedIndexs.data() + i * sizeof(GLushort), &index, sizeof(index));
+            }
+        }
+        else {
+            for (size_t i = first; i < first + count; ++i) {
+                GLuint index = readIndex(plan.indices, i);
+                maximum = std::max(maximum, index);
+                std::memcpy(plan.convertedIndexs.data() + i * sizeof(GLuint), &index, sizeof(index));
+            }
+        }
+        plan.maxIndex = maximum;
+    }
+
+    /** Índice máximo de un buffer que se sube tal cual, para validarlo antes de llegar al EBO */
+    void scanIndexs(PrimitivePlan& plan, size_t first, size_t count)
+    {
+        GLuint maximum = 0;
+        for (size_t i = first; i < first + count; ++i)
+            maximum = std::max(maximum, readIndex(plan.indices, i));
+        plan.maxIndex = maximum;
+    }
+
+    // ------------------------------------------------------------------
+    // Archivos, materiales y nodos
+    // ------------------------------------------------------------------
+
+    std::string directoryOf(const std::string& path)
+    {
+        size_t slash = path.find_last_of("/\\");
+        return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+    }
+
+    /** Decodifica los %XX de una URI relativa */
+    std::string decodeUri(const std::string& uri)
+    {
+        std::string decoded;
+        decoded.reserve(uri.size());
+        for (size_t i = 0; i < uri.size(); ++i) {
+            if (uri[i] == '%' && i + 2 < uri.size()) {
+                int value = 0;
+                std::from_chars_result result = std::from_chars(uri.data() + i + 1, uri.data() + i + 3, value, 16);
+                if (result.ec == std::errc() && result.ptr == uri.data() + i + 3) {
+                    decoded += static_cast<char>(value);
+                    i += 2;
+                    continue;
+                }
+            }
+            decoded += uri[i];
+        }
+        return decoded;
+    }
+
+    /** Decodifica una data URI en base64; devuelve false si la URI no es de tipo data */
+    bool decodeDataUri(const std::string& uri, std::vector<unsigned char>& out)
+    {
+        if (uri.compare(0, 5, "data:") != 0)
+            return false;
+
+        size_t comma = uri.find(',');
+        if (comma == std::string::npos || uri.rfind(";base64", comma) == std::string::npos)
+            return false;
+
+        auto decodeChar = [](char c) -> int {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+') return 62;
+            if (c == '/') return 63;
+            return -1;
+        };
+
+        out.clear();
+        out.reserve((uri.size() - comma) * 3 / 4);
+        uint32_t accumulator = 0;
+        int bits = 0;
+        for (size_t i = comma + 1; i < uri.size(); ++i) {
+            int value = decodeChar(uri[i]);
+            if (value < 0)
+                continue;
+            accumulator = (accumulator << 6) | static_cast<uint32_t>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                out.push_back(static_cast<unsigned char>((accumulator >> bits) & 0xFF));
+            }
+        }
+        return true;
+    }
+
+    struct LoadContext {
+        const JsonValue& json;
+        const std::vector<BufferData>& buffers;
+        std::string directory;
+        std::vector<std::shared_ptr<Texture>> textures;
+    };
+
+    std::shared_ptr<Texture> loadTexture(LoadContext& context, int index)
+    {
+        const JsonValue& texture = context.json["textures"][static_cast<size_t>(index)];
+        if (index < 0 || texture.type != JsonValue::Type::OBJECT)
+            return nullptr;
+        if (context.textures[index])
+            return context.textures[index];
+
+        TextureParams params;
+        params.flipVertically = false;
+        const JsonValue& sampler = context.json["samplers"][static_cast<size_t>(texture["sampler"].asInt(-1))];
+        params.wrapS = static_cast<GLenum>(sampler["wrapS"].asInt(GL_REPEAT));
+        params.wrapT = static_cast<GLenum>(sampler["wrapT"].asInt(GL_REPEAT));
+        params.minFilter = static_cast<GLenum>(sampler["minFilter"].asInt(GL_LINEAR_MIPMAP_LINEAR));
+        params.magFilter = static_cast<GLenum>(sampler["magFilter"].asInt(GL_LINEAR));
+
+        const JsonValue& image = context.json["images"][static_cast<size_t>(texture["source"].asInt(-1))];
+        std::shared_ptr<Texture> result;
+        std::vector<unsigned char> decoded;
+        if (image.has("uri") && decodeDataUri(image["uri"].string, decoded)) {
+            result = std::make_shared<Texture>(decoded.data(), decoded.size(), params, image["name"].string.c_str());
+        }
+        else if (image.has("uri")) {
+            std::string path = context.directory + decodeUri(image["uri"].string);
+            result = std::make_shared<Texture>(path.c_str(), params);
+        }
+        else if (image.has("bufferView")) {
+            const JsonValue& bufferView = context.json["bufferViews"][static_cast<size_t>(image["bufferView"].asInt(-1))];
+            int buffer = bufferView["buffer"].asInt(-1);
+            size_t offset = static_cast<size_t>(bufferView["byteOffset"].asNumber(0));
+            size_t length = static_cast<size_t>(bufferView["byteLength"].asNumber(0));
+            if (buffer < 0 || static_cast<size_t>(buffer) >= context.buffers.size() ||
+                offset + length > context.buffers[buffer].size) {
+                std::cerr << "ERROR::GLTF_LOADER::INVALID_IMAGE: " << texture["source"].asInt(-1) << std::endl;
+                return nullptr;
+            }
+            result = std::make_shared<Texture>(context.buffers[buffer].data + offset, length, params,
+                                               image["name"].string.c_str());
+        }
+        else {
+            std::cerr << "ERROR::GLTF_LOADER::INVALID_IMAGE: " << texture["source"].asInt(-1) << std::endl;
+            return nullptr;
+        }
+
+        context.textures[index] = result;
+        return result;
+    }
+
+    Material loadMaterial(LoadContext& context, const JsonValue& source)
+    {
+        const JsonValue& pbr = source["pbrMetallicRoughness"];
+        glm::vec4 baseColor(1.0f);
+        for (size_t c = 0; c < 4; ++c)
+            baseColor[c] = static_cast<float>(pbr["baseColorFactor"][c].asNumber(1.0));
+        float metallic = static_cast<float>(pbr["metallicFactor"].asNumber(1.0));
+        float roughness = static_cast<float>(pbr["roughnessFactor"].asNumber(1.0));
+
+        // Equivalencia aproximada Beckmann -> Blinn-Phong: n = 2 / alpha^2 - 2, con alpha = rugosidad^2
+        float alpha = std::max(roughness * roughness, 0.01f);
+
+        Material material;
+        material.diffuse = glm::vec3(baseColor);
+        material.ambient = material.diffuse;
+        material.specular = glm::mix(glm::vec3(0.04f), material.diffuse, metallic);
+        material.shininess = std::clamp(2.0f / (alpha * alpha) - 2.0f, 1.0f, 256.0f);
+        material.diffuseMap = loadTexture(context, pbr["baseColorTexture"]["index"].asInt(-1));
+
+        const JsonValue& specular = source["extensions"]["KHR_materials_specular"];
+        int specularTexture = specular["specularColorTexture"]["index"].asInt(specular["specularTexture"]["index"].asInt(-1));
+        material.specularMap = loadTexture(context, specularTexture);
+        return material;
+    }
+
+    glm::mat4 nodeTransform(const JsonValue& node)
+    {
+        if (node["matrix"].size() == 16) {
+            float values[16];
+            for (size_t i = 0; i < 16; ++i)
+                values[i] = static_cast<float>(node["matrix"][i].asNumber(0.0));
+            return glm::make_mat4(values);
+        }
+
+        glm::vec3 translation(0.0f), scale(1.0f);
+        glm::quat rotation(1.0f, 0.0f, 0.0f, 0.0f);
+        for (int c = 0; c < 3; ++c) {
+            translation[c] = static_cast<float>(node["translation"][c].asNumber(0.0));
+            scale[c] = static_cast<float>(node["scale"][c].asNumber(1.0));
+        }
+        if (node["rotation"].size() == 4) {
+            rotation = glm::quat(static_cast<float>(node["rotation"][3].asNumber(1.0)),
+                                 static_cast<float>(node["rotation"][0].asNumber(0.0)),
+                                 static_cast<float>(node["rotation"][1].asNumber(0.0)),
+                                 static_cast<float>(node["rotation"][2].asNumber(0.0)));
+        }
+
+        return glm::translate(glm::mat4(1.0f), translation) * glm::mat4_cast(rotation) *
+               glm::scale(glm::mat4(1.0f), scale);
+    }
+
+    void loadNodes(const JsonValue& json, int sceneIndex, GltfModel& model)
+    {
+        const JsonValue& nodes = json["nodes"];
+        model.nodes.resize(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            GltfNode& node = model.nodes[i];
+            node.name = nodes[i]["name"].string;
+            node.local = nodeTransform(nodes[i]);
+            int mesh = nodes[i]["mesh"].asInt(-1);
+            node.mesh = mesh >= 0 && static_cast<size_t>(mesh) < model.meshRanges.size() ? mesh : -1;
+        }
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            for (const JsonValue& child : nodes[i]["children"].elements) {
+                size_t index = static_cast<size_t>(child.asInt(-1));
+                if (index < model.nodes.size() && model.nodes[index].parent < 0 && index != i)
+                    model.nodes[index].parent = static_cast<int>(i);
+            }
+        }
+
+        std::vector<size_t> roots;
+        const JsonValue& scene = json["scenes"][static_cast<size_t>(sceneIndex)];
+        if (scene.type == JsonValue::Type::OBJECT) {
+            for (const JsonValue& root : scene["nodes"].elements) {
+                size_t index = static_cast<size_t>(root.asInt(-1));
+                if (index < model.nodes.size())
+                    roots.push_back(index);
+            }
+        }
+        else {
+            for (size_t i = 0; i < model.nodes.size(); ++i) {
+                if (model.nodes[i].parent < 0)
+                    roots.push_back(i);
+            }
+        }
+
+        // Recorrido en profundidad: cada nodo se visita después de su padre
+        std::vector<bool> visited(model.nodes.size(), false);
+        std::vector<size_t> stack(roots.rbegin(), roots.rend());
+        while (!stack.empty()) {
+            size_t index = stack.back();
+            stack.pop_back();
+            if (visited[index])
+                continue;
+            visited[index] = true;
+
+            GltfNode& node = model.nodes[index];
+            node.world = node.parent >= 0 ? model.nodes[node.parent].world * node.local : node.local;
+            model.sceneNodes.push_back(index);
+
+            const std::vector<JsonValue>& children = nodes[index]["children"].elements;
+            for (auto child = children.rbegin(); child != children.rend(); ++child) {
+                size_t childIndex = static_cast<size_t>(child->asInt(-1));
+                if (childIndex < model.nodes.size() && model.nodes[childIndex].parent == static_cast<int>(index))
+                    stack.push_back(childIndex);
+            }
+        }
+    }
+
+    bool checkExtensions(const JsonValue& json)
+    {
+        static constexpr std::string_view SUPPORTED[] = { "KHR_mesh_quantization", "KHR_materials_specular" };
+
+        bool supported = true;
+        for (const JsonValue& extension : json["extensionsRequired"].elements) {
+            if (std::find(std::begin(SUPPORTED), std::end(SUPPORTED), extension.string) == std::end(SUPPORTED)) {
+                std::cerr << "ERROR::GLTF_LOADER::UNSUPPORTED_EXTENSION: " << extension.string << std::endl;
+                supported = false;
+            }
+        }
+        return supported;
+    }
+}
+
+GltfModel GltfLoader::load(const char* path, const GltfLoadParams& params)
+{
+    GltfModel model;
+
+    MappedFile file(path);
+    if (!file.isOpen())
+        return model;
+
+    // Un GLB contiene el JSON y el buffer binario en chunks; un .gltf es JSON puro
+    std::string_view text = file.view();
+    BufferData binaryChunk;
+    uint32_t header[3] = { 0, 0, 0 };
+    if (file.size() >= sizeof(header))
+        std::memcpy(header, file.data(), sizeof(header));
+
+    if (header[0] == GLB_MAGIC) {
+        size_t offset = sizeof(header);
+        text = std::string_view();
+        while (offset + 8 <= file.size()) {
+            uint32_t chunk[2];
+            std::memcpy(chunk, file.data() + offset, sizeof(chunk));
+            offset += sizeof(chunk);
+            if (offset + chunk[0] > file.size())
+                break;
+            if (chunk[1] == GLB_CHUNK_JSON && text.empty())
+                text = std::string_view(file.data() + offset, chunk[0]);
+            else if (chunk[1] == GLB_CHUNK_BIN && binaryChunk.data == nullptr)
+                binaryChunk = { reinterpret_cast<const unsigned char*>(file.data()) + offset, chunk[0] };
+            offset += chunk[0];
+        }
+        if (header[1] != 2 || text.empty()) {
+            std::cerr << "ERROR::GLTF_LOADER::INVALID_GLB: " << path << std::endl;
+            return model;
+        }
+    }
+
+    JsonValue json;
+    if (!JsonReader(text).parse(json) || json.type != JsonValue::Type::OBJECT) {
+        std::cerr << "ERROR::GLTF_LOADER::INVALID_JSON: " << path << std::endl;
+        return model;
+    }
+    if (json["asset"]["version"].string.compare(0, 2, "2.") != 0) {
+        std::cerr << "ERROR::GLTF_LOADER::UNSUPPORTED_VERSION: " << json["asset"]["version"].string << std::endl;
+        return model;
+    }
+    if (!checkExtensions(json))
+        return model;
+
+    const std::string directory = directoryOf(path);
+
+    // Los buffers externos también se proyectan; las proyecciones viven hasta crear las mallas
+    std::vector<BufferData> buffers(json["buffers"].size());
+    std::vector<std::unique_ptr<MappedFile>> mappedBuffers;
+    std::vector<std::vector<unsigned char>> decodedBuffers;
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        const JsonValue& buffer = json["buffers"][i];
+        size_t byteLength = static_cast<size_t>(buffer["byteLength"].asNumber(0));
+
+        if (!buffer.has("uri")) {
+            if (i == 0)
+                buffers[i] = binaryChunk;
+        }
+        else if (std::vector<unsigned char> decoded; decodeDataUri(buffer["uri"].string, decoded)) {
+            decodedBuffers.push_back(std::move(decoded));
+            buffers[i] = { decodedBuffers.back().data(), decodedBuffers.back().size() };
+        }
+        else {
+            std::string bufferPath = directory + decodeUri(buffer["uri"].string);
+            mappedBuffers.push_back(std::make_unique<MappedFile>(bufferPath.c_str()));
+            buffers[i] = { reinterpret_cast<const unsigned char*>(mappedBuffers.back()->data()), mappedBuffers.back()->size() };
+        }
+
+        if (buffers[i].size < byteLength) {
+            std::cerr << "ERROR::GLTF_LOADER::BUFFER_TOO_SMALL: " << i << std::endl;
+            buffers[i] = BufferData();
+        }
+        else {
+            buffers[i].size = byteLength;
+        }
+    }
+
+    // Planificación: decide por primitivo si los datos se suben tal cual o se convierten
+    std::vector<PrimitivePlan> plans;
+    const JsonValue& meshes = json["meshes"];
+    model.meshRanges.resize(meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        GltfMeshRange& range = model.meshRanges[i];
+        range.name = meshes[i]["name"].string;
+        range.first = plans.size();
+        for (const JsonValue& primitive : meshes[i]["primitives"].elements) {
+            PrimitivePlan plan;
+            if (planPrimitive(json, buffers, primitive, plan))
+                plans.push_back(std::move(plan));
+        }
+        range.count = plans.size() - range.first;
+    }
+
+    std::vector<ConversionTask> tasks;
+    for (size_t i = 0; i < plans.size(); ++i) {
+        if (plans[i].convertVertexs) {
+            for (size_t first = 0; first < static_cast<size_t>(plans[i].layout.vertexCount); first += VERTEX_CHUNK)
+                tasks.push_back({ i, first, std::min<size_t>(VERTEX_CHUNK, plans[i].layout.vertexCount - first), false });
+        }
+        if (plans[i].layout.indexCount > 0)
+            tasks.push_back({ i, 0, plans[i].indices.count, true });
+    }
+
+    unsigned threadCount = resolveThreadCount(params.threadCount);
+    parallelFor(tasks.size(), threadCount, [&](size_t t) {
+        const ConversionTask& task = tasks[t];
+        if (task.indices && plans[task.plan].convertIndexs)
+            convertIndexs(plans[task.plan], task.first, task.count);
+        else if (task.indices)
+            scanIndexs(plans[task.plan], task.first, task.count);
+        else
+            convertVertexs(plans[task.plan], task.first, task.count);
+    });
+
+    // Los materiales se cargan antes que las mallas para darles sus texturas
+    LoadContext context{ json, buffers, directory, std::vector<std::shared_ptr<Texture>>(json["textures"].size()) };
+    for (const JsonValue& material : json["materials"].elements)
+        model.materials.push_back(loadMaterial(context, material));
+
+    // Los primitivos con índices fuera de rango se descartan: sin un contexto
+    // robusto leerían más allá del VBO. Los rangos se recalculan sobre las mallas creadas
+    model.meshes.reserve(plans.size());
+    model.meshMaterials.reserve(plans.size());
+    for (GltfMeshRange& range : model.meshRanges) {
+        const size_t first = range.first;
+        const size_t count = range.count;
+        range.first = model.meshes.size();
+        for (size_t i = first; i < first + count; ++i) {
+            const PrimitivePlan& plan = plans[i];
+            if (plan.layout.indexCount > 0 && plan.maxIndex >= static_cast<GLuint>(plan.layout.vertexCount)) {
+                std::cerr << "ERROR::GLTF_LOADER::INVALID_INDICES: Index " << plan.maxIndex << " out of range ("
+                          << plan.layout.vertexCount << " vertices) in mesh " << range.name << std::endl;
+                continue;
+            }
+
+            const int material = plan.material >= 0 && static_cast<size_t>(plan.material) < model.materials.size()
+                                 ? plan.material : -1;
+            std::vector<Texture*> textures;
+            if (material >= 0) {
+                if (model.materials[material].diffuseMap)
+                    textures.push_back(model.materials[material].diffuseMap.get());
+                if (model.materials[material].specularMap)
+                    textures.push_back(model.materials[material].specularMap.get());
+            }
+
+            model.meshes.emplace_back(plan.layout, plan.vertexData, plan.indexData, textures);
+            model.meshMaterials.push_back(material);
+
+            ++(plan.convertVertexs ? model.stats.convertedVertexBuffers : model.stats.zeroCopyVertexBuffers);
+            if (plan.layout.indexCount > 0)
+                ++(plan.convertIndexs ? model.stats.convertedIndexBuffers : model.stats.zeroCopyIndexBuffers);
+        }
+        range.count = model.meshes.size() - range.first;
+    }
+
+    loadNodes(json, params.scene >= 0 ? params.scene : json["scene"].asInt(0), model);
+    return model;
+}
@@ -1,16 +1,93 @@
 #include "engine/graphics/mesh.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include "engine/graphics/vertex_welder.hpp"
 #include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtc/packing.hpp>
+#include <glm/gtc/matrix_transform.hpp>
 
 using namespace engine::graphics;
 using namespace engine::core;   
 
 
+namespace {
+
+    enum AttributeSlot { POSITION_SLOT = 0, COLOR_SLOT, TEXCOORDS_SLOT, NORMAL_SLOT };
+
+    bool isQuantized(const MeshQuantization& quantization)
+    {
+        return quantization.position != PositionFormat::FLOAT ||
+               quantization.octahedralNormals ||
+               quantization.unorm8Colors ||
+               quantization.unorm16TexCoords;
+    }
+
+    size_t alignTo4(size_t bytes)
+    {
+        return (bytes + 3) & ~size_t(3);
+    }
+
+    GLushort toUnorm16(float value)
+    {
+        return static_cast<GLushort>(std::round(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    GLshort toSnorm16(float value)
+    {
+        return static_cast<GLshort>(std::round(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    GLubyte toUnorm8(float value)
+    {
+        return static_cast<GLubyte>(std::round(std::clamp(value, 0.0f, 1.0f) * 255.0f));
+    }
+
+    glm::vec2 encodeOctahedral(glm::vec3 normal)
+    {
+        float length = std::abs(normal.x) + std::abs(normal.y) + std::abs(normal.z);
+        if (length == 0.0f)
+            return glm::vec2(0.0f);
+
+        normal /= length;
+        glm::vec2 encoded(normal.x, normal.y);
+        if (normal.z < 0.0f) {
+            encoded = glm::vec2((1.0f - std::abs(normal.y)) * (normal.x >= 0.0f ? 1.0f : -1.0f),
+                                (1.0f - std::abs(normal.x)) * (normal.y >= 0.0f ? 1.0f : -1.0f));
+        }
+        return encoded;
+    }
+
+    template <typename T, size_t N>
+    void writeComponents(unsigned char* destination, const T (&components)[N])
+    {
+        std::memcpy(destination, components, sizeof(components));
+    }
+
+} // namespace
+
 void Mesh::setupPositionAttribute(GLuint location) 
 {
+    GLenum type = GL_FLOAT;
+    GLboolean normalized = GL_FALSE;
+    if (m_quantization.position == PositionFormat::HALF_FLOAT) {
+        type = GL_HALF_FLOAT;
+    }
+    else if (m_quantization.position == PositionFormat::UNORM16) {
+        type = GL_UNSIGNED_SHORT;
+        normalized = GL_TRUE;
+    }
+
     glVertexAttribPointer(location, 3,
-                          GL_FLOAT, 
-                          GL_FALSE,
-                          sizeof(Vertex), (void*)0);
+                          type, 
+                          normalized,
+                          m_vertexStride,
+                          (void*)m_attributeOffsets[POSITION_SLOT]);
     glEnableVertexAttribArray(location);
 }
 
@@ -18,61 +95,304 @@ void Mesh::setupPositionAttribute(GLuint location)
 void Mesh::setupColorAttribute(GLuint location)
 {
     glVertexAttribPointer(location, 4,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, m_color));
+                          m_quantization.unorm8Colors ? GL_UNSIGNED_BYTE : GL_FLOAT,
+                          m_quantization.unorm8Colors ? GL_TRUE : GL_FALSE,
+                          m_vertexStride,
+                          (void*)m_attributeOffsets[COLOR_SLOT]);
     glEnableVertexAttribArray(location);
 }
 
 void Mesh::setupTexCoordsAttribute(GLuint location)
 {
     glVertexAttribPointer(location, 2,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, m_texCoords));
+                          m_quantization.unorm16TexCoords ? GL_UNSIGNED_SHORT : GL_FLOAT,
+                          m_quantization.unorm16TexCoords ? GL_TRUE : GL_FALSE,
+                          m_vertexStride,
+                          (void*)m_attributeOffsets[TEXCOORDS_SLOT]);
     glEnableVertexAttribArray(location);
 }
 
 void Mesh::setupNormalAttribute(GLuint location) 
 {
-    glVertexAttribPointer(location, 3,
-                          GL_FLOAT,
-                          GL_FALSE,
-                          sizeof(Vertex),
-                          (void*)offsetof(Vertex, m_normal));
+    if (m_quantization.octahedralNormals) {
+        glVertexAttribPointer(location, 2,
+                              GL_SHORT,
+                              GL_TRUE,
+                              m_vertexStride,
+                              (void*)m_attributeOffsets[NORMAL_SLOT]);
+    }
+    else {
+        glVertexAttribPointer(location, 3,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              m_vertexStride,
+                              (void*)m_attributeOffsets[NORMAL_SLOT]);
+    }
     glEnableVertexAttribArray(location);
 }
 
 Mesh::Mesh(const std::vector<Vertex>& vertexs, 
            const std::vector<GLuint>& indexs, 
            const std::vector<Texture*>& textures)
-    : m_vertexs(vertexs)
-    , m_indexs(indexs)
-    , m_textures(textures)
-    , m_attributes(VertexAttributes::POSITION)
+    : Mesh(std::vector<Vertex>(vertexs), std::vector<GLuint>(indexs), textures)
 {
-    setup();
 }
 
 Mesh::Mesh(const std::vector<Vertex>& vertexs, 
            const std::vector<GLuint>& indexs, 
            const std::vector<Texture*>& textures,
            const VertexAttributes attributes)
-    : m_vertexs(vertexs)
-    , m_indexs(indexs)
+    : Mesh(std::vector<Vertex>(vertexs), std::vector<GLuint>(indexs), textures, attributes)
+{
+}
+
+Mesh::Mesh(const std::vector<Vertex>& vertexs, 
+           const std::vector<GLuint>& indexs, 
+           const std::vector<Texture*>& textures,
+           const VertexAttributes attributes,
+           const MeshQuantization& quantization,
+           MeshResidency residency)
+    : Mesh(std::vector<Vertex>(vertexs), std::vector<GLuint>(indexs), textures, attributes, quantization, residency)
+{
+}
+
+Mesh::Mesh(std::vector<Vertex>&& vertexs, 
+           std::vector<GLuint>&& indexs, 
+           const std::vector<Texture*>& textures,
+           const VertexAttributes attributes,
+           const MeshQuantization& quantization,
+           MeshResidency residency)
+    : m_vertexs(std::move(vertexs))
+    , m_indexs(std::move(indexs))
     , m_textures(textures)
+    , m_VAO(0)
+    , m_VBO(0)
+    , m_EBO(0)
+    , m_vertexCount(static_cast<GLsizei>(m_vertexs.size()))
+    , m_indexCount(static_cast<GLsizei>(m_indexs.size()))
+    , m_baseVertex(0)
+    , m_indexOffset(0)
+    , m_ownsBuffers(true)
+    , m_instanceVBO(0)
+    , m_instanceCapacity(0)
     , m_attributes(attributes)
+    , m_quantization(quantization)
+    , m_indexType(GL_UNSIGNED_INT)
+    , m_vertexStride(sizeof(Vertex))
+    , m_attributeOffsets{0, offsetof(Vertex, m_color), offsetof(Vertex, m_texCoords), offsetof(Vertex, m_normal)}
+    , m_positionScale(1.0f)
+    , m_positionOffset(0.0f)
+    , m_boundsMin(0.0f)
+    , m_boundsMax(0.0f)
+    , m_residency(residency)
 {
+    if (m_indexs.empty() && !m_vertexs.empty()) {
+        m_indexs = VertexWelder::weld(m_vertexs);
+        m_vertexCount = static_cast<GLsizei>(m_vertexs.size());
+        m_indexCount = static_cast<GLsizei>(m_indexs.size());
+    }
+
     setup();
+
+    if (m_residency == MeshResidency::GPU_ONLY) {
+        std::vector<Vertex>().swap(m_vertexs);
+        std::vector<GLuint>().swap(m_indexs);
+    }
+}
+
+Mesh::Mesh(const MeshGpuLayout& layout,
+           const void* vertexData,
+           const void* indexData,
+           const std::vector<Texture*>& textures)
+    : m_textures(textures)
+    , m_VAO(0)
+    , m_VBO(0)
+    , m_EBO(0)
+    , m_vertexCount(layout.vertexCount)
+    , m_indexCount(layout.indexCount)
+    , m_baseVertex(0)
+    , m_indexOffset(0)
+    , m_ownsBuffers(true)
+    , m_instanceVBO(0)
+    , m_instanceCapacity(0)
+    , m_attributes(layout.attributes)
+    , m_quantization(layout.quantization)
+    , m_indexType(layout.indexType)
+    , m_vertexStride(layout.vertexStride)
+    , m_attributeOffsets{layout.attributeOffsets[0], layout.attributeOffsets[1],
+                         layout.attributeOffsets[2], layout.attributeOffsets[3]}
+    , m_positionScale(layout.positionScale)
+    , m_positionOffset(layout.positionOffset)
+    , m_boundsMin(layout.boundsMin)
+    , m_boundsMax(layout.boundsMax)
+    , m_residency(MeshResidency::GPU_ONLY)
+{
+    glGenVertexArrays(1, &m_VAO);
+    GLStateCache::bindVertexArray(m_VAO);
+
+    glGenBuffers(1, &m_VBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferStorage(GL_ARRAY_BUFFER, layout.vertexBytes(), vertexData, 0);
+
+    if (layout.indexCount > 0) {
+        glGenBuffers(1, &m_EBO);
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+        glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, layout.indexBytes(), indexData, 0);
+    }
+
+    setupAttributes();
+
+    GLStateCache::bindVertexArray(0);
+}
+
+Mesh::Mesh(StreamBuffer& vertexStream,
+           StreamBuffer* indexStream,
+           const std::vector<Texture*>& textures,
+           const VertexAttributes attributes)
+    : m_textures(textures)
+    , m_VBO(vertexStream.ID())
+    , m_EBO(indexStream ? indexStream->ID() : 0)
+    , m_vertexCount(0)
+    , m_indexCount(0)
+    , m_baseVertex(0)
+    , m_indexOffset(0)
+    , m_ownsBuffers(false)
+    , m_instanceVBO(0)
+    , m_instanceCapacity(0)
+    , m_attributes(attributes)
+    , m_quantization()
+    , m_indexType(GL_UNSIGNED_INT)
+    , m_vertexStride(sizeof(Vertex))
+    , m_attributeOffsets{0, offsetof(Vertex, m_color), offsetof(Vertex, m_texCoords), offsetof(Vertex, m_normal)}
+    , m_positionScale(1.0f)
+    , m_positionOffset(0.0f)
+    , m_boundsMin(-std::numeric_limits<float>::max())
+    , m_boundsMax(std::numeric_limits<float>::max())
+    , m_residency(MeshResidency::GPU_ONLY)
+{
+    setup();
+}
+
+Mesh::Mesh(GLuint vertexBuffer,
+           GLuint indexBuffer,
+           const MeshGpuLayout& layout,
+           const std::vector<Texture*>& textures)
+    : m_textures(textures)
+    , m_VBO(vertexBuffer)
+    , m_EBO(indexBuffer)
+    , m_vertexCount(layout.vertexCount)
+    , m_indexCount(indexBuffer != 0 ? layout.indexCount : 0)
+    , m_baseVertex(layout.baseVertex)
+    , m_indexOffset(layout.indexOffset)
+    , m_ownsBuffers(false)
+    , m_instanceVBO(0)
+    , m_instanceCapacity(0)
+    , m_attributes(layout.attributes)
+    , m_quantization(layout.quantization)
+    , m_indexType(layout.indexType)
+    , m_vertexStride(layout.vertexStride)
+    , m_attributeOffsets{layout.attributeOffsets[0], layout.attributeOffsets[1],
+                         layout.attributeOffsets[2], layout.attributeOffsets[3]}
+    , m_positionScale(layout.positionScale)
+    , m_positionOffset(layout.positionOffset)
+    , m_boundsMin(layout.boundsMin)
+    , m_boundsMax(layout.boundsMax)
+    , m_residency(MeshResidency::GPU_ONLY)
+{
+    setup();
+}
+
+Mesh::Mesh(Mesh&& other) noexcept
+    : m_vertexs(std::move(other.m_vertexs))
+    , m_indexs(std::move(other.m_indexs))
+    , m_textures(std::move(other.m_textures))
+    , m_VAO(std::exchange(other.m_VAO, 0))
+    , m_VBO(std::exchange(other.m_VBO, 0))
+    , m_EBO(std::exchange(other.m_EBO, 0))
+    , m_vertexCount(std::exchange(other.m_vertexCount, 0))
+    , m_indexCount(std::exchange(other.m_indexCount, 0))
+    , m_baseVertex(other.m_baseVertex)
+    , m_indexOffset(other.m_indexOffset)
+    , m_ownsBuffers(other.m_ownsBuffers)
+    , m_instanceVBO(std::exchange(other.m_instanceVBO, 0))
+    , m_instanceCapacity(std::exchange(other.m_instanceCapacity, 0))
+    , m_attributes(other.m_attributes)
+    , m_quantization(other.m_quantization)
+    , m_indexType(other.m_indexType)
+    , m_vertexStride(other.m_vertexStride)
+    , m_attributeOffsets{other.m_attributeOffsets[0], other.m_attributeOffsets[1],
+                         other.m_attributeOffsets[2], other.m_attributeOffsets[3]}
+    , m_positionScale(other.m_positionScale)
+    , m_positionOffset(other.m_positionOffset)
+    , m_boundsMin(other.m_boundsMin)
+    , m_boundsMax(other.m_boundsMax)
+    , m_residency(other.m_residency)
+    , m_rangeCounts(std::move(other.m_rangeCounts))
+    , m_rangeOffsets(std::move(other.m_rangeOffsets))
+    , m_rangeBaseVertices(std::move(other.m_rangeBaseVertices))
+{
+}
+
+Mesh& Mesh::operator=(Mesh&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    release();
+
+    m_vertexs = std::move(other.m_vertexs);
+    m_indexs = std::move(other.m_indexs);
+    m_textures = std::move(other.m_textures);
+    m_VAO = std::exchange(other.m_VAO, 0);
+    m_VBO = std::exchange(other.m_VBO, 0);
+    m_EBO = std::exchange(other.m_EBO, 0);
+    m_vertexCount = std::exchange(other.m_vertexCount, 0);
+    m_indexCount = std::exchange(other.m_indexCount, 0);
+    m_baseVertex = other.m_baseVertex;
+    m_indexOffset = other.m_indexOffset;
+    m_ownsBuffers = other.m_ownsBuffers;
+    m_instanceVBO = std::exchange(other.m_instanceVBO, 0);
+    m_instanceCapacity = std::exchange(other.m_instanceCapacity, 0);
+    m_attributes = other.m_attributes;
+    m_quantization = other.m_quantization;
+    m_indexType = other.m_indexType;
+    m_vertexStride = other.m_vertexStride;
+    std::copy(std::begin(other.m_attributeOffsets), std::end(other.m_attributeOffsets), m_attributeOffsets);
+    m_positionScale = other.m_positionScale;
+    m_positionOffset = other.m_positionOffset;
+    m_boundsMin = other.m_boundsMin;
+    m_boundsMax = other.m_boundsMax;
+    m_residency = other.m_residency;
+    m_rangeCounts = std::move(other.m_rangeCounts);
+    m_rangeOffsets = std::move(other.m_rangeOffsets);
+    m_rangeBaseVertices = std::move(other.m_rangeBaseVertices);
+
+    return *this;
 }
 
 Mesh::~Mesh()
 {
-    glDeleteBuffers(1, &m_VBO);
-    glDeleteBuffers(1, &m_EBO);
-    glDeleteVertexArrays(1, &m_VAO);
+    release();
+}
+
+void Mesh::release()
+{
+    if (m_ownsBuffers) {
+        if (m_VBO != 0)
+            GLStateCache::deleteBuffer(m_VBO);
+        if (m_EBO != 0)
+            GLStateCache::deleteBuffer(m_EBO);
+    }
+    if (m_instanceVBO != 0)
+        GLStateCache::deleteBuffer(m_instanceVBO);
+    if (m_VAO != 0)
+        GLStateCache::deleteVertexArray(m_VAO);
+
+    m_VAO = 0;
+    m_VBO = 0;
+    m_EBO = 0;
+    m_instanceVBO = 0;
+    m_instanceCapacity = 0;
 }
 
 void Mesh::draw(const Shader& shader)
@@ -82,35 +402,201 @@ void Mesh::draw(const Shader& shader)
         m_textures[i]->bind(GL_TEXTURE0 + i);
     }
 
-    glBindVertexArray(m_VAO);
-    if (m_indexs.size() != 0)
-        glDrawElements(GL_TRIANGLES, m_indexs.size(), GL_UNSIGNED_INT, 0);
+    GLStateCache::bindVertexArray(m_VAO);
+    if (m_indexCount != 0)
+        glDrawElementsBaseVertex(GL_TRIANGLES, m_indexCount, m_indexType,
+                                 (void*)m_indexOffset, m_baseVertex);
+    else
+        glDrawArrays(GL_TRIANGLES, m_baseVertex, m_vertexCount);
+}
+
+void Mesh::drawRanges(const Shader& shader, std::span<const IndexRange> ranges)
+{
+    if (ranges.empty() || m_indexCount == 0)
+        return;
+
+    const size_t indexSize = m_indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+    m_rangeCounts.clear();
+    m_rangeOffsets.clear();
+    for (const IndexRange& range : ranges) {
+        m_rangeCounts.push_back(range.indexCount);
+        m_rangeOffsets.push_back((const void*)(m_indexOffset + range.firstIndex * indexSize));
+    }
+    m_rangeBaseVertices.assign(ranges.size(), m_baseVertex);
+
+    shader.use();
+    for (GLuint i = 0; i < m_textures.size(); ++i) {
+        m_textures[i]->bind(GL_TEXTURE0 + i);
+    }
+
+    GLStateCache::bindVertexArray(m_VAO);
+    glMultiDrawElementsBaseVertex(GL_TRIANGLES, m_rangeCounts.data(), m_indexType,
+                                  m_rangeOffsets.data(), static_cast<GLsizei>(ranges.size()),
+                                  m_rangeBaseVertices.data());
+}
+
+void Mesh::drawInstanced(const Shader& shader,
+                         std::span<const glm::mat4> models,
+                         std::span<const glm::mat3> normalMatrices,
+                         std::span<const glm::vec4> tints)
+{
+    if (models.empty())
+        return;
+
+    if ((!normalMatrices.empty() && normalMatrices.size() != models.size()) ||
+        (!tints.empty() && tints.size() != models.size())) {
+        std::cerr << "ERROR::MESH::INSTANCE_COUNT_MISMATCH: "
+                  << models.size() << " models, "
+                  << normalMatrices.size() << " normal matrices, "
+                  << tints.size() << " tints" << std::endl;
+        return;
+    }
+
+    shader.use();
+    for (GLuint i = 0; i < m_textures.size(); ++i) {
+        m_textures[i]->bind(GL_TEXTURE0 + i);
+    }
+
+    GLStateCache::bindVertexArray(m_VAO);
+    uploadInstances(models, normalMatrices, tints);
+
+    GLsizei count = static_cast<GLsizei>(models.size());
+    if (m_indexCount != 0)
+        glDrawElementsInstancedBaseVertex(GL_TRIANGLES, m_indexCount, m_indexType,
+                                          (void*)m_indexOffset, count, m_baseVertex);
     else
-        glDrawArrays(GL_TRIANGLES, 0, m_vertexs.size());
-    glBindVertexArray(0);
+        glDrawArraysInstanced(GL_TRIANGLES, m_baseVertex, m_vertexCount, count);
+}
+
+void Mesh::uploadInstances(std::span<const glm::mat4> models,
+                           std::span<const glm::mat3> normalMatrices,
+                           std::span<const glm::vec4> tints)
+{
+    const GLsizeiptr modelBytes = models.size_bytes();
+    const GLsizeiptr normalBytes = normalMatrices.size_bytes();
+    const GLsizeiptr tintBytes = tints.size_bytes();
+    const GLsizeiptr totalBytes = modelBytes + normalBytes + tintBytes;
 
-    glActiveTexture(GL_TEXTURE0);
+    if (m_instanceVBO == 0)
+        glGenBuffers(1, &m_instanceVBO);
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_instanceVBO);
+    if (totalBytes > m_instanceCapacity)
+        m_instanceCapacity = std::max(totalBytes, m_instanceCapacity * 2);
+
+    // Orphaning: el driver entrega almacenamiento nuevo en lugar de esperar
+    // a que terminen los draws que aún leen el contenido anterior.
+    glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity, nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, modelBytes, models.data());
+    if (normalBytes > 0)
+        glBufferSubData(GL_ARRAY_BUFFER, modelBytes, normalBytes, normalMatrices.data());
+    if (tintBytes > 0)
+        glBufferSubData(GL_ARRAY_BUFFER, modelBytes + normalBytes, tintBytes, tints.data());
+
+    for (GLuint column = 0; column < 4; ++column) {
+        GLuint location = INSTANCE_MODEL_LOCATION + column;
+        glVertexAttribPointer(location, 4,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(glm::mat4),
+                              (void*)(column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(location, 1);
+        glEnableVertexAttribArray(location);
+    }
+
+    for (GLuint column = 0; column < 3; ++column) {
+        GLuint location = INSTANCE_NORMAL_LOCATION + column;
+        if (normalBytes > 0) {
+            glVertexAttribPointer(location, 3,
+                                  GL_FLOAT,
+                                  GL_FALSE,
+                                  sizeof(glm::mat3),
+                                  (void*)(modelBytes + column * sizeof(glm::vec3)));
+            glVertexAttribDivisor(location, 1);
+            glEnableVertexAttribArray(location);
+        }
+        else {
+            glDisableVertexAttribArray(location);
+            glm::vec3 identity(0.0f);
+            identity[column] = 1.0f;
+            glVertexAttrib3fv(location, glm::value_ptr(identity));
+        }
+    }
+
+    if (tintBytes > 0) {
+        glVertexAttribPointer(INSTANCE_TINT_LOCATION, 4,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(glm::vec4),
+                              (void*)(modelBytes + normalBytes));
+        glVertexAttribDivisor(INSTANCE_TINT_LOCATION, 1);
+        glEnableVertexAttribArray(INSTANCE_TINT_LOCATION);
+    }
+    else {
+        glDisableVertexAttribArray(INSTANCE_TINT_LOCATION);
+        glVertexAttrib4f(INSTANCE_TINT_LOCATION, 1.0f, 1.0f, 1.0f, 1.0f);
+    }
+}
+
+void Mesh::setStreamRange(GLint firstVertex, GLsizei vertexCount,
+                          GLintptr indexOffset, GLsizei indexCount)
+{
+    if (m_ownsBuffers)
+        return;
+
+    m_baseVertex = firstVertex;
+    m_vertexCount = vertexCount;
+    m_indexOffset = indexOffset;
+    m_indexCount = m_EBO != 0 ? indexCount : 0;
 }
 
 void Mesh::setup() {
     glGenVertexArrays(1, &m_VAO);
-    glGenBuffers(1, &m_VBO);
-    glGenBuffers(1, &m_EBO);
+    GLStateCache::bindVertexArray(m_VAO);
 
-    glBindVertexArray(m_VAO);
+    if (m_ownsBuffers) {
+        if (!m_vertexs.empty()) {
+            m_boundsMin = m_vertexs[0].m_position;
+            m_boundsMax = m_vertexs[0].m_position;
+            for (const Vertex& vertex : m_vertexs) {
+                m_boundsMin = glm::min(m_boundsMin, vertex.m_position);
+                m_boundsMax = glm::max(m_boundsMax, vertex.m_position);
+            }
+        }
 
-    glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-    glBufferData(GL_ARRAY_BUFFER,
-                 m_vertexs.size() * sizeof(Vertex),
-                 m_vertexs.data(),
-                 GL_STATIC_DRAW);
-    
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER,
-                 m_indexs.size() * sizeof(GLuint),
-                 m_indexs.data(),
-                 GL_STATIC_DRAW);
+        glGenBuffers(1, &m_VBO);
+        glGenBuffers(1, &m_EBO);
+
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        if (isQuantized(m_quantization)) {
+            std::vector<unsigned char> packed = packVertices();
+            glBufferData(GL_ARRAY_BUFFER,
+                         packed.size(),
+                         packed.data(),
+                         GL_STATIC_DRAW);
+        }
+        else {
+            glBufferData(GL_ARRAY_BUFFER,
+                         m_vertexs.size() * sizeof(Vertex),
+                         m_vertexs.data(),
+                         GL_STATIC_DRAW);
+        }
+
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+        uploadIndices();
+    }
+    else {
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+        GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    }
     
+    setupAttributes();
+
+    GLStateCache::bindVertexArray(0);
+}
+
+void Mesh::setupAttributes()
+{
     GLuint currentLocation = 0;
 
     if (hasPosition())
@@ -121,8 +607,237 @@ void Mesh::setup() {
         setupTexCoordsAttribute(currentLocation++);
     if (hasNormal()) 
         setupNormalAttribute(currentLocation++);
+}
+
+std::vector<unsigned char> Mesh::packVertices()
+{
+    if (hasTexCoords() && m_quantization.unorm16TexCoords) {
+        bool inRange = std::all_of(m_vertexs.begin(), m_vertexs.end(), [](const Vertex& vertex) {
+            return vertex.m_texCoords.x >= 0.0f && vertex.m_texCoords.x <= 1.0f &&
+                   vertex.m_texCoords.y >= 0.0f && vertex.m_texCoords.y <= 1.0f;
+        });
+        if (!inRange) {
+            std::cerr << "ERROR::MESH::QUANTIZATION::TEXCOORDS_OUT_OF_RANGE: "
+                      << "Keeping float texture coordinates" << std::endl;
+            m_quantization.unorm16TexCoords = false;
+        }
+    }
+
+    if (hasPosition() && m_quantization.position == PositionFormat::UNORM16 && !m_vertexs.empty()) {
+        glm::vec3 minimum = m_vertexs[0].m_position;
+        glm::vec3 maximum = m_vertexs[0].m_position;
+        for (const Vertex& vertex : m_vertexs) {
+            minimum = glm::min(minimum, vertex.m_position);
+            maximum = glm::max(maximum, vertex.m_position);
+        }
+
+        glm::vec3 extent = maximum - minimum;
+        m_positionOffset = minimum;
+        m_positionScale = glm::vec3(extent.x > 0.0f ? extent.x : 1.0f,
+                                    extent.y > 0.0f ? extent.y : 1.0f,
+                                    extent.z > 0.0f ? extent.z : 1.0f);
+    }
 
-    glBindVertexArray(0);
+    // Cada atributo se alinea a 4 bytes, como exige OpenGL para un rendimiento óptimo
+    size_t stride = 0;
+    if (hasPosition()) {
+        m_attributeOffsets[POSITION_SLOT] = stride;
+        stride += m_quantization.position == PositionFormat::FLOAT ? 3 * sizeof(float) : alignTo4(3 * sizeof(GLushort));
+    }
+    if (hasColor()) {
+        m_attributeOffsets[COLOR_SLOT] = stride;
+        stride += m_quantization.unorm8Colors ? 4 * sizeof(GLubyte) : 4 * sizeof(float);
+    }
+    if (hasTexCoords()) {
+        m_attributeOffsets[TEXCOORDS_SLOT] = stride;
+        stride += m_quantization.unorm16TexCoords ? 2 * sizeof(GLushort) : 2 * sizeof(float);
+    }
+    if (hasNormal()) {
+        m_attributeOffsets[NORMAL_SLOT] = stride;
+        stride += m_quantization.octahedralNormals ? 2 * sizeof(GLshort) : 3 * sizeof(float);
+    }
+    m_vertexStride = static_cast<GLsizei>(stride);
+
+    std::vector<unsigned char> packed(m_vertexs.size() * stride, 0);
+    for (size_t i = 0; i < m_vertexs.size(); ++i) {
+        const Vertex& vertex = m_vertexs[i];
+        unsigned char* destination = packed.data() + i * stride;
+
+        if (hasPosition()) {
+            unsigned char* position = destination + m_attributeOffsets[POSITION_SLOT];
+            if (m_quantization.position == PositionFormat::HALF_FLOAT) {
+                GLushort halfs[3] = {
+                    glm::packHalf1x16(vertex.m_position.x),
+                    glm::packHalf1x16(vertex.m_position.y),
+                    glm::packHalf1x16(vertex.m_position.z)
+                };
+                writeComponents(position, halfs);
+            }
+            else if (m_quantization.position == PositionFormat::UNORM16) {
+                glm::vec3 normalized = (vertex.m_position - m_positionOffset) / m_positionScale;
+                GLushort unorms[3] = { toUnorm16(normalized.x), toUnorm16(normalized.y), toUnorm16(normalized.z) };
+                writeComponents(position, unorms);
+            }
+            else {
+                std::memcpy(position, &vertex.m_position, sizeof(vertex.m_position));
+            }
+        }
+
+        if (hasColor()) {
+            unsigned char* color = destination + m_attributeOffsets[COLOR_SLOT];
+            if (m_quantization.unorm8Colors) {
+                GLubyte unorms[4] = {
+                    toUnorm8(vertex.m_color.r), toUnorm8(vertex.m_color.g),
+                    toUnorm8(vertex.m_color.b), toUnorm8(vertex.m_color.a)
+                };
+                writeComponents(color, unorms);
+            }
+            else {
+                std::memcpy(color, &vertex.m_color, sizeof(vertex.m_color));
+            }
+        }
+
+        if (hasTexCoords()) {
+            unsigned char* texCoords = destination + m_attributeOffsets[TEXCOORDS_SLOT];
+            if (m_quantization.unorm16TexCoords) {
+                GLushort unorms[2] = { toUnorm16(vertex.m_texCoords.x), toUnorm16(vertex.m_texCoords.y) };
+                writeComponents(texCoords, unorms);
+            }
+            else {
+                std::memcpy(texCoords, &vertex.m_texCoords, sizeof(vertex.m_texCoords));
+            }
+        }
+
+        if (hasNormal()) {
+            unsigned char* normal = destination + m_attributeOffsets[NORMAL_SLOT];
+            if (m_quantization.octahedralNormals) {
+                glm::vec2 encoded = encodeOctahedral(vertex.m_normal);
+                GLshort snorms[2] = { toSnorm16(encoded.x), toSnorm16(encoded.y) };
+                writeComponents(normal, snorms);
+            }
+            else {
+                std::memcpy(normal, &vertex.m_normal, sizeof(vertex.m_normal));
+            }
+        }
+    }
+
+    return packed;
+}
+
+void Mesh::uploadIndices()
+{
+    if (m_vertexs.size() < 65536 && m_residency == MeshResidency::GPU_ONLY) {
+        // La copia en CPU se descarta tras la subida: se compacta in situ.
+        // Escribir el índice i en el byte 2i nunca pisa un índice aún no leído (byte 4i).
+        unsigned char* bytes = reinterpret_cast<unsigned char*>(m_indexs.data());
+        for (size_t i = 0; i < m_indexs.size(); ++i) {
+            GLushort index = static_cast<GLushort>(m_indexs[i]);
+            std::memcpy(bytes + i * sizeof(GLushort), &index, sizeof(GLushort));
+        }
+        m_indexType = GL_UNSIGNED_SHORT;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     m_indexs.size() * sizeof(GLushort),
+                     bytes,
+                     GL_STATIC_DRAW);
+    }
+    else if (m_vertexs.size() < 65536) {
+        std::vector<GLushort> shortIndexs(m_indexs.begin(), m_indexs.end());
+        m_indexType = GL_UNSIGNED_SHORT;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     shortIndexs.size() * sizeof(GLushort),
+                     shortIndexs.data(),
+                     GL_STATIC_DRAW);
+    }
+    else {
+        m_indexType = GL_UNSIGNED_INT;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER,
+                     m_indexs.size() * sizeof(GLuint),
+                     m_indexs.data(),
+                     GL_STATIC_DRAW);
+    }
+}
+
+glm::mat4 Mesh::positionDequantization() const
+{
+    if (m_quantization.position != PositionFormat::UNORM16)
+        return glm::mat4(1.0f);
+
+    return glm::scale(glm::translate(glm::mat4(1.0f), m_positionOffset), m_positionScale);
+}
+
+MeshMemoryStats Mesh::memoryStats() const
+{
+    MeshMemoryStats stats;
+    stats.vertexStride = m_vertexStride;
+    stats.vertexBytes = static_cast<size_t>(m_vertexCount) * m_vertexStride;
+    stats.indexBytes = static_cast<size_t>(m_indexCount) * (m_indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint));
+    stats.baselineVertexBytes = static_cast<size_t>(m_vertexCount) * sizeof(Vertex);
+    stats.baselineIndexBytes = static_cast<size_t>(m_indexCount) * sizeof(GLuint);
+    return stats;
+}
+
+bool Mesh::hasCpuCopy() const
+{
+    return m_residency == MeshResidency::KEEP_CPU_COPY;
+}
+
+const std::vector<Vertex>& Mesh::vertices() const
+{
+    return m_vertexs;
+}
+
+const std::vector<GLuint>& Mesh::indices() const
+{
+    return m_indexs;
+}
+
+const std::vector<Texture*>& Mesh::textures() const
+{
+    return m_textures;
+}
+
+VertexAttributes Mesh::attributes() const
+{
+    return m_attributes;
+}
+
+const MeshQuantization& Mesh::quantization() const
+{
+    return m_quantization;
+}
+
+MeshGpuLayout Mesh::gpuLayout() const
+{
+    MeshGpuLayout layout;
+    layout.attributes = m_attributes;
+    layout.quantization = m_quantization;
+    layout.vertexStride = m_vertexStride;
+    std::copy(std::begin(m_attributeOffsets), std::end(m_attributeOffsets), layout.attributeOffsets);
+    layout.positionScale = m_positionScale;
+    layout.positionOffset = m_positionOffset;
+    layout.indexType = m_indexType;
+    layout.vertexCount = m_vertexCount;
+    layout.indexCount = m_indexCount;
+    layout.baseVertex = m_baseVertex;
+    layout.indexOffset = m_indexOffset;
+    layout.boundsMin = m_boundsMin;
+    layout.boundsMax = m_boundsMax;
+    return layout;
+}
+
+glm::vec3 Mesh::boundsMin() const
+{
+    return m_boundsMin;
+}
+
+glm::vec3 Mesh::boundsMax() const
+{
+    return m_boundsMax;
+}
+
+GLenum Mesh::indexType() const
+{
+    return m_indexType;
 }
 
 GLuint Mesh::VAO() const 
@@ -130,6 +845,16 @@ GLuint Mesh::VAO() const
     return m_VAO; 
 }
 
+GLuint Mesh::VBO() const
+{
+    return m_VBO;
+}
+
+GLuint Mesh::EBO() const
+{
+    return m_EBO;
+}
+
 bool Mesh::hasPosition() const
 {
     return m_attributes & VertexAttributes::POSITION;
@@ -152,12 +877,12 @@ bool Mesh::hasNormal() const
 
 size_t Mesh::vertexCount() const
 {
-    return m_vertexs.size();
+    return m_vertexCount;
 }
 
 size_t Mesh::indexCount() const 
 { 
-    return m_indexs.size(); 
+    return m_indexCount; 
 }
 
 size_t Mesh::textureCount() const 
@@ -0,0 +1,388 @@
+#include "engine/graphics/mesh_cache.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include "engine/core/mapped_file.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+#include <glm/gtc/packing.hpp>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace
+{
+    constexpr char MAGIC[4] = { 'E', 'M', 'S', 'H' };
+
+    enum QuantizationFlags : uint32_t {
+        OCTAHEDRAL_NORMALS  = 1u << 0,
+        UNORM8_COLORS       = 1u << 1,
+        UNORM16_TEXCOORDS   = 1u << 2,
+    };
+
+    struct alignas(16) FileHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t levelCount;
+        uint32_t levelRecordSize;
+        float boundsMin[3];
+        float boundsMax[3];
+        float center[3];
+        float radius;
+        uint64_t fileSize;
+    };
+
+    struct LevelRecord {
+        uint32_t attributes;
+        uint32_t positionFormat;
+        uint32_t quantizationFlags;
+        uint32_t vertexStride;
+        uint32_t attributeOffsets[4];
+        float positionScale[3];
+        float positionOffset[3];
+        uint32_t indexType;
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        float error;
+        uint64_t vertexDataOffset;
+        uint64_t vertexDataSize;
+        uint64_t indexDataOffset;
+        uint64_t indexDataSize;
+    };
+
+    static_assert(sizeof(FileHeader) == 64, "FileHeader layout changed, bump MeshCache::VERSION");
+    static_assert(sizeof(LevelRecord) == 104, "LevelRecord layout changed, bump MeshCache::VERSION");
+    static_assert(std::is_trivially_copyable_v<FileHeader> && std::is_trivially_copyable_v<LevelRecord>);
+
+    uint64_t alignUp(uint64_t value)
+    {
+        return (value + MeshCache::BLOB_ALIGNMENT - 1) & ~static_cast<uint64_t>(MeshCache::BLOB_ALIGNMENT - 1);
+    }
+
+    std::vector<unsigned char> readBuffer(GLuint buffer, GLintptr offset, size_t bytes)
+    {
+        std::vector<unsigned char> data(bytes);
+        if (buffer == 0 || bytes == 0)
+            return data;
+
+        GLStateCache::bindBuffer(GL_COPY_READ_BUFFER, buffer);
+        glGetBufferSubData(GL_COPY_READ_BUFFER, offset, static_cast<GLsizeiptr>(bytes), data.data());
+        GLStateCache::bindBuffer(GL_COPY_READ_BUFFER, 0);
+        return data;
+    }
+
+    glm::vec3 decodePosition(const unsigned char* vertex, const MeshGpuLayout& layout)
+    {
+        const unsigned char* position = vertex + layout.attributeOffsets[0];
+        if (layout.quantization.position == PositionFormat::FLOAT) {
+            glm::vec3 value;
+            std::memcpy(&value, position, sizeof(value));
+            return value;
+        }
+
+        GLushort components[3];
+        std::memcpy(components, position, sizeof(components));
+        if (layout.quantization.position == PositionFormat::HALF_FLOAT)
+            return glm::vec3(glm::unpackHalf1x16(components[0]),
+                             glm::unpackHalf1x16(components[1]),
+                             glm::unpackHalf1x16(components[2]));
+
+        glm::vec3 normalized = glm::vec3(components[0], components[1], components[2]) / 65535.0f;
+        return layout.positionOffset + normalized * layout.positionScale;
+    }
+
+    LevelRecord makeRecord(const MeshGpuLayout& layout, float error)
+    {
+        LevelRecord record = {};
+        record.attributes = static_cast<uint32_t>(layout.attributes);
+        record.positionFormat = static_cast<uint32_t>(layout.quantization.position);
+        record.quantizationFlags = (layout.quantization.octahedralNormals ? OCTAHEDRAL_NORMALS : 0u)
+                                 | (layout.quantization.unorm8Colors ? UNORM8_COLORS : 0u)
+                                 | (layout.quantization.unorm16TexCoords ? UNORM16_TEXCOORDS : 0u);
+        record.vertexStride = static_cast<uint32_t>(layout.vertexStride);
+        for (size_t slot = 0; slot < 4; ++slot)
+            record.attributeOffsets[slot] = static_cast<uint32_t>(layout.attributeOffsets[slot]);
+        std::memcpy(record.positionScale, &layout.positionScale, sizeof(record.positionScale));
+        std::memcpy(record.positionOffset, &layout.positionOffset, sizeof(record.positionOffset));
+        record.indexType = layout.indexType;
+        record.vertexCount = static_cast<uint32_t>(layout.vertexCount);
+        record.indexCount = static_cast<uint32_t>(layout.indexCount);
+        record.error = error;
+        record.vertexDataSize = layout.vertexBytes();
+        record.indexDataSize = layout.indexBytes();
+        return record;
+    }
+
+    MeshGpuLayout makeLayout(const LevelRecord& record)
+    {
+        MeshGpuLayout layout;
+        layout.attributes = static_cast<VertexAttributes>(record.attributes);
+        layout.quantization.position = static_cast<PositionFormat>(record.positionFormat);
+        layout.quantization.octahedralNormals = (record.quantizationFlags & OCTAHEDRAL_NORMALS) != 0;
+        layout.quantization.unorm8Colors = (record.quantizationFlags & UNORM8_COLORS) != 0;
+        layout.quantization.unorm16TexCoords = (record.quantizationFlags & UNORM16_TEXCOORDS) != 0;
+        layout.vertexStride = static_cast<GLsizei>(record.vertexStride);
+        for (size_t slot = 0; slot < 4; ++slot)
+            layout.attributeOffsets[slot] = record.attributeOffsets[slot];
+        std::memcpy(&layout.positionScale, record.positionScale, sizeof(record.positionScale));
+        std::memcpy(&layout.positionOffset, record.positionOffset, sizeof(record.positionOffset));
+        layout.indexType = record.indexType;
+        layout.vertexCount = static_cast<GLsizei>(record.vertexCount);
+        layout.indexCount = static_cast<GLsizei>(record.indexCount);
+        return layout;
+    }
+
+    /** Bytes que ocupa en el VBO el atributo de un slot con la cuantización del nivel */
+    uint64_t attributeSize(const LevelRecord& record, size_t slot)
+    {
+        switch (slot) {
+            case 0:
+                // Las posiciones de 16 bits ocupan 6 bytes alineados a 8
+                return record.positionFormat == static_cast<uint32_t>(PositionFormat::FLOAT) ? 3 * sizeof(float)
+                                                                                              : 4 * sizeof(GLushort);
+            case 1:
+                return (record.quantizationFlags & UNORM8_COLORS) ? 4 * sizeof(GLubyte) : 4 * sizeof(float);
+            case 2:
+                return (record.quantizationFlags & UNORM16_TEXCOORDS) ? 2 * sizeof(GLushort) : 2 * sizeof(float);
+            default:
+                return (record.quantizationFlags & OCTAHEDRAL_NORMALS) ? 2 * sizeof(GLshort) : 3 * sizeof(float);
+        }
+    }
+
+    /** Comprueba que cada atributo presente cabe dentro del stride */
+    bool attributesFit(const LevelRecord& record)
+    {
+        if ((record.attributes & ~0xfu) != 0)
+            return false;
+        for (size_t slot = 0; slot < 4; ++slot) {
+            if ((record.attributes & (1u << slot)) != 0 &&
+                static_cast<uint64_t>(record.attributeOffsets[slot]) + attributeSize(record, slot) > record.vertexStride)
+                return false;
+        }
+        return true;
+    }
+
+    /** Comprueba que [offset, offset + size) está dentro del archivo sin desbordar */
+    bool blobInFile(uint64_t offset, uint64_t size, uint64_t fileSize)
+    {
+        return size <= fileSize && offset <= fileSize - size;
+    }
+
+    bool writeLevels(const char* path, const std::vector<const Mesh*>& levels, const std::vector<float>& errors)
+    {
+        FileHeader header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = MeshCache::VERSION;
+        header.levelCount = static_cast<uint32_t>(levels.size());
+        header.levelRecordSize = sizeof(LevelRecord);
+
+        std::vector<LevelRecord> records;
+        std::vector<std::vector<unsigned char>> vertexBlobs;
+        std::vector<std::vector<unsigned char>> indexBlobs;
+        records.reserve(levels.size());
+        vertexBlobs.reserve(levels.size());
+        indexBlobs.reserve(levels.size());
+
+        uint64_t offset = alignUp(sizeof(FileHeader) + levels.size() * sizeof(LevelRecord));
+        for (size_t level = 0; level < levels.size(); ++level) {
+            const MeshGpuLayout layout = levels[level]->gpuLayout();
+            if (layout.vertexCount == 0) {
+                std::cerr << "ERROR::MESH_CACHE::EMPTY_MESH: " << path << std::endl;
+                return false;
+            }
+
+            LevelRecord record = makeRecord(layout, errors[level]);
+            record.vertexDataOffset = offset;
+            offset = alignUp(offset + record.vertexDataSize);
+            record.indexDataOffset = offset;
+            offset = alignUp(offset + record.indexDataSize);
+            records.push_back(record);
+
+            vertexBlobs.push_back(readBuffer(levels[level]->VBO(),
+                                             static_cast<GLintptr>(layout.baseVertex) * layout.vertexStride,
+                                             layout.vertexBytes()));
+            indexBlobs.push_back(readBuffer(levels[level]->EBO(), layout.indexOffset, layout.indexBytes()));
+        }
+        header.fileSize = offset;
+
+        // Las envolventes se calculan del nivel 0, ya decodificado como lo verá el shader
+        const MeshGpuLayout base = levels.front()->gpuLayout();
+        if (base.attributes & VertexAttributes::POSITION) {
+            const std::vector<unsigned char>& vertexs = vertexBlobs.front();
+            glm::vec3 minimum = decodePosition(vertexs.data(), base);
+            glm::vec3 maximum = minimum;
+            for (GLsizei i = 1; i < base.vertexCount; ++i) {
+                glm::vec3 position = decodePosition(vertexs.data() + static_cast<size_t>(i) * base.vertexStride, base);
+                minimum = glm::min(minimum, position);
+                maximum = glm::max(maximum, position);
+            }
+
+            glm::vec3 center = (minimum + maximum) * 0.5f;
+            float radius = 0.0f;
+            for (GLsizei i = 0; i < base.vertexCount; ++i) {
+                glm::vec3 position = decodePosition(vertexs.data() + static_cast<size_t>(i) * base.vertexStride, base);
+                radius = std::max(radius, glm::length(position - center));
+            }
+
+            std::memcpy(header.boundsMin, &minimum, sizeof(header.boundsMin));
+            std::memcpy(header.boundsMax, &maximum, sizeof(header.boundsMax));
+            std::memcpy(header.center, &center, sizeof(header.center));
+            header.radius = radius;
+        }
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "ERROR::MESH_CACHE::OPEN_FAILED: " << path << std::endl;
+            return false;
+        }
+
+        const char padding[MeshCache::BLOB_ALIGNMENT] = {};
+        auto padTo = [&](uint64_t position) {
+            uint64_t current = static_cast<uint64_t>(file.tellp());
+            if (position > current)
+                file.write(padding, static_cast<std::streamsize>(position - current));
+        };
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(LevelRecord)));
+        for (size_t level = 0; level < records.size(); ++level) {
+            padTo(records[level].vertexDataOffset);
+            file.write(reinterpret_cast<const char*>(vertexBlobs[level].data()),
+                       static_cast<std::streamsize>(vertexBlobs[level].size()));
+            padTo(records[level].indexDataOffset);
+            file.write(reinterpret_cast<const char*>(indexBlobs[level].data()),
+                       static_cast<std::streamsize>(indexBlobs[level].size()));
+        }
+        padTo(header.fileSize);
+
+        if (!file) {
+            std::cerr << "ERROR::MESH_CACHE::WRITE_FAILED: " << path << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool validate(const char* path, const MappedFile& file, FileHeader& header, std::vector<LevelRecord>& records)
+    {
+        if (!file.isOpen())
+            return false;
+
+        if (file.size() < sizeof(FileHeader)) {
+            std::cerr << "ERROR::MESH_CACHE::INVALID_FILE: " << path << std::endl;
+            return false;
+        }
+        std::memcpy(&header, file.data(), sizeof(header));
+
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.fileSize != file.size() ||
+            header.levelRecordSize != sizeof(LevelRecord) || header.levelCount == 0 ||
+            sizeof(FileHeader) + static_cast<uint64_t>(header.levelCount) * sizeof(LevelRecord) > file.size()) {
+            std::cerr << "ERROR::MESH_CACHE::INVALID_FILE: " << path << std::endl;
+            return false;
+        }
+        if (header.version != MeshCache::VERSION) {
+            std::cerr << "ERROR::MESH_CACHE::VERSION_MISMATCH: " << path << " (version " << header.version
+                      << ", expected " << MeshCache::VERSION << ")" << std::endl;
+            return false;
+        }
+
+        records.resize(header.levelCount);
+        std::memcpy(records.data(), file.data() + sizeof(FileHeader), records.size() * sizeof(LevelRecord));
+
+        for (const LevelRecord& record : records) {
+            // Los tamaños se calculan en 64 bits: los contadores del archivo no son de confianza
+            const uint64_t indexSize = record.indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+            bool valid = record.vertexCount > 0 && record.vertexStride > 0 &&
+                         record.vertexCount <= static_cast<uint32_t>(std::numeric_limits<GLsizei>::max()) &&
+                         record.indexCount <= static_cast<uint32_t>(std::numeric_limits<GLsizei>::max()) &&
+                         record.vertexStride <= static_cast<uint32_t>(std::numeric_limits<GLsizei>::max()) &&
+                         record.positionFormat <= static_cast<uint32_t>(PositionFormat::UNORM16) &&
+                         (record.indexType == GL_UNSIGNED_SHORT || record.indexType == GL_UNSIGNED_INT) &&
+                         attributesFit(record) &&
+                         record.vertexDataSize == static_cast<uint64_t>(record.vertexStride) * record.vertexCount &&
+                         record.indexDataSize == indexSize * record.indexCount &&
+                         record.vertexDataOffset % MeshCache::BLOB_ALIGNMENT == 0 &&
+                         record.indexDataOffset % MeshCache::BLOB_ALIGNMENT == 0 &&
+                         blobInFile(record.vertexDataOffset, record.vertexDataSize, file.size()) &&
+                         blobInFile(record.indexDataOffset, record.indexDataSize, file.size());
+            if (!valid) {
+                std::cerr << "ERROR::MESH_CACHE::CORRUPTED_LEVEL: " << path << std::endl;
+                return false;
+            }
+        }
+        return true;
+    }
+
+    Mesh createMesh(const MappedFile& file, const FileHeader& header, const LevelRecord& record,
+                    const std::vector<Texture*>& textures)
+    {
+        // Todos los niveles comparten la caja del nivel 0
+        MeshGpuLayout layout = makeLayout(record);
+        if (layout.attributes & VertexAttributes::POSITION) {
+            std::memcpy(&layout.boundsMin, header.boundsMin, sizeof(header.boundsMin));
+            std::memcpy(&layout.boundsMax, header.boundsMax, sizeof(header.boundsMax));
+        }
+
+        return Mesh(layout,
+                    file.data() + record.vertexDataOffset,
+                    record.indexDataSize > 0 ? file.data() + record.indexDataOffset : nullptr,
+                    textures);
+    }
+}
+
+bool MeshCache::save(const char* path, const Mesh& mesh)
+{
+    return writeLevels(path, { &mesh }, { 0.0f });
+}
+
+bool MeshCache::save(const char* path, const MeshLOD& lod)
+{
+    std::vector<const Mesh*> levels;
+    std::vector<float> errors;
+    for (size_t level = 0; level < lod.levelCount(); ++level) {
+        levels.push_back(&lod.level(level));
+        errors.push_back(lod.error(level));
+    }
+
+    if (levels.empty()) {
+        std::cerr << "ERROR::MESH_CACHE::EMPTY_MESH: " << path << std::endl;
+        return false;
+    }
+    return writeLevels(path, levels, errors);
+}
+
+std::optional<Mesh> MeshCache::load(const char* path, const std::vector<Texture*>& textures)
+{
+    MappedFile file(path);
+    FileHeader header;
+    std::vector<LevelRecord> records;
+    if (!validate(path, file, header, records))
+        return std::nullopt;
+
+    return createMesh(file, header, records.front(), textures);
+}
+
+std::optional<MeshLOD> MeshCache::loadLOD(const char* path, const std::vector<Texture*>& textures,
+                                          float pixelErrorThreshold)
+{
+    MappedFile file(path);
+    FileHeader header;
+    std::vector<LevelRecord> records;
+    if (!validate(path, file, header, records))
+        return std::nullopt;
+
+    std::vector<Mesh> levels;
+    std::vector<float> errors;
+    levels.reserve(records.size());
+    errors.reserve(records.size());
+    for (const LevelRecord& record : records) {
+        levels.push_back(createMesh(file, header, record, textures));
+        errors.push_back(record.error);
+    }
+
+    glm::vec3 center;
+    std::memcpy(&center, header.center, sizeof(header.center));
+    return MeshLOD(std::move(levels), std::move(errors), center, header.radius, pixelErrorThreshold);
+}
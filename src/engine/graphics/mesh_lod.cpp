@@ -0,0 +1,491 @@
+#include "engine/graphics/mesh_lod.hpp"
+#include "engine/graphics/mesh_optimizer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <tuple>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    /** Cuádrica simétrica 4x4 (10 coeficientes) ponderada por área */
+    struct Quadric {
+        double a00 = 0, a01 = 0, a02 = 0, a03 = 0;
+        double a11 = 0, a12 = 0, a13 = 0;
+        double a22 = 0, a23 = 0;
+        double a33 = 0;
+        double weight = 0;
+
+        void addPlane(const glm::dvec3& normal, double distance, double area)
+        {
+            a00 += area * normal.x * normal.x;
+            a01 += area * normal.x * normal.y;
+            a02 += area * normal.x * normal.z;
+            a03 += area * normal.x * distance;
+            a11 += area * normal.y * normal.y;
+            a12 += area * normal.y * normal.z;
+            a13 += area * normal.y * distance;
+            a22 += area * normal.z * normal.z;
+            a23 += area * normal.z * distance;
+            a33 += area * distance * distance;
+            weight += area;
+        }
+
+        Quadric& operator+=(const Quadric& other)
+        {
+            a00 += other.a00; a01 += other.a01; a02 += other.a02; a03 += other.a03;
+            a11 += other.a11; a12 += other.a12; a13 += other.a13;
+            a22 += other.a22; a23 += other.a23;
+            a33 += other.a33;
+            weight += other.weight;
+            return *this;
+        }
+
+        /** Distancia cuadrática media (ponderada por área) de p a los planos acumulados */
+        double evaluate(const glm::vec3& p) const
+        {
+            double x = p.x, y = p.y, z = p.z;
+            double error = a00 * x * x + 2.0 * a01 * x * y + 2.0 * a02 * x * z + 2.0 * a03 * x
+                         + a11 * y * y + 2.0 * a12 * y * z + 2.0 * a13 * y
+                         + a22 * z * z + 2.0 * a23 * z
+                         + a33;
+            return weight > 0.0 ? std::max(error, 0.0) / weight : 0.0;
+        }
+    };
+
+    struct Collapse {
+        GLuint from;
+        GLuint to;
+        float cost;
+    };
+
+    /** Representante de cada grupo de vértices con la misma posición */
+    std::vector<GLuint> buildPositionRemap(const std::vector<Vertex>& vertexs)
+    {
+        std::vector<GLuint> order(vertexs.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::sort(order.begin(), order.end(), [&](GLuint a, GLuint b) {
+            const glm::vec3& pa = vertexs[a].m_position;
+            const glm::vec3& pb = vertexs[b].m_position;
+            return std::tie(pa.x, pa.y, pa.z, a) < std::tie(pb.x, pb.y, pb.z, b);
+        });
+
+        std::vector<GLuint> remap(vertexs.size());
+        for (size_t i = 0; i < order.size(); ++i) {
+            bool sameAsPrevious = i > 0 && vertexs[order[i]].m_position == vertexs[order[i - 1]].m_position;
+            remap[order[i]] = sameAsPrevious ? remap[order[i - 1]] : order[i];
+        }
+        return remap;
+    }
+
+    /**
+     * Bloquea los grupos de posición del borde o de aristas no manifold
+     * (aristas en espacio de posición usadas por un número de triángulos
+     * distinto de dos). Las costuras no se bloquean: se tratan en cada colapso.
+     */
+    std::vector<bool> findLockedGroups(const std::vector<GLuint>& indexs,
+                                       const std::vector<GLuint>& positionRemap)
+    {
+        std::vector<std::uint64_t> edges;
+        edges.reserve(indexs.size());
+        for (size_t t = 0; t + 2 < indexs.size(); t += 3) {
+            for (int e = 0; e < 3; ++e) {
+                std::uint64_t a = positionRemap[indexs[t + e]];
+                std::uint64_t b = positionRemap[indexs[t + (e + 1) % 3]];
+                if (a > b)
+                    std::swap(a, b);
+                edges.push_back((a << 32) | b);
+            }
+        }
+        std::sort(edges.begin(), edges.end());
+
+        std::vector<bool> lockedGroup(positionRemap.size(), false);
+        for (size_t i = 0; i < edges.size();) {
+            size_t j = i;
+            while (j < edges.size() && edges[j] == edges[i])
+                ++j;
+            if (j - i != 2) {
+                lockedGroup[edges[i] >> 32] = true;
+                lockedGroup[edges[i] & 0xffffffffu] = true;
+            }
+            i = j;
+        }
+        return lockedGroup;
+    }
+
+    /** Vértices (copias de atributos) de cada grupo de posición en formato CSR */
+    void buildGroups(const std::vector<GLuint>& positionRemap,
+                     std::vector<GLuint>& offsets, std::vector<GLuint>& copies)
+    {
+        const size_t vertexCount = positionRemap.size();
+        offsets.assign(vertexCount + 1, 0);
+        for (GLuint group : positionRemap)
+            ++offsets[group + 1];
+        for (size_t v = 0; v < vertexCount; ++v)
+            offsets[v + 1] += offsets[v];
+
+        copies.resize(vertexCount);
+        std::vector<GLuint> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t v = 0; v < vertexCount; ++v)
+            copies[cursor[positionRemap[v]]++] = static_cast<GLuint>(v);
+    }
+
+    /** Adyacencia vértice -> triángulos en formato CSR */
+    void buildAdjacency(const std::vector<GLuint>& indexs, size_t vertexCount,
+                        std::vector<GLuint>& offsets, std::vector<GLuint>& triangles)
+    {
+        offsets.assign(vertexCount + 1, 0);
+        for (GLuint index : indexs)
+            ++offsets[index + 1];
+        for (size_t v = 0; v < vertexCount; ++v)
+            offsets[v + 1] += offsets[v];
+
+        triangles.resize(indexs.size());
+        std::vector<GLuint> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < indexs.size(); ++i)
+            triangles[cursor[indexs[i]]++] = static_cast<GLuint>(i / 3);
+    }
+
+    /** Comprueba que mover `from` a la posición de `to` no invierte ni degenera triángulos */
+    bool collapseKeepsOrientation(const Collapse& collapse,
+                                  const std::vector<Vertex>& vertexs,
+                                  const std::vector<GLuint>& indexs,
+                                  const std::vector<GLuint>& offsets,
+                                  const std::vector<GLuint>& triangles)
+    {
+        for (GLuint i = offsets[collapse.from]; i < offsets[collapse.from + 1]; ++i) {
+            const GLuint* triangle = &indexs[triangles[i] * 3];
+            if (triangle[0] == collapse.to || triangle[1] == collapse.to || triangle[2] == collapse.to)
+                continue;
+
+            glm::vec3 before[3], after[3];
+            for (int k = 0; k < 3; ++k) {
+                before[k] = vertexs[triangle[k]].m_position;
+                after[k] = triangle[k] == collapse.from ? vertexs[collapse.to].m_position : before[k];
+            }
+
+            glm::vec3 normalBefore = glm::cross(before[1] - before[0], before[2] - before[0]);
+            glm::vec3 normalAfter = glm::cross(after[1] - after[0], after[2] - after[0]);
+            float lengths = glm::length(normalBefore) * glm::length(normalAfter);
+            if (lengths == 0.0f || glm::dot(normalBefore, normalAfter) < 0.25f * lengths)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * Traduce el colapso de un grupo de posición a un movimiento por cada copia
+     * con triángulos: cada copia de `from` se funde con la única copia de `to`
+     * con la que comparte arista. Si alguna no tiene esa arista (la costura no
+     * sigue la arista colapsada) o la tiene con varias copias, el colapso
+     * separaría atributos y se descarta. Así una costura solo se recorre a lo
+     * largo de sí misma y sus copias se mueven juntas.
+     */
+    bool planGroupCollapse(const Collapse& collapse,
+                           const std::vector<GLuint>& positionRemap,
+                           const std::vector<GLuint>& groupOffsets,
+                           const std::vector<GLuint>& groupCopies,
+                           const std::vector<GLuint>& indexs,
+                           const std::vector<GLuint>& offsets,
+                           const std::vector<GLuint>& triangles,
+                           std::vector<Collapse>& moves)
+    {
+        constexpr GLuint NONE = ~0u;
+        moves.clear();
+
+        for (GLuint c = groupOffsets[collapse.from]; c < groupOffsets[collapse.from + 1]; ++c) {
+            GLuint copy = groupCopies[c];
+            if (offsets[copy] == offsets[copy + 1])
+                continue;
+
+            GLuint target = NONE;
+            for (GLuint i = offsets[copy]; i < offsets[copy + 1]; ++i) {
+                const GLuint* triangle = &indexs[triangles[i] * 3];
+                for (int k = 0; k < 3; ++k) {
+                    if (positionRemap[triangle[k]] != collapse.to)
+                        continue;
+                    if (target != NONE && target != triangle[k])
+                        return false;
+                    target = triangle[k];
+                }
+            }
+
+            if (target == NONE)
+                return false;
+            moves.push_back({copy, target, collapse.cost});
+        }
+
+        return !moves.empty();
+    }
+
+} // namespace
+
+SimplifyResult MeshLOD::simplify(const std::vector<Vertex>& vertexs,
+                                 const std::vector<GLuint>& indexs,
+                                 size_t targetIndexCount)
+{
+    SimplifyResult result;
+    result.indexs = indexs;
+    if (indexs.size() <= targetIndexCount || vertexs.empty())
+        return result;
+
+    const size_t vertexCount = vertexs.size();
+    const std::vector<GLuint> positionRemap = buildPositionRemap(vertexs);
+    const std::vector<bool> locked = findLockedGroups(indexs, positionRemap);
+    std::vector<GLuint> groupOffsets, groupCopies;
+    buildGroups(positionRemap, groupOffsets, groupCopies);
+
+    // Las cuádricas se acumulan por grupo de posición y se heredan en cada colapso
+    std::vector<Quadric> quadrics(vertexCount);
+    for (size_t t = 0; t + 2 < indexs.size(); t += 3) {
+        glm::dvec3 p0 = vertexs[indexs[t]].m_position;
+        glm::dvec3 p1 = vertexs[indexs[t + 1]].m_position;
+        glm::dvec3 p2 = vertexs[indexs[t + 2]].m_position;
+        glm::dvec3 normal = glm::cross(p1 - p0, p2 - p0);
+        double length = glm::length(normal);
+        if (length == 0.0)
+            continue;
+
+        normal /= length;
+        double distance = -glm::dot(normal, p0);
+        for (int k = 0; k < 3; ++k)
+            quadrics[positionRemap[indexs[t + k]]].addPlane(normal, distance, length * 0.5);
+    }
+
+    std::vector<GLuint>& current = result.indexs;
+    std::vector<GLuint> collapseTo(vertexCount);
+    std::vector<GLuint> offsets, triangles;
+    std::vector<Collapse> collapses;
+    std::vector<Collapse> moves;
+    std::vector<bool> touched(vertexCount);
+    float maxError = 0.0f;
+
+    const size_t targetTriangles = targetIndexCount / 3;
+    size_t triangleCount = current.size() / 3;
+
+    while (triangleCount > targetTriangles) {
+        buildAdjacency(current, vertexCount, offsets, triangles);
+
+        // Candidatos: cada arista en ambos sentidos entre grupos de posición,
+        // con el menor coste por grupo origen
+        collapses.clear();
+        for (size_t t = 0; t + 2 < current.size(); t += 3) {
+            for (int e = 0; e < 3; ++e) {
+                GLuint a = positionRemap[current[t + e]];
+                GLuint b = positionRemap[current[t + (e + 1) % 3]];
+                if (a == b)
+                    continue;
+                for (int direction = 0; direction < 2; ++direction, std::swap(a, b)) {
+                    if (locked[a])
+                        continue;
+                    Quadric merged = quadrics[a];
+                    merged += quadrics[b];
+                    collapses.push_back({a, b, static_cast<float>(merged.evaluate(vertexs[b].m_position))});
+                }
+            }
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return std::tie(a.from, a.cost) < std::tie(b.from, b.cost);
+        });
+        collapses.erase(std::unique(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.from == b.from;
+        }), collapses.end());
+        std::sort(collapses.begin(), collapses.end(), [](const Collapse& a, const Collapse& b) {
+            return a.cost < b.cost;
+        });
+
+        // Colapsos independientes: ningún vértice de la vecindad cambia dos veces por pasada
+        std::iota(collapseTo.begin(), collapseTo.end(), 0u);
+        std::fill(touched.begin(), touched.end(), false);
+        size_t applied = 0;
+
+        for (const Collapse& collapse : collapses) {
+            if (triangleCount <= targetTriangles)
+                break;
+            if (touched[collapse.from] || touched[collapse.to])
+                continue;
+            if (!planGroupCollapse(collapse, positionRemap, groupOffsets, groupCopies, current, offsets, triangles, moves))
+                continue;
+
+            bool keepsOrientation = std::all_of(moves.begin(), moves.end(), [&](const Collapse& move) {
+                return collapseKeepsOrientation(move, vertexs, current, offsets, triangles);
+            });
+            if (!keepsOrientation)
+                continue;
+
+            for (const Collapse& move : moves) {
+                for (GLuint i = offsets[move.from]; i < offsets[move.from + 1]; ++i) {
+                    const GLuint* triangle = &current[triangles[i] * 3];
+                    if (triangle[0] == move.to || triangle[1] == move.to || triangle[2] == move.to)
+                        --triangleCount;
+                    for (int k = 0; k < 3; ++k)
+                        touched[positionRemap[triangle[k]]] = true;
+                }
+                collapseTo[move.from] = move.to;
+            }
+
+            quadrics[collapse.to] += quadrics[collapse.from];
+            maxError = std::max(maxError, std::sqrt(collapse.cost));
+            ++applied;
+        }
+
+        if (applied == 0)
+            break;
+
+        size_t write = 0;
+        for (size_t t = 0; t + 2 < current.size(); t += 3) {
+            GLuint a = collapseTo[current[t]];
+            GLuint b = collapseTo[current[t + 1]];
+            GLuint c = collapseTo[current[t + 2]];
+            if (a == b || b == c || a == c)
+                continue;
+            current[write++] = a;
+            current[write++] = b;
+            current[write++] = c;
+        }
+        current.resize(write);
+        triangleCount = write / 3;
+    }
+
+    result.error = maxError;
+    return result;
+}
+
+MeshLOD::MeshLOD(Mesh&& source, const MeshLODParams& params)
+    : m_center(0.0f)
+    , m_radius(0.0f)
+    , m_pixelErrorThreshold(params.pixelErrorThreshold)
+{
+    const size_t levelCount = std::clamp<size_t>(params.levelCount, 2, 5);
+    m_levels.reserve(levelCount);
+    m_levels.push_back(std::move(source));
+    m_errors.push_back(0.0f);
+
+    const Mesh& base = m_levels.front();
+    if (!base.hasCpuCopy()) {
+        std::cerr << "ERROR::MESH_LOD::NO_CPU_COPY: "
+                  << "Source mesh was created with MeshResidency::GPU_ONLY, no LOD levels generated" << std::endl;
+        return;
+    }
+
+    const std::vector<Vertex>& vertexs = base.vertices();
+    const std::vector<GLuint>& indexs = base.indices();
+    if (vertexs.empty())
+        return;
+
+    glm::vec3 minimum = vertexs[0].m_position;
+    glm::vec3 maximum = vertexs[0].m_position;
+    for (const Vertex& vertex : vertexs) {
+        minimum = glm::min(minimum, vertex.m_position);
+        maximum = glm::max(maximum, vertex.m_position);
+    }
+    m_center = (minimum + maximum) * 0.5f;
+    for (const Vertex& vertex : vertexs)
+        m_radius = std::max(m_radius, glm::length(vertex.m_position - m_center));
+
+    // Cada nivel tiene sus propios límites, así que UNORM16 no compartiría la
+    // misma matriz de descuantización que el nivel 0
+    MeshQuantization quantization = base.quantization();
+    if (quantization.position == PositionFormat::UNORM16)
+        quantization.position = PositionFormat::HALF_FLOAT;
+
+    size_t previousIndexCount = indexs.size();
+    for (size_t level = 1; level < levelCount; ++level) {
+        size_t target = static_cast<size_t>(indexs.size() * std::pow(params.reductionRatio, static_cast<float>(level)));
+        SimplifyResult simplified = simplify(vertexs, indexs, target - target % 3);
+        if (simplified.indexs.size() >= previousIndexCount)
+            break;
+        previousIndexCount = simplified.indexs.size();
+
+        std::vector<Vertex> levelVertexs = vertexs;
+        std::vector<GLuint> levelIndexs = MeshOptimizer::optimizeVertexCache(simplified.indexs, vertexs.size(), 16);
+        MeshOptimizer::optimizeVertexFetch(levelVertexs, levelIndexs);
+
+        m_levels.emplace_back(std::move(levelVertexs), std::move(levelIndexs),
+                              base.textures(), base.attributes(), quantization, MeshResidency::GPU_ONLY);
+        m_errors.push_back(std::max(simplified.error, m_errors.back()));
+    }
+}
+
+MeshLOD::MeshLOD(std::vector<Mesh>&& levels, std::vector<float>&& errors,
+                 const glm::vec3& center, float radius, float pixelErrorThreshold)
+    : m_levels(std::move(levels))
+    , m_errors(std::move(errors))
+    , m_center(center)
+    , m_radius(radius)
+    , m_pixelErrorThreshold(pixelErrorThreshold)
+{
+}
+
+size_t MeshLOD::selectLevel(const Camera& camera, const glm::mat4& model, float viewportHeight) const
+{
+    glm::vec3 center = glm::vec3(model * glm::vec4(m_center, 1.0f));
+    float scale = std::max({glm::length(glm::vec3(model[0])),
+                            glm::length(glm::vec3(model[1])),
+                            glm::length(glm::vec3(model[2]))});
+
+    float distance = glm::length(center - camera.position()) - m_radius * scale;
+    distance = std::max(distance, camera.zNear());
+
+    // Píxeles que ocupa una unidad del mundo a esa distancia
+    float pixelsPerUnit = viewportHeight / (2.0f * distance * std::tan(glm::radians(camera.fov()) * 0.5f));
+
+    size_t selected = 0;
+    for (size_t level = 1; level < m_levels.size(); ++level) {
+        if (m_errors[level] * scale * pixelsPerUnit > m_pixelErrorThreshold)
+            break;
+        selected = level;
+    }
+    return selected;
+}
+
+void MeshLOD::draw(const Shader& shader, const Camera& camera,
+                   const glm::mat4& model, float viewportHeight)
+{
+    m_levels[selectLevel(camera, model, viewportHeight)].draw(shader);
+}
+
+Mesh& MeshLOD::level(size_t level)
+{
+    return m_levels[level];
+}
+
+const Mesh& MeshLOD::level(size_t level) const
+{
+    return m_levels[level];
+}
+
+float MeshLOD::error(size_t level) const
+{
+    return m_errors[level];
+}
+
+size_t MeshLOD::levelCount() const
+{
+    return m_levels.size();
+}
+
+glm::vec3 MeshLOD::center() const
+{
+    return m_center;
+}
+
+float MeshLOD::radius() const
+{
+    return m_radius;
+}
+
+float MeshLOD::pixelErrorThreshold() const
+{
+    return m_pixelErrorThreshold;
+}
+
+void MeshLOD::setPixelErrorThreshold(float threshold)
+{
+    m_pixelErrorThreshold = threshold;
+}
@@ -0,0 +1,400 @@
+#include "engine/graphics/mesh_optimizer.hpp"
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    // Todas las etapas indexan tablas por vértice y por triángulo: los índices se validan antes
+    bool validIndexs(const std::vector<GLuint>& indexs, size_t vertexCount, bool triangles, const char* function)
+    {
+        if (triangles && indexs.size() % 3 != 0) {
+            std::cerr << "ERROR::MESH_OPTIMIZER::" << function << ": Index count " << indexs.size()
+                      << " is not a multiple of 3" << std::endl;
+            return false;
+        }
+
+        for (GLuint index : indexs) {
+            if (index >= vertexCount) {
+                std::cerr << "ERROR::MESH_OPTIMIZER::" << function << ": Index " << index
+                          << " out of range (" << vertexCount << " vertices)" << std::endl;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Caché FIFO simulada: un vértice está en caché si se transformó
+     * hace menos de cacheSize fallos.
+     */
+    class FifoCache {
+    private:
+        std::vector<size_t> m_timestamps;
+        size_t m_time;
+        GLuint m_size;
+
+    public:
+        FifoCache(size_t vertexCount, GLuint size)
+            : m_timestamps(vertexCount, 0)
+            , m_time(size + 1)
+            , m_size(size) {}
+
+        bool access(GLuint vertex)
+        {
+            if (m_time - m_timestamps[vertex] > m_size) {
+                m_timestamps[vertex] = m_time++;
+                return false;
+            }
+            return true;
+        }
+
+        void flush()
+        {
+            m_time += m_size + 1;
+        }
+    };
+
+    struct CacheResult {
+        size_t misses = 0;
+        size_t uniqueVertices = 0;
+    };
+
+    CacheResult simulateCache(const std::vector<GLuint>& indexs, size_t vertexCount, GLuint cacheSize)
+    {
+        CacheResult result;
+        FifoCache cache(vertexCount, cacheSize);
+        std::vector<bool> seen(vertexCount, false);
+
+        for (GLuint index : indexs) {
+            if (!cache.access(index))
+                ++result.misses;
+            if (!seen[index]) {
+                seen[index] = true;
+                ++result.uniqueVertices;
+            }
+        }
+
+        return result;
+    }
+
+    /** Adyacencia vértice -> triángulos en formato CSR */
+    struct Adjacency {
+        std::vector<GLuint> offsets;
+        std::vector<GLuint> triangles;
+        std::vector<GLuint> liveCounts;
+
+        Adjacency(const std::vector<GLuint>& indexs, size_t vertexCount)
+            : offsets(vertexCount + 1, 0)
+            , triangles(indexs.size())
+            , liveCounts(vertexCount, 0)
+        {
+            for (GLuint index : indexs)
+                ++liveCounts[index];
+
+            for (size_t v = 0; v < vertexCount; ++v)
+                offsets[v + 1] = offsets[v] + liveCounts[v];
+
+            std::vector<GLuint> cursor(offsets.begin(), offsets.end() - 1);
+            for (size_t i = 0; i < indexs.size(); ++i)
+                triangles[cursor[indexs[i]]++] = static_cast<GLuint>(i / 3);
+        }
+    };
+
+    long long nextFanningVertex(const std::vector<GLuint>& candidates,
+                                const Adjacency& adjacency,
+                                const std::vector<size_t>& cacheTime,
+                                size_t time,
+                                GLuint cacheSize,
+                                std::vector<GLuint>& deadEnds,
+                                size_t& cursor)
+    {
+        long long best = -1;
+        long long bestPriority = -1;
+
+        for (GLuint vertex : candidates) {
+            if (adjacency.liveCounts[vertex] == 0)
+                continue;
+
+            // Vértices que seguirán en caché tras emitir todos sus triángulos,
+            // priorizando los más antiguos
+            long long priority = 0;
+            if (time - cacheTime[vertex] + 2 * adjacency.liveCounts[vertex] <= cacheSize)
+                priority = static_cast<long long>(time - cacheTime[vertex]);
+
+            if (priority > bestPriority) {
+                bestPriority = priority;
+                best = vertex;
+            }
+        }
+
+        if (best != -1)
+            return best;
+
+        while (!deadEnds.empty()) {
+            GLuint vertex = deadEnds.back();
+            deadEnds.pop_back();
+            if (adjacency.liveCounts[vertex] > 0)
+                return vertex;
+        }
+
+        while (cursor < adjacency.liveCounts.size()) {
+            size_t vertex = cursor++;
+            if (adjacency.liveCounts[vertex] > 0)
+                return static_cast<long long>(vertex);
+        }
+
+        return -1;
+    }
+
+    glm::vec3 trianglePosition(const std::vector<Vertex>& vertexs,
+                               const std::vector<GLuint>& indexs,
+                               size_t triangle, size_t corner)
+    {
+        return vertexs[indexs[triangle * 3 + corner]].m_position;
+    }
+
+} // namespace
+
+MeshOptimizerStats MeshOptimizer::optimize(std::vector<Vertex>& vertexs,
+                                           std::vector<GLuint>& indexs,
+                                           const MeshOptimizerParams& params)
+{
+    MeshOptimizerStats stats;
+    if (!validIndexs(indexs, vertexs.size(), true, "OPTIMIZE"))
+        return stats;
+
+    stats.acmrBefore = computeACMR(indexs, vertexs.size(), params.cacheSize);
+    stats.atvrBefore = computeATVR(indexs, vertexs.size(), params.cacheSize);
+
+    indexs = optimizeVertexCache(indexs, vertexs.size(), params.cacheSize);
+
+    if (params.optimizeOverdraw)
+        indexs = optimizeOverdraw(indexs, vertexs, params.cacheSize, params.overdrawThreshold);
+
+    if (params.optimizeVertexFetch)
+        optimizeVertexFetch(vertexs, indexs);
+
+    stats.acmrAfter = computeACMR(indexs, vertexs.size(), params.cacheSize);
+    stats.atvrAfter = computeATVR(indexs, vertexs.size(), params.cacheSize);
+
+    return stats;
+}
+
+std::vector<GLuint> MeshOptimizer::optimizeVertexCache(const std::vector<GLuint>& indexs,
+                                                       size_t vertexCount,
+                                                       GLuint cacheSize)
+{
+    if (!validIndexs(indexs, vertexCount, true, "OPTIMIZE_VERTEX_CACHE"))
+        return indexs;
+
+    size_t triangleCount = indexs.size() / 3;
+    std::vector<GLuint> result;
+    result.reserve(triangleCount * 3);
+
+    if (triangleCount == 0 || vertexCount == 0)
+        return result;
+
+    Adjacency adjacency(indexs, vertexCount);
+    std::vector<size_t> cacheTime(vertexCount, 0);
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<GLuint> deadEnds;
+    std::vector<GLuint> candidates;
+
+    size_t time = cacheSize + 1;
+    size_t cursor = 0;
+    long long fanning = 0;
+
+    while (fanning >= 0) {
+        GLuint vertex = static_cast<GLuint>(fanning);
+        candidates.clear();
+
+        for (GLuint i = adjacency.offsets[vertex]; i < adjacency.offsets[vertex + 1]; ++i) {
+            GLuint triangle = adjacency.triangles[i];
+            if (emitted[triangle])
+                continue;
+
+            for (size_t corner = 0; corner < 3; ++corner) {
+                GLuint index = indexs[triangle * 3 + corner];
+                result.push_back(index);
+                deadEnds.push_back(index);
+                candidates.push_back(index);
+                --adjacency.liveCounts[index];
+
+                if (time - cacheTime[index] > cacheSize)
+                    cacheTime[index] = time++;
+            }
+
+            emitted[triangle] = true;
+        }
+
+        fanning = nextFanningVertex(candidates, adjacency, cacheTime, time, cacheSize, deadEnds, cursor);
+    }
+
+    return result;
+}
+
+std::vector<GLuint> MeshOptimizer::optimizeOverdraw(const std::vector<GLuint>& indexs,
+                                                    const std::vector<Vertex>& vertexs,
+                                                    GLuint cacheSize,
+                                                    float threshold)
+{
+    if (!validIndexs(indexs, vertexs.size(), true, "OPTIMIZE_OVERDRAW"))
+        return indexs;
+
+    size_t triangleCount = indexs.size() / 3;
+    if (triangleCount == 0)
+        return indexs;
+
+    // 1. Clusters "duros": puntos donde la caché se vacía (triángulo con 3 fallos)
+    std::vector<size_t> hardBoundaries;
+    {
+        FifoCache cache(vertexs.size(), cacheSize);
+        for (size_t t = 0; t < triangleCount; ++t) {
+            size_t misses = 0;
+            for (size_t corner = 0; corner < 3; ++corner)
+                misses += cache.access(indexs[t * 3 + corner]) ? 0 : 1;
+            if (t == 0 || misses == 3)
+                hardBoundaries.push_back(t);
+        }
+        hardBoundaries.push_back(triangleCount);
+    }
+
+    // 2. Clusters "blandos": se parte un cluster duro cuando el ACMR acumulado
+    //    ya es tan bueno como el del cluster completo multiplicado por el umbral
+    constexpr size_t MIN_CLUSTER_TRIANGLES = 8;
+    std::vector<size_t> boundaries;
+    for (size_t h = 0; h + 1 < hardBoundaries.size(); ++h) {
+        size_t begin = hardBoundaries[h];
+        size_t end = hardBoundaries[h + 1];
+
+        FifoCache clusterCache(vertexs.size(), cacheSize);
+        size_t clusterMisses = 0;
+        for (size_t i = begin * 3; i < end * 3; ++i)
+            clusterMisses += clusterCache.access(indexs[i]) ? 0 : 1;
+        float target = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - begin);
+
+        FifoCache cache(vertexs.size(), cacheSize);
+        size_t start = begin;
+        size_t misses = 0;
+        boundaries.push_back(begin);
+        for (size_t t = begin; t < end; ++t) {
+            for (size_t corner = 0; corner < 3; ++corner)
+                misses += cache.access(indexs[t * 3 + corner]) ? 0 : 1;
+
+            size_t triangles = t + 1 - start;
+            if (t + 1 < end && triangles >= MIN_CLUSTER_TRIANGLES &&
+                static_cast<float>(misses) / static_cast<float>(triangles) <= target) {
+                boundaries.push_back(t + 1);
+                cache.flush();
+                start = t + 1;
+                misses = 0;
+            }
+        }
+    }
+    boundaries.push_back(triangleCount);
+
+    // 3. Centro de la malla ponderado por área
+    glm::vec3 meshCenter(0.0f);
+    float meshArea = 0.0f;
+    for (size_t t = 0; t < triangleCount; ++t) {
+        glm::vec3 a = trianglePosition(vertexs, indexs, t, 0);
+        glm::vec3 b = trianglePosition(vertexs, indexs, t, 1);
+        glm::vec3 c = trianglePosition(vertexs, indexs, t, 2);
+        float area = glm::length(glm::cross(b - a, c - a));
+        meshCenter += area * (a + b + c) / 3.0f;
+        meshArea += area;
+    }
+    if (meshArea > 0.0f)
+        meshCenter /= meshArea;
+
+    // 4. Los clusters que apuntan más hacia fuera ocluyen a los demás: van primero
+    size_t clusterCount = boundaries.size() - 1;
+    std::vector<float> sortKeys(clusterCount, 0.0f);
+    for (size_t cluster = 0; cluster < clusterCount; ++cluster) {
+        glm::vec3 center(0.0f);
+        glm::vec3 normal(0.0f);
+        float area = 0.0f;
+
+        for (size_t t = boundaries[cluster]; t < boundaries[cluster + 1]; ++t) {
+            glm::vec3 a = trianglePosition(vertexs, indexs, t, 0);
+            glm::vec3 b = trianglePosition(vertexs, indexs, t, 1);
+            glm::vec3 c = trianglePosition(vertexs, indexs, t, 2);
+            glm::vec3 cross = glm::cross(b - a, c - a);
+            float triangleArea = glm::length(cross);
+
+            center += triangleArea * (a + b + c) / 3.0f;
+            normal += cross;
+            area += triangleArea;
+        }
+
+        if (area > 0.0f)
+            center /= area;
+        if (glm::length(normal) > 0.0f)
+            normal = glm::normalize(normal);
+
+        sortKeys[cluster] = glm::dot(center - meshCenter, normal);
+    }
+
+    std::vector<size_t> order(clusterCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&sortKeys](size_t a, size_t b) {
+        return sortKeys[a] > sortKeys[b];
+    });
+
+    std::vector<GLuint> result;
+    result.reserve(indexs.size());
+    for (size_t cluster : order) {
+        result.insert(result.end(),
+                      indexs.begin() + boundaries[cluster] * 3,
+                      indexs.begin() + boundaries[cluster + 1] * 3);
+    }
+
+    return result;
+}
+
+void MeshOptimizer::optimizeVertexFetch(std::vector<Vertex>& vertexs, std::vector<GLuint>& indexs)
+{
+    if (!validIndexs(indexs, vertexs.size(), false, "OPTIMIZE_VERTEX_FETCH"))
+        return;
+
+    constexpr GLuint UNUSED = ~0u;
+    std::vector<GLuint> remap(vertexs.size(), UNUSED);
+    std::vector<Vertex> reordered;
+    reordered.reserve(vertexs.size());
+
+    for (GLuint& index : indexs) {
+        if (remap[index] == UNUSED) {
+            remap[index] = static_cast<GLuint>(reordered.size());
+            reordered.push_back(vertexs[index]);
+        }
+        index = remap[index];
+    }
+
+    vertexs.swap(reordered);
+}
+
+float MeshOptimizer::computeACMR(const std::vector<GLuint>& indexs, size_t vertexCount, GLuint cacheSize)
+{
+    if (indexs.size() < 3 || !validIndexs(indexs, vertexCount, false, "COMPUTE_ACMR"))
+        return 0.0f;
+
+    CacheResult result = simulateCache(indexs, vertexCount, cacheSize);
+    return static_cast<float>(result.misses) / static_cast<float>(indexs.size() / 3);
+}
+
+float MeshOptimizer::computeATVR(const std::vector<GLuint>& indexs, size_t vertexCount, GLuint cacheSize)
+{
+    if (!validIndexs(indexs, vertexCount, false, "COMPUTE_ATVR"))
+        return 0.0f;
+
+    CacheResult result = simulateCache(indexs, vertexCount, cacheSize);
+    if (result.uniqueVertices == 0)
+        return 0.0f;
+
+    return static_cast<float>(result.misses) / static_cast<float>(result.uniqueVertices);
+}
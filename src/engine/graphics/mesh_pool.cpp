@@ -0,0 +1,222 @@
+#include "engine/graphics/mesh_pool.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include <iostream>
+#include <cstddef>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    void setupAttribute(GLuint location, GLint size, size_t offset)
+    {
+        glVertexAttribPointer(location, size,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(Vertex),
+                              (void*)offset);
+        glEnableVertexAttribArray(location);
+    }
+
+} // namespace
+
+MeshPool::MeshPool(const VertexAttributes attributes,
+                   GLuint maxVertices,
+                   GLuint maxIndices,
+                   GLuint maxDraws)
+    : m_VAO(0)
+    , m_VBO(0)
+    , m_EBO(0)
+    , m_indirectBuffer(0)
+    , m_objectBuffer(0)
+    , m_maxVertices(maxVertices)
+    , m_maxIndices(maxIndices)
+    , m_maxDraws(maxDraws)
+    , m_usedVertices(0)
+    , m_usedIndices(0)
+    , m_attributes(attributes)
+{
+    m_commands.reserve(maxDraws);
+    m_objects.reserve(maxDraws);
+    setup();
+}
+
+MeshPool::~MeshPool()
+{
+    GLStateCache::deleteBuffer(m_VBO);
+    GLStateCache::deleteBuffer(m_EBO);
+    GLStateCache::deleteBuffer(m_indirectBuffer);
+    GLStateCache::deleteBuffer(m_objectBuffer);
+    GLStateCache::deleteVertexArray(m_VAO);
+}
+
+void MeshPool::setup()
+{
+    glGenVertexArrays(1, &m_VAO);
+    glGenBuffers(1, &m_VBO);
+    glGenBuffers(1, &m_EBO);
+    glGenBuffers(1, &m_indirectBuffer);
+    glGenBuffers(1, &m_objectBuffer);
+
+    GLStateCache::bindVertexArray(m_VAO);
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferStorage(GL_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>(m_maxVertices) * sizeof(Vertex),
+                    nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_EBO);
+    glBufferStorage(GL_ELEMENT_ARRAY_BUFFER,
+                    static_cast<GLsizeiptr>(m_maxIndices) * sizeof(GLuint),
+                    nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+
+    GLuint currentLocation = 0;
+
+    if (m_attributes & VertexAttributes::POSITION)
+        setupAttribute(currentLocation++, 3, offsetof(Vertex, m_position));
+    if (m_attributes & VertexAttributes::COLOR)
+        setupAttribute(currentLocation++, 4, offsetof(Vertex, m_color));
+    if (m_attributes & VertexAttributes::TEXCOORDS)
+        setupAttribute(currentLocation++, 2, offsetof(Vertex, m_texCoords));
+    if (m_attributes & VertexAttributes::NORMAL)
+        setupAttribute(currentLocation++, 3, offsetof(Vertex, m_normal));
+
+    GLStateCache::bindVertexArray(0);
+
+    GLStateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer);
+    glBufferStorage(GL_DRAW_INDIRECT_BUFFER,
+                    static_cast<GLsizeiptr>(m_maxDraws) * sizeof(DrawCommand),
+                    nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+    GLStateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    GLStateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_objectBuffer);
+    glBufferStorage(GL_SHADER_STORAGE_BUFFER,
+                    static_cast<GLsizeiptr>(m_maxDraws) * sizeof(ObjectData),
+                    nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+    GLStateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+MeshHandle MeshPool::add(const std::vector<Vertex>& vertexs,
+                         const std::vector<GLuint>& indexs)
+{
+    if (vertexs.size() > m_maxVertices - m_usedVertices ||
+        indexs.size() > m_maxIndices - m_usedIndices) {
+        std::cerr << "ERROR::MESH_POOL::OUT_OF_MEMORY: "
+                  << "Cannot fit " << vertexs.size() << " vertices and "
+                  << indexs.size() << " indices (free: "
+                  << m_maxVertices - m_usedVertices << " vertices, "
+                  << m_maxIndices - m_usedIndices << " indices)" << std::endl;
+        return MeshHandle();
+    }
+
+    MeshHandle handle;
+    handle.firstIndex = m_usedIndices;
+    handle.indexCount = static_cast<GLuint>(indexs.size());
+    handle.baseVertex = static_cast<GLint>(m_usedVertices);
+    handle.vertexCount = static_cast<GLuint>(vertexs.size());
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, m_VBO);
+    glBufferSubData(GL_ARRAY_BUFFER,
+                    static_cast<GLintptr>(m_usedVertices) * sizeof(Vertex),
+                    vertexs.size() * sizeof(Vertex),
+                    vertexs.data());
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+
+    GLStateCache::bindBuffer(GL_COPY_WRITE_BUFFER, m_EBO);
+    glBufferSubData(GL_COPY_WRITE_BUFFER,
+                    static_cast<GLintptr>(m_usedIndices) * sizeof(GLuint),
+                    indexs.size() * sizeof(GLuint),
+                    indexs.data());
+    GLStateCache::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    m_usedVertices += handle.vertexCount;
+    m_usedIndices += handle.indexCount;
+
+    return handle;
+}
+
+void MeshPool::submit(const MeshHandle& mesh, const ObjectData& object)
+{
+    if (!mesh.isValid())
+        return;
+
+    if (m_commands.size() >= m_maxDraws) {
+        std::cerr << "ERROR::MESH_POOL::TOO_MANY_DRAWS: "
+                  << "Pool only supports " << m_maxDraws << " draws per flush" << std::endl;
+        return;
+    }
+
+    DrawCommand command;
+    command.count = mesh.indexCount;
+    command.instanceCount = 1;
+    command.firstIndex = mesh.firstIndex;
+    command.baseVertex = mesh.baseVertex;
+    command.baseInstance = static_cast<GLuint>(m_commands.size());
+
+    m_commands.push_back(command);
+    m_objects.push_back(object);
+}
+
+void MeshPool::flush(const Shader& shader)
+{
+    if (m_commands.empty())
+        return;
+
+    shader.use();
+
+    GLStateCache::bindBuffer(GL_SHADER_STORAGE_BUFFER, m_objectBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0,
+                    m_objects.size() * sizeof(ObjectData),
+                    m_objects.data());
+    GLStateCache::bindBufferBase(GL_SHADER_STORAGE_BUFFER, OBJECT_DATA_BINDING, m_objectBuffer);
+
+    GLStateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, m_indirectBuffer);
+    glBufferSubData(GL_DRAW_INDIRECT_BUFFER, 0,
+                    m_commands.size() * sizeof(DrawCommand),
+                    m_commands.data());
+
+    GLStateCache::bindVertexArray(m_VAO);
+    glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr,
+                                static_cast<GLsizei>(m_commands.size()), 0);
+
+    GLStateCache::bindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+    clearDraws();
+}
+
+void MeshPool::clearDraws()
+{
+    m_commands.clear();
+    m_objects.clear();
+}
+
+void MeshPool::reset()
+{
+    clearDraws();
+    m_usedVertices = 0;
+    m_usedIndices = 0;
+}
+
+GLuint MeshPool::VAO() const
+{
+    return m_VAO;
+}
+
+size_t MeshPool::vertexCount() const
+{
+    return m_usedVertices;
+}
+
+size_t MeshPool::indexCount() const
+{
+    return m_usedIndices;
+}
+
+size_t MeshPool::drawCount() const
+{
+    return m_commands.size();
+}
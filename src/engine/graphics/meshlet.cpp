@@ -0,0 +1,371 @@
+#include "engine/graphics/meshlet.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ENGINE_MESHLET_SSE 1
+#endif
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    constexpr GLuint INVALID_TRIANGLE = std::numeric_limits<GLuint>::max();
+
+    /** Por debajo de este producto escalar las normales se consideran demasiado dispersas */
+    constexpr float MIN_CONE_DOT = 0.1f;
+
+    enum class Visibility { VISIBLE, OUTSIDE_FRUSTUM, BACK_FACING };
+
+    Visibility classify(const MeshletBounds& bounds, size_t i,
+                        const Frustum& frustum, const glm::vec3& camera)
+    {
+        for (int p = 0; p < 6; ++p) {
+            float distance = frustum.x[p] * bounds.centerX[i] + frustum.y[p] * bounds.centerY[i]
+                           + frustum.z[p] * bounds.centerZ[i] + frustum.w[p];
+            if (distance < -bounds.radius[i])
+                return Visibility::OUTSIDE_FRUSTUM;
+        }
+
+        glm::vec3 view(bounds.centerX[i] - camera.x, bounds.centerY[i] - camera.y, bounds.centerZ[i] - camera.z);
+        glm::vec3 axis(bounds.coneAxisX[i], bounds.coneAxisY[i], bounds.coneAxisZ[i]);
+        if (glm::dot(view, axis) >= bounds.coneCutoff[i] * glm::length(view) + bounds.radius[i])
+            return Visibility::BACK_FACING;
+
+        return Visibility::VISIBLE;
+    }
+
+    void computeBounds(const std::vector<Vertex>& vertexs,
+                       const std::vector<GLuint>& indexs,
+                       const Meshlet& meshlet,
+                       const std::vector<GLuint>& meshletVertices,
+                       MeshletBounds& bounds)
+    {
+        glm::vec3 minimum = vertexs[meshletVertices[0]].m_position;
+        glm::vec3 maximum = minimum;
+        for (GLuint v : meshletVertices) {
+            minimum = glm::min(minimum, vertexs[v].m_position);
+            maximum = glm::max(maximum, vertexs[v].m_position);
+        }
+
+        glm::vec3 center = (minimum + maximum) * 0.5f;
+        float radius = 0.0f;
+        for (GLuint v : meshletVertices)
+            radius = std::max(radius, glm::length(vertexs[v].m_position - center));
+
+        glm::vec3 normalSum(0.0f);
+        for (GLuint i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i += 3) {
+            const glm::vec3& p0 = vertexs[indexs[i]].m_position;
+            glm::vec3 normal = glm::cross(vertexs[indexs[i + 1]].m_position - p0,
+                                          vertexs[indexs[i + 2]].m_position - p0);
+            float length = glm::length(normal);
+            if (length > 0.0f)
+                normalSum += normal / length;
+        }
+
+        glm::vec3 axis(0.0f, 0.0f, 1.0f);
+        float cutoff = 1.0f;
+        float sumLength = glm::length(normalSum);
+        if (sumLength > 0.0f) {
+            axis = normalSum / sumLength;
+            float minDot = 1.0f;
+            for (GLuint i = meshlet.firstIndex; i < meshlet.firstIndex + meshlet.indexCount; i += 3) {
+                const glm::vec3& p0 = vertexs[indexs[i]].m_position;
+                glm::vec3 normal = glm::cross(vertexs[indexs[i + 1]].m_position - p0,
+                                              vertexs[indexs[i + 2]].m_position - p0);
+                float length = glm::length(normal);
+                if (length > 0.0f)
+                    minDot = std::min(minDot, glm::dot(axis, normal / length));
+            }
+
+            // cutoff = sin(ángulo del cono): de espaldas si el ángulo de visión supera 90º + apertura
+            if (minDot > MIN_CONE_DOT)
+                cutoff = std::sqrt(1.0f - minDot * minDot);
+        }
+
+        bounds.centerX.push_back(center.x);
+        bounds.centerY.push_back(center.y);
+        bounds.centerZ.push_back(center.z);
+        bounds.radius.push_back(radius);
+        bounds.coneAxisX.push_back(axis.x);
+        bounds.coneAxisY.push_back(axis.y);
+        bounds.coneAxisZ.push_back(axis.z);
+        bounds.coneCutoff.push_back(cutoff);
+    }
+
+} // namespace
+
+MeshletMesh::MeshletMesh(std::vector<Vertex>&& vertexs,
+                         MeshletData&& data,
+                         const std::vector<Texture*>& textures,
+                         const VertexAttributes attributes,
+                         const MeshQuantization& quantization,
+                         MeshResidency residency)
+    : m_mesh(std::move(vertexs), std::move(data.indexs), textures, attributes, quantization, residency)
+    , m_meshlets(std::move(data.meshlets))
+    , m_bounds(std::move(data.bounds))
+{
+    m_visibleRanges.reserve(m_meshlets.size());
+}
+
+MeshletMesh::MeshletMesh(std::vector<Vertex>&& vertexs,
+                         const std::vector<GLuint>& indexs,
+                         const std::vector<Texture*>& textures,
+                         const VertexAttributes attributes)
+    : MeshletMesh(std::move(vertexs), build(vertexs, indexs), textures, attributes)
+{
+}
+
+MeshletData MeshletMesh::build(const std::vector<Vertex>& vertexs,
+                               const std::vector<GLuint>& indexs,
+                               GLuint maxVertices,
+                               GLuint maxTriangles)
+{
+    MeshletData data;
+    maxVertices = std::max(maxVertices, 3u);
+    maxTriangles = std::max(maxTriangles, 1u);
+
+    std::vector<GLuint> sequential;
+    if (indexs.empty()) {
+        sequential.resize(vertexs.size() - vertexs.size() % 3);
+        std::iota(sequential.begin(), sequential.end(), 0u);
+    }
+    const std::vector<GLuint>& input = indexs.empty() ? sequential : indexs;
+    const size_t triangleCount = input.size() / 3;
+    const size_t vertexCount = vertexs.size();
+    if (triangleCount == 0)
+        return data;
+
+    std::vector<glm::vec3> normals(triangleCount);
+    for (size_t t = 0; t < triangleCount; ++t) {
+        const glm::vec3& p0 = vertexs[input[t * 3]].m_position;
+        glm::vec3 normal = glm::cross(vertexs[input[t * 3 + 1]].m_position - p0,
+                                      vertexs[input[t * 3 + 2]].m_position - p0);
+        float length = glm::length(normal);
+        normals[t] = length > 0.0f ? normal / length : glm::vec3(0.0f);
+    }
+
+    // Adyacencia vértice -> triángulos en formato CSR
+    std::vector<GLuint> offsets(vertexCount + 1, 0);
+    for (size_t i = 0; i < triangleCount * 3; ++i)
+        ++offsets[input[i] + 1];
+    for (size_t v = 0; v < vertexCount; ++v)
+        offsets[v + 1] += offsets[v];
+    std::vector<GLuint> adjacency(triangleCount * 3);
+    {
+        std::vector<GLuint> cursor(offsets.begin(), offsets.end() - 1);
+        for (size_t i = 0; i < triangleCount * 3; ++i)
+            adjacency[cursor[input[i]]++] = static_cast<GLuint>(i / 3);
+    }
+
+    std::vector<bool> emitted(triangleCount, false);
+    std::vector<GLuint> stamps(vertexCount, INVALID_TRIANGLE);
+    std::vector<GLuint> meshletVertices;
+    meshletVertices.reserve(maxVertices);
+
+    // Triángulos libres adyacentes al meshlet en construcción
+    std::vector<GLuint> candidates;
+    std::vector<GLuint> candidateStamps(triangleCount, INVALID_TRIANGLE);
+    data.indexs.reserve(triangleCount * 3);
+
+    GLuint meshletId = 0;
+    Meshlet current{0, 0, 0};
+    glm::vec3 normalSum(0.0f);
+    size_t scan = 0;
+
+    auto newVertices = [&](size_t t) {
+        GLuint count = 0;
+        for (int k = 0; k < 3; ++k)
+            count += stamps[input[t * 3 + k]] != meshletId;
+        return count;
+    };
+
+    auto finish = [&]() {
+        if (current.indexCount == 0)
+            return;
+        current.vertexCount = static_cast<GLuint>(meshletVertices.size());
+        computeBounds(vertexs, data.indexs, current, meshletVertices, data.bounds);
+        data.meshlets.push_back(current);
+        current = Meshlet{static_cast<GLuint>(data.indexs.size()), 0, 0};
+        meshletVertices.clear();
+        candidates.clear();
+        normalSum = glm::vec3(0.0f);
+        ++meshletId;
+    };
+
+    for (size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+        size_t best = INVALID_TRIANGLE;
+        float bestScore = std::numeric_limits<float>::max();
+        float sumLength = glm::length(normalSum);
+        glm::vec3 axis = sumLength > 0.0f ? normalSum / sumLength : glm::vec3(0.0f);
+
+        // Vecinos del cluster: primero los que añaden menos vértices, luego los más alineados
+        size_t write = 0;
+        for (GLuint t : candidates) {
+            if (emitted[t])
+                continue;
+            candidates[write++] = t;
+            GLuint added = newVertices(t);
+            if (meshletVertices.size() + added > maxVertices)
+                continue;
+            float score = static_cast<float>(added) + (1.0f - glm::dot(axis, normals[t]));
+            if (score < bestScore) {
+                bestScore = score;
+                best = t;
+            }
+        }
+        candidates.resize(write);
+
+        if (best == INVALID_TRIANGLE) {
+            while (emitted[scan])
+                ++scan;
+            // Sin vecinos libres: se cierra el cluster salvo que esté casi vacío
+            bool fits = meshletVertices.size() + newVertices(scan) <= maxVertices;
+            if (!fits || current.indexCount / 3 * 2 >= maxTriangles)
+                finish();
+            best = scan;
+        }
+
+        for (int k = 0; k < 3; ++k) {
+            GLuint v = input[best * 3 + k];
+            if (stamps[v] != meshletId) {
+                stamps[v] = meshletId;
+                meshletVertices.push_back(v);
+                for (GLuint i = offsets[v]; i < offsets[v + 1]; ++i) {
+                    GLuint t = adjacency[i];
+                    if (!emitted[t] && candidateStamps[t] != meshletId) {
+                        candidateStamps[t] = meshletId;
+                        candidates.push_back(t);
+                    }
+                }
+            }
+            data.indexs.push_back(v);
+        }
+        emitted[best] = true;
+        current.indexCount += 3;
+        normalSum += normals[best];
+
+        if (current.indexCount / 3 == maxTriangles)
+            finish();
+    }
+    finish();
+
+    return data;
+}
+
+size_t MeshletMesh::cull(const Camera& camera, const glm::mat4& model, float aspectRatio)
+{
+    // Planos en el espacio del objeto
+    const Frustum frustum = Frustum::fromMatrix(camera.getProjectionMatrix(aspectRatio) * camera.getViewMatrix() * model);
+    const glm::vec3 cameraPosition = glm::vec3(glm::inverse(model) * glm::vec4(camera.position(), 1.0f));
+
+    m_visibleRanges.clear();
+    m_stats = MeshletCullStats();
+    m_stats.meshletCount = m_meshlets.size();
+
+    auto accept = [&](size_t i) {
+        const Meshlet& meshlet = m_meshlets[i];
+        m_stats.visibleTriangles += meshlet.indexCount / 3;
+        if (!m_visibleRanges.empty()) {
+            IndexRange& last = m_visibleRanges.back();
+            if (last.firstIndex + static_cast<GLuint>(last.indexCount) == meshlet.firstIndex) {
+                last.indexCount += static_cast<GLsizei>(meshlet.indexCount);
+                return;
+            }
+        }
+        m_visibleRanges.push_back({meshlet.firstIndex, static_cast<GLsizei>(meshlet.indexCount)});
+    };
+
+    size_t i = 0;
+#ifdef ENGINE_MESHLET_SSE
+    const __m128 cameraX = _mm_set1_ps(cameraPosition.x);
+    const __m128 cameraY = _mm_set1_ps(cameraPosition.y);
+    const __m128 cameraZ = _mm_set1_ps(cameraPosition.z);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (; i + 4 <= m_meshlets.size(); i += 4) {
+        __m128 centerX = _mm_loadu_ps(&m_bounds.centerX[i]);
+        __m128 centerY = _mm_loadu_ps(&m_bounds.centerY[i]);
+        __m128 centerZ = _mm_loadu_ps(&m_bounds.centerZ[i]);
+        __m128 radius = _mm_loadu_ps(&m_bounds.radius[i]);
+        __m128 negativeRadius = _mm_sub_ps(zero, radius);
+
+        __m128 inside = _mm_cmpeq_ps(zero, zero);
+        for (int p = 0; p < 6; ++p) {
+            __m128 distance = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(frustum.x[p]), centerX),
+                           _mm_mul_ps(_mm_set1_ps(frustum.y[p]), centerY)),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(frustum.z[p]), centerZ),
+                           _mm_set1_ps(frustum.w[p])));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+        }
+
+        __m128 viewX = _mm_sub_ps(centerX, cameraX);
+        __m128 viewY = _mm_sub_ps(centerY, cameraY);
+        __m128 viewZ = _mm_sub_ps(centerZ, cameraZ);
+        __m128 viewLength = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(viewX, viewX), _mm_mul_ps(viewY, viewY)),
+                                                   _mm_mul_ps(viewZ, viewZ)));
+        __m128 axisDot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(viewX, _mm_loadu_ps(&m_bounds.coneAxisX[i])),
+                                               _mm_mul_ps(viewY, _mm_loadu_ps(&m_bounds.coneAxisY[i]))),
+                                    _mm_mul_ps(viewZ, _mm_loadu_ps(&m_bounds.coneAxisZ[i])));
+        __m128 backFacing = _mm_cmpge_ps(axisDot,
+                                         _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&m_bounds.coneCutoff[i]), viewLength), radius));
+
+        int insideMask = _mm_movemask_ps(inside);
+        int visibleMask = _mm_movemask_ps(_mm_andnot_ps(backFacing, inside));
+        for (int lane = 0; lane < 4; ++lane) {
+            if (!(insideMask & (1 << lane)))
+                ++m_stats.frustumCulled;
+            else if (!(visibleMask & (1 << lane)))
+                ++m_stats.coneCulled;
+            else
+                accept(i + lane);
+        }
+    }
+#endif
+
+    for (; i < m_meshlets.size(); ++i) {
+        switch (classify(m_bounds, i, frustum, cameraPosition)) {
+            case Visibility::OUTSIDE_FRUSTUM: ++m_stats.frustumCulled; break;
+            case Visibility::BACK_FACING:     ++m_stats.coneCulled; break;
+            case Visibility::VISIBLE:         accept(i); break;
+        }
+    }
+
+    m_stats.triangleCount = m_mesh.indexCount() / 3;
+    return m_stats.visibleTriangles;
+}
+
+void MeshletMesh::draw(const Shader& shader)
+{
+    m_mesh.drawRanges(shader, m_visibleRanges);
+}
+
+void MeshletMesh::drawAll(const Shader& shader)
+{
+    m_mesh.draw(shader);
+}
+
+Mesh& MeshletMesh::mesh()
+{
+    return m_mesh;
+}
+
+const std::vector<Meshlet>& MeshletMesh::meshlets() const
+{
+    return m_meshlets;
+}
+
+const MeshletBounds& MeshletMesh::bounds() const
+{
+    return m_bounds;
+}
+
+const MeshletCullStats& MeshletMesh::cullStats() const
+{
+    return m_stats;
+}
@@ -0,0 +1,603 @@
+#include "engine/graphics/obj_loader.hpp"
+#include "engine/core/mapped_file.hpp"
+#include "engine/core/parallel.hpp"
+#include "engine/graphics/mesh_optimizer.hpp"
+#include "engine/graphics/vertex_welder.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    /** Por debajo de este tamaño no compensa partir el archivo */
+    constexpr size_t MIN_CHUNK_BYTES = 1 << 20;
+
+    /** Bloques por hilo, para repartir mejor la carga entre hilos */
+    constexpr size_t CHUNKS_PER_THREAD = 4;
+
+    constexpr GLuint MISSING_INDEX = ~0u;
+
+    constexpr double POWERS_OF_TEN[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    /** Índices de una esquina de cara, ya resueltos a base 0 en los arreglos globales */
+    struct Corner {
+        GLuint position;
+        GLuint texCoords;
+        GLuint normal;
+    };
+
+    /** Cambio de material dentro de un bloque */
+    struct MaterialRun {
+        std::string name;
+        size_t firstCorner;
+    };
+
+    struct Chunk {
+        const char* begin;
+        const char* end;
+
+        // Pre-pasada: número de elementos y su posición global
+        size_t positionCount = 0;
+        size_t texCoordCount = 0;
+        size_t normalCount = 0;
+        size_t positionBase = 0;
+        size_t texCoordBase = 0;
+        size_t normalBase = 0;
+
+        // Pasada principal
+        std::vector<Corner> corners;
+        std::vector<MaterialRun> runs;
+        std::vector<std::string> libraries;
+        std::vector<glm::vec4> colors;
+        size_t invalidFaces = 0;
+    };
+
+    /** Datos compartidos entre bloques: cada bloque escribe en su rango */
+    struct Attributes {
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec2> texCoords;
+        std::vector<glm::vec3> normals;
+        std::vector<glm::vec4> colors;
+    };
+
+    bool isBlank(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r';
+    }
+
+    bool isDigit(char c)
+    {
+        return c >= '0' && c <= '9';
+    }
+
+    const char* skipBlanks(const char* p, const char* end)
+    {
+        while (p < end && isBlank(*p))
+            ++p;
+        return p;
+    }
+
+    const char* lineEnd(const char* p, const char* end)
+    {
+        const void* newline = std::memchr(p, '\n', end - p);
+        return newline ? static_cast<const char*>(newline) : end;
+    }
+
+    /**
+     * Conversión rápida de decimal a float: acumula hasta 19 dígitos
+     * significativos en un entero y aplica la potencia de diez al final.
+     */
+    const char* parseFloat(const char* p, const char* end, float& value)
+    {
+        p = skipBlanks(p, end);
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+            negative = *p++ == '-';
+
+        std::uint64_t mantissa = 0;
+        int digits = 0;
+        int exponent = 0;
+        const char* start = p;
+
+        for (; p < end && isDigit(*p); ++p) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (*p - '0');
+                digits += mantissa != 0;
+            }
+            else {
+                ++exponent;
+            }
+        }
+
+        if (p < end && *p == '.') {
+            for (++p; p < end && isDigit(*p); ++p) {
+                if (digits < 19) {
+                    mantissa = mantissa * 10 + (*p - '0');
+                    digits += mantissa != 0;
+                    --exponent;
+                }
+            }
+        }
+
+        if (p == start) {
+            value = 0.0f;
+            return p;
+        }
+
+        if (p < end && (*p == 'e' || *p == 'E')) {
+            ++p;
+            bool negativeExponent = false;
+            if (p < end && (*p == '-' || *p == '+'))
+                negativeExponent = *p++ == '-';
+            int e = 0;
+            for (; p < end && isDigit(*p); ++p)
+                e = std::min(e * 10 + (*p - '0'), 1000);
+            exponent += negativeExponent ? -e : e;
+        }
+
+        double result = static_cast<double>(mantissa);
+        if (exponent < 0)
+            result = exponent >= -22 ? result / POWERS_OF_TEN[-exponent] : result * std::pow(10.0, exponent);
+        else if (exponent > 0)
+            result = exponent <= 22 ? result * POWERS_OF_TEN[exponent] : result * std::pow(10.0, exponent);
+
+        value = static_cast<float>(negative ? -result : result);
+        return p;
+    }
+
+    const char* parseInt(const char* p, const char* end, long long& value)
+    {
+        bool negative = false;
+        if (p < end && (*p == '-' || *p == '+'))
+            negative = *p++ == '-';
+
+        value = 0;
+        for (; p < end && isDigit(*p); ++p)
+            value = value * 10 + (*p - '0');
+        if (negative)
+            value = -value;
+        return p;
+    }
+
+    /** Convierte un índice OBJ (base 1 o negativo relativo) a base 0 */
+    GLuint resolveIndex(long long index, size_t countSoFar, size_t total)
+    {
+        long long resolved = index > 0 ? index - 1 : static_cast<long long>(countSoFar) + index;
+        if (index == 0 || resolved < 0 || resolved >= static_cast<long long>(total))
+            return MISSING_INDEX;
+        return static_cast<GLuint>(resolved);
+    }
+
+    std::string_view trim(std::string_view text)
+    {
+        while (!text.empty() && (isBlank(text.front()) || text.front() == '\n'))
+            text.remove_prefix(1);
+        while (!text.empty() && (isBlank(text.back()) || text.back() == '\n'))
+            text.remove_suffix(1);
+        return text;
+    }
+
+    /** Identifica la palabra clave al inicio de la línea y devuelve el resto */
+    std::string_view keyword(const char*& p, const char* end)
+    {
+        p = skipBlanks(p, end);
+        const char* start = p;
+        while (p < end && !isBlank(*p))
+            ++p;
+        return std::string_view(start, p - start);
+    }
+
+    std::vector<Chunk> splitChunks(const char* data, size_t size, unsigned threadCount)
+    {
+        size_t chunkCount = std::clamp<size_t>(size / MIN_CHUNK_BYTES, 1, threadCount * CHUNKS_PER_THREAD);
+        std::vector<Chunk> chunks;
+        chunks.reserve(chunkCount);
+
+        const char* end = data + size;
+        const char* begin = data;
+        for (size_t i = 1; i <= chunkCount && begin < end; ++i) {
+            const char* split = i == chunkCount ? end : data + size * i / chunkCount;
+            if (split < begin)
+                split = begin;
+            split = split < end ? lineEnd(split, end) : end;
+            if (split < end)
+                ++split;
+
+            Chunk chunk;
+            chunk.begin = begin;
+            chunk.end = split;
+            chunks.push_back(std::move(chunk));
+            begin = split;
+        }
+        return chunks;
+    }
+
+    /** Pre-pasada: cuenta v, vt y vn para conocer la posición global de cada bloque */
+    void countElements(Chunk& chunk)
+    {
+        for (const char* p = chunk.begin; p < chunk.end;) {
+            const char* end = lineEnd(p, chunk.end);
+            const char* q = skipBlanks(p, end);
+            if (end - q >= 2 && q[0] == 'v') {
+                if (isBlank(q[1]))
+                    ++chunk.positionCount;
+                else if (q[1] == 't' && end - q >= 3 && isBlank(q[2]))
+                    ++chunk.texCoordCount;
+                else if (q[1] == 'n' && end - q >= 3 && isBlank(q[2]))
+                    ++chunk.normalCount;
+            }
+            p = end + 1;
+        }
+    }
+
+    void parseChunk(Chunk& chunk, Attributes& attributes, bool flipTexCoordsV)
+    {
+        size_t positionCount = 0;
+        size_t texCoordCount = 0;
+        size_t normalCount = 0;
+        std::vector<Corner> polygon;
+
+        for (const char* p = chunk.begin; p < chunk.end;) {
+            const char* end = lineEnd(p, chunk.end);
+            const char* q = p;
+            std::string_view key = keyword(q, end);
+            p = end + 1;
+
+            if (key == "v") {
+                glm::vec3& position = attributes.positions[chunk.positionBase + positionCount];
+                q = parseFloat(q, end, position.x);
+                q = parseFloat(q, end, position.y);
+                q = parseFloat(q, end, position.z);
+
+                // Extensión habitual: color RGB por vértice tras la posición (un
+                // único valor extra es la coordenada w y se ignora)
+                glm::vec4 color(1.0f);
+                int extra = 0;
+                for (q = skipBlanks(q, end); q < end && extra < 3; q = skipBlanks(q, end))
+                    q = parseFloat(q, end, color[extra++]);
+                if (extra == 3) {
+                    chunk.colors.resize(positionCount + 1, glm::vec4(1.0f));
+                    chunk.colors[positionCount] = color;
+                }
+                ++positionCount;
+            }
+            else if (key == "vt") {
+                glm::vec2& texCoords = attributes.texCoords[chunk.texCoordBase + texCoordCount++];
+                q = parseFloat(q, end, texCoords.x);
+                q = parseFloat(q, end, texCoords.y);
+                if (flipTexCoordsV)
+                    texCoords.y = 1.0f - texCoords.y;
+            }
+            else if (key == "vn") {
+                glm::vec3& normal = attributes.normals[chunk.normalBase + normalCount++];
+                q = parseFloat(q, end, normal.x);
+                q = parseFloat(q, end, normal.y);
+                q = parseFloat(q, end, normal.z);
+            }
+            else if (key == "f") {
+                polygon.clear();
+                bool valid = true;
+                for (q = skipBlanks(q, end); q < end; q = skipBlanks(q, end)) {
+                    long long position = 0, texCoords = 0, normal = 0;
+                    q = parseInt(q, end, position);
+                    if (q < end && *q == '/') {
+                        ++q;
+                        if (q < end && *q != '/')
+                            q = parseInt(q, end, texCoords);
+                        if (q < end && *q == '/')
+                            q = parseInt(q + 1, end, normal);
+                    }
+                    while (q < end && !isBlank(*q))
+                        ++q;
+
+                    Corner corner;
+                    corner.position = resolveIndex(position, chunk.positionBase + positionCount, attributes.positions.size());
+                    corner.texCoords = texCoords != 0 ? resolveIndex(texCoords, chunk.texCoordBase + texCoordCount, attributes.texCoords.size()) : MISSING_INDEX;
+                    corner.normal = normal != 0 ? resolveIndex(normal, chunk.normalBase + normalCount, attributes.normals.size()) : MISSING_INDEX;
+                    valid &= corner.position != MISSING_INDEX &&
+                             (texCoords == 0 || corner.texCoords != MISSING_INDEX) &&
+                             (normal == 0 || corner.normal != MISSING_INDEX);
+                    polygon.push_back(corner);
+                }
+
+                if (!valid || polygon.size() < 3) {
+                    ++chunk.invalidFaces;
+                    continue;
+                }
+                for (size_t i = 1; i + 1 < polygon.size(); ++i) {
+                    chunk.corners.push_back(polygon[0]);
+                    chunk.corners.push_back(polygon[i]);
+                    chunk.corners.push_back(polygon[i + 1]);
+                }
+            }
+            else if (key == "usemtl") {
+                chunk.runs.push_back({std::string(trim(std::string_view(q, end - q))), chunk.corners.size()});
+            }
+            else if (key == "mtllib") {
+                for (q = skipBlanks(q, end); q < end; q = skipBlanks(q, end)) {
+                    const char* start = q;
+                    while (q < end && !isBlank(*q))
+                        ++q;
+                    chunk.libraries.emplace_back(start, q - start);
+                }
+            }
+        }
+
+        if (!chunk.colors.empty())
+            chunk.colors.resize(positionCount, glm::vec4(1.0f));
+    }
+
+    void parseMaterialLibrary(const std::filesystem::path& path, std::vector<ObjMaterialData>& materials)
+    {
+        MappedFile file(path.string().c_str());
+        if (!file.isOpen() || file.size() == 0)
+            return;
+
+        const std::filesystem::path directory = path.parent_path();
+        const char* data = file.data();
+        const char* fileEnd = data + file.size();
+        ObjMaterialData* current = nullptr;
+
+        // Los mapas pueden llevar opciones (-bm 1.0 ...): la ruta es el último elemento
+        auto mapPath = [&](const char* q, const char* end) {
+            std::string_view rest = trim(std::string_view(q, end - q));
+            size_t split = rest.find_last_of(" \t");
+            std::string_view file = split == std::string_view::npos ? rest : rest.substr(split + 1);
+            return (directory / std::string(file)).string();
+        };
+
+        for (const char* p = data; p < fileEnd;) {
+            const char* end = lineEnd(p, fileEnd);
+            const char* q = p;
+            std::string_view key = keyword(q, end);
+            p = end + 1;
+
+            if (key == "newmtl") {
+                materials.emplace_back();
+                current = &materials.back();
+                current->name = std::string(trim(std::string_view(q, end - q)));
+            }
+            else if (current == nullptr) {
+                continue;
+            }
+            else if (key == "Ka") {
+                q = parseFloat(q, end, current->ambient.r);
+                q = parseFloat(q, end, current->ambient.g);
+                parseFloat(q, end, current->ambient.b);
+            }
+            else if (key == "Kd") {
+                q = parseFloat(q, end, current->diffuse.r);
+                q = parseFloat(q, end, current->diffuse.g);
+                parseFloat(q, end, current->diffuse.b);
+            }
+            else if (key == "Ks") {
+                q = parseFloat(q, end, current->specular.r);
+                q = parseFloat(q, end, current->specular.g);
+                parseFloat(q, end, current->specular.b);
+            }
+            else if (key == "Ns") {
+                parseFloat(q, end, current->shininess);
+            }
+            else if (key == "map_Kd") {
+                current->diffuseMap = mapPath(q, end);
+            }
+            else if (key == "map_Ks") {
+                current->specularMap = mapPath(q, end);
+            }
+        }
+    }
+
+} // namespace
+
+bool ObjLoader::parse(const char* path, ObjData& data, const ObjLoadParams& params)
+{
+    data = ObjData();
+
+    MappedFile file(path);
+    if (!file.isOpen())
+        return false;
+    if (file.size() == 0)
+        return true;
+
+    unsigned threadCount = resolveThreadCount(params.threadCount);
+    std::vector<Chunk> chunks = splitChunks(file.data(), file.size(), threadCount);
+
+    // 1. Pre-pasada paralela: número de elementos por bloque
+    parallelFor(chunks.size(), threadCount, [&](size_t i) { countElements(chunks[i]); });
+
+    Attributes attributes;
+    size_t positionCount = 0, texCoordCount = 0, normalCount = 0;
+    for (Chunk& chunk : chunks) {
+        chunk.positionBase = positionCount;
+        chunk.texCoordBase = texCoordCount;
+        chunk.normalBase = normalCount;
+        positionCount += chunk.positionCount;
+        texCoordCount += chunk.texCoordCount;
+        normalCount += chunk.normalCount;
+    }
+    attributes.positions.resize(positionCount);
+    attributes.texCoords.resize(texCoordCount);
+    attributes.normals.resize(normalCount);
+
+    // 2. Pasada paralela: cada bloque escribe sus atributos en su rango global
+    parallelFor(chunks.size(), threadCount, [&](size_t i) {
+        parseChunk(chunks[i], attributes, params.flipTexCoordsV);
+    });
+
+    size_t invalidFaces = 0;
+    bool hasColors = false;
+    for (const Chunk& chunk : chunks) {
+        invalidFaces += chunk.invalidFaces;
+        hasColors |= !chunk.colors.empty();
+    }
+    if (invalidFaces > 0) {
+        std::cerr << "ERROR::OBJ_LOADER::INVALID_FACES: " << invalidFaces
+                  << " faces with out of range indices skipped in " << path << std::endl;
+    }
+
+    if (hasColors) {
+        attributes.colors.resize(positionCount, glm::vec4(1.0f));
+        for (const Chunk& chunk : chunks)
+            std::copy(chunk.colors.begin(), chunk.colors.end(), attributes.colors.begin() + chunk.positionBase);
+    }
+
+    // 3. Materiales: bibliotecas MTL y grupos por material en orden de aparición
+    const std::filesystem::path directory = std::filesystem::path(path).parent_path();
+    for (const Chunk& chunk : chunks) {
+        for (const std::string& library : chunk.libraries)
+            parseMaterialLibrary(directory / library, data.materials);
+    }
+
+    std::unordered_map<std::string, int> materialIds;
+    for (size_t i = 0; i < data.materials.size(); ++i)
+        materialIds.emplace(data.materials[i].name, static_cast<int>(i));
+
+    std::vector<int> meshOfMaterial(data.materials.size() + 1, -1);
+    auto meshFor = [&](int material) {
+        int& mesh = meshOfMaterial[material + 1];
+        if (mesh < 0) {
+            mesh = static_cast<int>(data.meshes.size());
+            data.meshes.emplace_back();
+            data.meshes.back().material = material;
+        }
+        return mesh;
+    };
+
+    // Cada tramo de esquinas de un bloque se asigna a una malla y a un offset en ella
+    struct Span {
+        size_t chunk;
+        size_t firstCorner;
+        size_t cornerCount;
+        int mesh;
+        size_t offset;
+    };
+    std::vector<Span> spans;
+    std::vector<size_t> meshSizes;
+    int currentMaterial = -1;
+
+    for (size_t c = 0; c < chunks.size(); ++c) {
+        const Chunk& chunk = chunks[c];
+        size_t first = 0;
+        for (size_t r = 0; r <= chunk.runs.size(); ++r) {
+            size_t last = r < chunk.runs.size() ? chunk.runs[r].firstCorner : chunk.corners.size();
+            if (last > first) {
+                int mesh = meshFor(currentMaterial);
+                meshSizes.resize(data.meshes.size(), 0);
+                spans.push_back({c, first, last - first, mesh, meshSizes[mesh]});
+                meshSizes[mesh] += last - first;
+            }
+            if (r == chunk.runs.size())
+                break;
+
+            const std::string& name = chunk.runs[r].name;
+            auto found = materialIds.find(name);
+            if (found == materialIds.end()) {
+                std::cerr << "ERROR::OBJ_LOADER::MATERIAL_NOT_FOUND: " << name << std::endl;
+                ObjMaterialData material;
+                material.name = name;
+                data.materials.push_back(material);
+                meshOfMaterial.push_back(-1);
+                found = materialIds.emplace(name, static_cast<int>(data.materials.size() - 1)).first;
+            }
+            currentMaterial = found->second;
+            first = last;
+        }
+    }
+
+    data.attributes = VertexAttributes::POSITION;
+    if (hasColors)
+        data.attributes = data.attributes | VertexAttributes::COLOR;
+    if (texCoordCount > 0)
+        data.attributes = data.attributes | VertexAttributes::TEXCOORDS;
+    if (normalCount > 0)
+        data.attributes = data.attributes | VertexAttributes::NORMAL;
+
+    // 4. Sopa de vértices por malla, escrita en paralelo por tramos
+    for (size_t m = 0; m < data.meshes.size(); ++m)
+        data.meshes[m].vertexs.resize(meshSizes[m]);
+
+    parallelFor(spans.size(), threadCount, [&](size_t s) {
+        const Span& span = spans[s];
+        const Corner* corners = chunks[span.chunk].corners.data() + span.firstCorner;
+        Vertex* output = data.meshes[span.mesh].vertexs.data() + span.offset;
+
+        for (size_t i = 0; i < span.cornerCount; ++i) {
+            const Corner& corner = corners[i];
+            Vertex& vertex = output[i];
+            vertex.m_position = attributes.positions[corner.position];
+            if (hasColors)
+                vertex.m_color = attributes.colors[corner.position];
+            if (corner.texCoords != MISSING_INDEX)
+                vertex.m_texCoords = attributes.texCoords[corner.texCoords];
+            if (corner.normal != MISSING_INDEX)
+                vertex.m_normal = attributes.normals[corner.normal];
+        }
+    });
+
+    chunks.clear();
+    attributes = Attributes();
+
+    // 5. Soldadura (ya paralela) y optimización opcional de cada malla
+    VertexWeldParams weldParams;
+    weldParams.epsilon = params.weldEpsilon;
+    weldParams.threadCount = params.threadCount;
+    for (ObjMeshData& mesh : data.meshes) {
+        mesh.indexs = VertexWelder::weld(mesh.vertexs, weldParams);
+        if (params.optimize)
+            MeshOptimizer::optimize(mesh.vertexs, mesh.indexs);
+    }
+
+    return true;
+}
+
+ObjModel ObjLoader::load(const char* path, const ObjLoadParams& params)
+{
+    ObjModel model;
+    ObjData data;
+    if (!parse(path, data, params))
+        return model;
+
+    model.materials.reserve(data.materials.size());
+    for (const ObjMaterialData& source : data.materials) {
+        Material material;
+        material.ambient = source.ambient;
+        material.diffuse = source.diffuse;
+        material.specular = source.specular;
+        material.shininess = source.shininess;
+        if (!source.diffuseMap.empty())
+            material.diffuseMap = std::make_shared<Texture>(source.diffuseMap.c_str());
+        if (!source.specularMap.empty())
+            material.specularMap = std::make_shared<Texture>(source.specularMap.c_str());
+        model.materials.push_back(std::move(material));
+    }
+
+    model.meshes.reserve(data.meshes.size());
+    for (ObjMeshData& mesh : data.meshes) {
+        std::vector<Texture*> textures;
+        if (mesh.material >= 0) {
+            const Material& material = model.materials[mesh.material];
+            if (material.diffuseMap)
+                textures.push_back(material.diffuseMap.get());
+            if (material.specularMap)
+                textures.push_back(material.specularMap.get());
+        }
+
+        model.meshes.emplace_back(std::move(mesh.vertexs), std::move(mesh.indexs), textures,
+                                  data.attributes, MeshQuantization(), params.residency);
+        model.meshMaterials.push_back(mesh.material);
+    }
+
+    return model;
+}
@@ -0,0 +1,427 @@
+#include "engine/graphics/occlusion_culler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define ENGINE_OCCLUSION_SSE 1
+#endif
+
+using namespace engine::graphics;
+
+namespace {
+
+    /** Tamaño de los tiles que rasteriza cada hilo (el ancho es múltiplo de 4) */
+    constexpr int TILE_WIDTH = 64;
+    constexpr int TILE_HEIGHT = 32;
+
+    /** Texels por eje que se leen como mucho al comprobar un objeto */
+    constexpr int MAX_TEST_TEXELS = 4;
+
+    /** Distancia con signo al plano cercano en espacio de recorte (z >= -w) */
+    inline float nearDistance(const glm::vec4& vertex)
+    {
+        return vertex.z + vertex.w;
+    }
+
+    /**
+     * Planos de recorte en espacio de recorte, en el orden de los bits de
+     * outcode: izquierdo, derecho, inferior, superior y cercano. Recortar
+     * también los laterales acota las coordenadas de pantalla y con ellas el
+     * error de las funciones de arista.
+     */
+    constexpr glm::vec4 CLIP_PLANES[5] = {
+        glm::vec4(1.0f, 0.0f, 0.0f, 1.0f),
+        glm::vec4(-1.0f, 0.0f, 0.0f, 1.0f),
+        glm::vec4(0.0f, 1.0f, 0.0f, 1.0f),
+        glm::vec4(0.0f, -1.0f, 0.0f, 1.0f),
+        glm::vec4(0.0f, 0.0f, 1.0f, 1.0f)
+    };
+
+    /** Un bit por cada plano del frustum que deja fuera al vértice */
+    inline unsigned outcode(const glm::vec4& vertex)
+    {
+        return (vertex.x < -vertex.w ? 1u : 0u) | (vertex.x > vertex.w ? 2u : 0u)
+             | (vertex.y < -vertex.w ? 4u : 0u) | (vertex.y > vertex.w ? 8u : 0u)
+             | (vertex.z < -vertex.w ? 16u : 0u) | (vertex.z > vertex.w ? 32u : 0u);
+    }
+
+    /** Píxel que contiene una coordenada de pantalla, acotado a [0, size - 1] */
+    inline int pixelOf(float coordinate, int size)
+    {
+        return static_cast<int>(std::floor(std::clamp(coordinate, 0.0f, static_cast<float>(size - 1))));
+    }
+
+    /** Triángulos de una caja en sentido antihorario visto desde fuera */
+    constexpr GLuint BOX_INDEXS[36] = {
+        0, 2, 1,  1, 2, 3,   // -Z
+        4, 5, 6,  5, 7, 6,   // +Z
+        0, 1, 4,  1, 5, 4,   // -Y
+        2, 6, 3,  3, 6, 7,   // +Y
+        0, 4, 2,  2, 4, 6,   // -X
+        1, 3, 5,  3, 7, 5    // +X
+    };
+}
+
+OcclusionCuller::OcclusionCuller(const OcclusionCullerParams& params)
+    : m_width((std::max(4, params.width) + 3) & ~3)
+    , m_height(std::max(1, params.height))
+    , m_workers(params.threadCount)
+    , m_viewProjection(1.0f)
+    , m_frustum(Frustum::fromMatrix(glm::mat4(1.0f)))
+{
+    for (glm::ivec2 size(m_width, m_height);; size = (size + 1) / 2) {
+        m_levels.emplace_back(static_cast<size_t>(size.x) * size.y, 0.0f);
+        if (size.x == 1 && size.y == 1)
+            break;
+    }
+}
+
+void OcclusionCuller::beginFrame(const glm::mat4& viewProjection)
+{
+    m_viewProjection = viewProjection;
+    m_frustum = Frustum::fromMatrix(viewProjection);
+    m_triangles.clear();
+    m_stats = OcclusionStats();
+    for (std::vector<float>& level : m_levels)
+        std::fill(level.begin(), level.end(), 0.0f);
+}
+
+void OcclusionCuller::addOccluder(std::span<const glm::vec3> positions,
+                                  std::span<const GLuint> indexs,
+                                  const glm::mat4& model)
+{
+    if (indexs.size() % 3 != 0) {
+        std::cerr << "ERROR::OCCLUSION_CULLER::ADD_OCCLUDER: Index count " << indexs.size()
+                  << " is not a multiple of 3" << std::endl;
+        return;
+    }
+
+    const glm::mat4 modelViewProjection = m_viewProjection * model;
+    std::vector<glm::vec4>& clip = m_clipPositions;
+    clip.resize(positions.size());
+    unsigned outsideAll = 0x3f;
+    for (size_t i = 0; i < positions.size(); ++i) {
+        clip[i] = modelViewProjection * glm::vec4(positions[i], 1.0f);
+        outsideAll &= outcode(clip[i]);
+    }
+
+    // Toda la malla fuera de un mismo plano: no hace falta mirar sus triángulos
+    if (outsideAll != 0)
+        return;
+
+    for (size_t t = 0; t < indexs.size(); t += 3) {
+        if (indexs[t] >= clip.size() || indexs[t + 1] >= clip.size() || indexs[t + 2] >= clip.size()) {
+            std::cerr << "ERROR::OCCLUSION_CULLER::ADD_OCCLUDER: Index out of range (" << positions.size()
+                      << " vertices)" << std::endl;
+            return;
+        }
+
+        const glm::vec4* vertex[3] = { &clip[indexs[t]], &clip[indexs[t + 1]], &clip[indexs[t + 2]] };
+
+        // Descarte trivial si los tres vértices quedan fuera del mismo plano
+        const unsigned codes[3] = { outcode(*vertex[0]), outcode(*vertex[1]), outcode(*vertex[2]) };
+        if ((codes[0] & codes[1] & codes[2]) != 0)
+            continue;
+
+        const unsigned crossed = codes[0] | codes[1] | codes[2];
+        if ((crossed & 0x1f) == 0) {
+            addClipTriangle(*vertex[0], *vertex[1], *vertex[2]);
+            continue;
+        }
+
+        // Recorte de Sutherland-Hodgman solo contra los planos que corta: cada uno añade como mucho un vértice
+        glm::vec4 polygon[8] = { *vertex[0], *vertex[1], *vertex[2] };
+        int polygonSize = 3;
+        for (int p = 0; p < 5; ++p) {
+            if ((crossed & (1u << p)) == 0)
+                continue;
+            const glm::vec4& plane = CLIP_PLANES[p];
+            glm::vec4 clipped[8];
+            int clippedSize = 0;
+            for (int i = 0; i < polygonSize; ++i) {
+                const glm::vec4& current = polygon[i];
+                const glm::vec4& next = polygon[(i + 1) % polygonSize];
+                float currentDistance = glm::dot(plane, current);
+                float nextDistance = glm::dot(plane, next);
+                if (currentDistance >= 0.0f)
+                    clipped[clippedSize++] = current;
+                if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f))
+                    clipped[clippedSize++] = glm::mix(current, next, currentDistance / (currentDistance - nextDistance));
+            }
+            std::copy(clipped, clipped + clippedSize, polygon);
+            polygonSize = clippedSize;
+        }
+
+        for (int i = 2; i < polygonSize; ++i)
+            addClipTriangle(polygon[0], polygon[i - 1], polygon[i]);
+    }
+}
+
+void OcclusionCuller::addOccluder(const glm::vec3& boundsMin, const glm::vec3& boundsMax, const glm::mat4& model)
+{
+    glm::vec3 corners[8];
+    for (int i = 0; i < 8; ++i) {
+        corners[i] = glm::vec3((i & 1) ? boundsMax.x : boundsMin.x,
+                               (i & 2) ? boundsMax.y : boundsMin.y,
+                               (i & 4) ? boundsMax.z : boundsMin.z);
+    }
+    addOccluder(corners, BOX_INDEXS, model);
+}
+
+void OcclusionCuller::addClipTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c)
+{
+    // Coordenadas de pantalla con el origen abajo a la izquierda y profundidad 1/w
+    const glm::vec4* clip[3] = { &a, &b, &c };
+    glm::vec2 screen[3];
+    float depth[3];
+    for (int i = 0; i < 3; ++i) {
+        depth[i] = 1.0f / clip[i]->w;
+        screen[i] = glm::vec2((clip[i]->x * depth[i] * 0.5f + 0.5f) * m_width,
+                              (clip[i]->y * depth[i] * 0.5f + 0.5f) * m_height);
+    }
+
+    // Las caras traseras no aportan nada en mallas cerradas: su cara delantera está más cerca
+    const float area = (screen[1].x - screen[0].x) * (screen[2].y - screen[0].y)
+                     - (screen[1].y - screen[0].y) * (screen[2].x - screen[0].x);
+    if (!(area > 0.0f))
+        return;
+
+    ScreenTriangle triangle;
+    triangle.minX = pixelOf(std::min({ screen[0].x, screen[1].x, screen[2].x }), m_width);
+    triangle.minY = pixelOf(std::min({ screen[0].y, screen[1].y, screen[2].y }), m_height);
+    triangle.maxX = pixelOf(std::max({ screen[0].x, screen[1].x, screen[2].x }), m_width);
+    triangle.maxY = pixelOf(std::max({ screen[0].y, screen[1].y, screen[2].y }), m_height);
+
+    // Arista i opuesta al vértice i: E(p) = A * x + B * y + C, positiva dentro del triángulo
+    const float inverseArea = 1.0f / area;
+    triangle.depthA = triangle.depthB = triangle.depthC = 0.0f;
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec2& from = screen[(i + 1) % 3];
+        const glm::vec2& to = screen[(i + 2) % 3];
+        triangle.edgeA[i] = from.y - to.y;
+        triangle.edgeB[i] = to.x - from.x;
+        triangle.edgeC[i] = from.x * to.y - from.y * to.x;
+
+        // La arista i normalizada por el área es la coordenada baricéntrica del vértice i
+        triangle.depthA += triangle.edgeA[i] * inverseArea * depth[i];
+        triangle.depthB += triangle.edgeB[i] * inverseArea * depth[i];
+        triangle.depthC += triangle.edgeC[i] * inverseArea * depth[i];
+    }
+
+    m_triangles.push_back(triangle);
+}
+
+void OcclusionCuller::rasterize()
+{
+    m_stats.occluderTriangles = m_triangles.size();
+
+    const int tilesX = (m_width + TILE_WIDTH - 1) / TILE_WIDTH;
+    const int tilesY = (m_height + TILE_HEIGHT - 1) / TILE_HEIGHT;
+    m_workers.run(static_cast<size_t>(tilesX) * tilesY, [&](size_t tile) {
+        rasterizeTile(static_cast<int>(tile % tilesX), static_cast<int>(tile / tilesX));
+    });
+
+    buildLevels();
+}
+
+void OcclusionCuller::rasterizeTile(int tileX, int tileY)
+{
+    const int tileMinX = tileX * TILE_WIDTH;
+    const int tileMinY = tileY * TILE_HEIGHT;
+    const int tileMaxX = std::min(m_width, tileMinX + TILE_WIDTH) - 1;
+    const int tileMaxY = std::min(m_height, tileMinY + TILE_HEIGHT) - 1;
+    float* depth = m_levels[0].data();
+
+    for (const ScreenTriangle& triangle : m_triangles) {
+        if (triangle.maxX < tileMinX || triangle.minX > tileMaxX || triangle.maxY < tileMinY || triangle.minY > tileMaxY)
+            continue;
+
+        // Empieza en un múltiplo de 4 para que cada grupo de 4 píxeles caiga dentro del tile
+        const int minX = std::max(tileMinX, triangle.minX) & ~3;
+        const int maxX = std::min(tileMaxX, triangle.maxX);
+        const int minY = std::max(tileMinY, triangle.minY);
+        const int maxY = std::min(tileMaxY, triangle.maxY);
+
+        for (int y = minY; y <= maxY; ++y) {
+            const float centerY = y + 0.5f;
+            float* row = depth + static_cast<size_t>(y) * m_width;
+            int x = minX;
+
+#if defined(ENGINE_OCCLUSION_SSE)
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 offsets = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+            __m128 edgeA[3], edgeRow[3];
+            for (int i = 0; i < 3; ++i) {
+                edgeA[i] = _mm_set1_ps(triangle.edgeA[i]);
+                edgeRow[i] = _mm_set1_ps(triangle.edgeB[i] * centerY + triangle.edgeC[i]);
+            }
+            const __m128 depthA = _mm_set1_ps(triangle.depthA);
+            const __m128 depthRow = _mm_set1_ps(triangle.depthB * centerY + triangle.depthC);
+
+            for (; x <= maxX; x += 4) {
+                const __m128 centerX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), offsets);
+                __m128 inside = _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[0], centerX), edgeRow[0]), zero);
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[1], centerX), edgeRow[1]), zero));
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(_mm_add_ps(_mm_mul_ps(edgeA[2], centerX), edgeRow[2]), zero));
+                if (_mm_movemask_ps(inside) == 0)
+                    continue;
+
+                const __m128 current = _mm_loadu_ps(row + x);
+                const __m128 triangleDepth = _mm_add_ps(_mm_mul_ps(depthA, centerX), depthRow);
+                const __m128 nearest = _mm_max_ps(current, triangleDepth);
+                _mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, current)));
+            }
+#endif
+
+            for (; x <= maxX; ++x) {
+                const float centerX = x + 0.5f;
+                bool inside = true;
+                for (int i = 0; i < 3; ++i)
+                    inside = inside && triangle.edgeA[i] * centerX + triangle.edgeB[i] * centerY + triangle.edgeC[i] >= 0.0f;
+                if (inside)
+                    row[x] = std::max(row[x], triangle.depthA * centerX + triangle.depthB * centerY + triangle.depthC);
+            }
+        }
+    }
+}
+
+void OcclusionCuller::buildLevels()
+{
+    for (size_t level = 1; level < m_levels.size(); ++level) {
+        const glm::ivec2 source = levelSize(level - 1);
+        const glm::ivec2 target = levelSize(level);
+        const std::vector<float>& fine = m_levels[level - 1];
+        std::vector<float>& coarse = m_levels[level];
+
+        for (int y = 0; y < target.y; ++y) {
+            const int y0 = 2 * y;
+            const int y1 = std::min(y0 + 1, source.y - 1);
+            for (int x = 0; x < target.x; ++x) {
+                const int x0 = 2 * x;
+                const int x1 = std::min(x0 + 1, source.x - 1);
+                coarse[static_cast<size_t>(y) * target.x + x] = std::min(
+                    std::min(fine[static_cast<size_t>(y0) * source.x + x0], fine[static_cast<size_t>(y0) * source.x + x1]),
+                    std::min(fine[static_cast<size_t>(y1) * source.x + x0], fine[static_cast<size_t>(y1) * source.x + x1]));
+            }
+        }
+    }
+}
+
+glm::ivec2 OcclusionCuller::levelSize(size_t level) const
+{
+    glm::ivec2 size(m_width, m_height);
+    for (size_t i = 0; i < level; ++i)
+        size = (size + 1) / 2;
+    return size;
+}
+
+bool OcclusionCuller::isVisible(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const
+{
+    return m_frustum.intersects(boundsMin, boundsMax) && !isOccluded(boundsMin, boundsMax);
+}
+
+bool OcclusionCuller::isOccluded(const glm::vec3& boundsMin, const glm::vec3& boundsMax) const
+{
+    // Rectángulo en pantalla y punto más cercano de la caja
+    glm::vec2 screenMin(FLT_MAX), screenMax(-FLT_MAX);
+    float nearestDepth = 0.0f;
+
+    // Las esquinas se obtienen sumando a la primera las columnas escaladas por el tamaño de la caja
+    const glm::vec4 origin = m_viewProjection * glm::vec4(boundsMin, 1.0f);
+    const glm::vec3 extent = boundsMax - boundsMin;
+    const glm::vec4 axisX = m_viewProjection[0] * extent.x;
+    const glm::vec4 axisY = m_viewProjection[1] * extent.y;
+    const glm::vec4 axisZ = m_viewProjection[2] * extent.z;
+    for (int i = 0; i < 8; ++i) {
+        glm::vec4 clip = origin;
+        if (i & 1)
+            clip += axisX;
+        if (i & 2)
+            clip += axisY;
+        if (i & 4)
+            clip += axisZ;
+        // Una caja que cruza el plano cercano envuelve a la cámara o casi: nunca se descarta
+        if (nearDistance(clip) <= 0.0f)
+            return false;
+
+        float inverseW = 1.0f / clip.w;
+        glm::vec2 screen((clip.x * inverseW * 0.5f + 0.5f) * m_width, (clip.y * inverseW * 0.5f + 0.5f) * m_height);
+        screenMin = glm::min(screenMin, screen);
+        screenMax = glm::max(screenMax, screen);
+        nearestDepth = std::max(nearestDepth, inverseW);
+    }
+
+    if (screenMax.x < 0.0f || screenMax.y < 0.0f || screenMin.x >= m_width || screenMin.y >= m_height)
+        return true;
+    int minX = pixelOf(screenMin.x, m_width);
+    int minY = pixelOf(screenMin.y, m_height);
+    int maxX = pixelOf(screenMax.x, m_width);
+    int maxY = pixelOf(screenMax.y, m_height);
+
+    // Nivel de la pirámide en el que el rectángulo ocupa como mucho MAX_TEST_TEXELS por eje
+    size_t level = 0;
+    while (level + 1 < m_levels.size() && ((maxX - minX) >= MAX_TEST_TEXELS || (maxY - minY) >= MAX_TEST_TEXELS)) {
+        minX /= 2;
+        minY /= 2;
+        maxX /= 2;
+        maxY /= 2;
+        ++level;
+    }
+
+    const std::vector<float>& depth = m_levels[level];
+    const int levelWidth = levelSize(level).x;
+    for (int y = minY; y <= maxY; ++y) {
+        for (int x = minX; x <= maxX; ++x) {
+            if (depth[static_cast<size_t>(y) * levelWidth + x] <= nearestDepth)
+                return false;
+        }
+    }
+    return true;
+}
+
+size_t OcclusionCuller::cull(const BoxBatch& boxes, std::vector<GLuint>& visible)
+{
+    // Primero el culling SIMD por frustum; solo los supervivientes se proyectan
+    m_frustum.cull(boxes, visible);
+    m_stats.testedObjects = boxes.size();
+    m_stats.frustumCulled = boxes.size() - visible.size();
+
+    size_t kept = 0;
+    for (GLuint object : visible) {
+        if (!isOccluded(glm::vec3(boxes.minX[object], boxes.minY[object], boxes.minZ[object]),
+                        glm::vec3(boxes.maxX[object], boxes.maxY[object], boxes.maxZ[object])))
+            visible[kept++] = object;
+    }
+    m_stats.occluded = visible.size() - kept;
+    visible.resize(kept);
+
+    m_stats.visible = visible.size();
+    return visible.size();
+}
+
+const std::vector<float>& OcclusionCuller::depth(size_t level) const
+{
+    return m_levels[std::min(level, m_levels.size() - 1)];
+}
+
+size_t OcclusionCuller::levelCount() const
+{
+    return m_levels.size();
+}
+
+int OcclusionCuller::width() const
+{
+    return m_width;
+}
+
+int OcclusionCuller::height() const
+{
+    return m_height;
+}
+
+const OcclusionStats& OcclusionCuller::stats() const
+{
+    return m_stats;
+}
@@ -0,0 +1,116 @@
+#include "engine/graphics/primitives.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include <cstddef>
+#include <iostream>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+PrimitiveBuffer::PrimitiveBuffer(std::initializer_list<PrimitiveView> primitives)
+    : m_VBO(0)
+    , m_EBO(0)
+{
+    size_t totalVertices = 0;
+    size_t totalIndices = 0;
+    for (const PrimitiveView& primitive : primitives) {
+        totalVertices += primitive.vertexs.size();
+        totalIndices += primitive.indexs.size();
+    }
+
+    if (totalVertices == 0) {
+        std::cerr << "ERROR::PRIMITIVE_BUFFER::EMPTY: No primitives to upload" << std::endl;
+        return;
+    }
+
+    glGenBuffers(1, &m_VBO);
+    GLStateCache::bindBuffer(GL_COPY_WRITE_BUFFER, m_VBO);
+    glBufferStorage(GL_COPY_WRITE_BUFFER,
+                    static_cast<GLsizeiptr>(totalVertices * sizeof(Vertex)),
+                    nullptr,
+                    GL_DYNAMIC_STORAGE_BIT);
+
+    size_t firstVertex = 0;
+    for (const PrimitiveView& primitive : primitives) {
+        glBufferSubData(GL_COPY_WRITE_BUFFER,
+                        static_cast<GLintptr>(firstVertex * sizeof(Vertex)),
+                        static_cast<GLsizeiptr>(primitive.vertexs.size_bytes()),
+                        primitive.vertexs.data());
+        firstVertex += primitive.vertexs.size();
+    }
+
+    if (totalIndices > 0) {
+        glGenBuffers(1, &m_EBO);
+        GLStateCache::bindBuffer(GL_COPY_WRITE_BUFFER, m_EBO);
+        glBufferStorage(GL_COPY_WRITE_BUFFER,
+                        static_cast<GLsizeiptr>(totalIndices * sizeof(GLuint)),
+                        nullptr,
+                        GL_DYNAMIC_STORAGE_BIT);
+    }
+
+    m_layouts.reserve(primitives.size());
+    firstVertex = 0;
+    size_t firstIndex = 0;
+    for (const PrimitiveView& primitive : primitives) {
+        if (!primitive.indexs.empty()) {
+            glBufferSubData(GL_COPY_WRITE_BUFFER,
+                            static_cast<GLintptr>(firstIndex * sizeof(GLuint)),
+                            static_cast<GLsizeiptr>(primitive.indexs.size_bytes()),
+                            primitive.indexs.data());
+        }
+
+        MeshGpuLayout layout;
+        layout.attributes = VertexAttributes::POSITION | VertexAttributes::COLOR |
+                            VertexAttributes::TEXCOORDS | VertexAttributes::NORMAL;
+        layout.vertexStride = sizeof(Vertex);
+        layout.attributeOffsets[0] = offsetof(Vertex, m_position);
+        layout.attributeOffsets[1] = offsetof(Vertex, m_color);
+        layout.attributeOffsets[2] = offsetof(Vertex, m_texCoords);
+        layout.attributeOffsets[3] = offsetof(Vertex, m_normal);
+        layout.indexType = GL_UNSIGNED_INT;
+        layout.vertexCount = static_cast<GLsizei>(primitive.vertexs.size());
+        layout.indexCount = static_cast<GLsizei>(primitive.indexs.size());
+        layout.baseVertex = static_cast<GLint>(firstVertex);
+        layout.indexOffset = static_cast<GLintptr>(firstIndex * sizeof(GLuint));
+        if (!primitive.vertexs.empty()) {
+            layout.boundsMin = primitive.vertexs[0].m_position;
+            layout.boundsMax = primitive.vertexs[0].m_position;
+            for (const Vertex& vertex : primitive.vertexs) {
+                layout.boundsMin = glm::min(layout.boundsMin, vertex.m_position);
+                layout.boundsMax = glm::max(layout.boundsMax, vertex.m_position);
+            }
+        }
+        m_layouts.push_back(layout);
+
+        firstVertex += primitive.vertexs.size();
+        firstIndex += primitive.indexs.size();
+    }
+
+    GLStateCache::bindBuffer(GL_COPY_WRITE_BUFFER, 0);
+}
+
+PrimitiveBuffer::~PrimitiveBuffer()
+{
+    if (m_VBO != 0)
+        GLStateCache::deleteBuffer(m_VBO);
+    if (m_EBO != 0)
+        GLStateCache::deleteBuffer(m_EBO);
+}
+
+Mesh PrimitiveBuffer::mesh(size_t primitive,
+                           const std::vector<Texture*>& textures,
+                           const VertexAttributes attributes) const
+{
+    MeshGpuLayout layout = this->layout(primitive);
+    layout.attributes = attributes;
+    return Mesh(m_VBO, m_EBO, layout, textures);
+}
+
+const MeshGpuLayout& PrimitiveBuffer::layout(size_t primitive) const
+{
+    return m_layouts[primitive];
+}
+
+size_t PrimitiveBuffer::primitiveCount() const
+{
+    return m_layouts.size();
+}
@@ -0,0 +1,203 @@
+#include "engine/graphics/program_cache.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <system_error>
+#include <vector>
+
+using namespace engine::graphics;
+
+std::filesystem::path ProgramCache::directoryPath = "shader_cache";
+ProgramCacheStats ProgramCache::cacheStats;
+
+namespace {
+
+    /** "EPB1" en little endian */
+    constexpr uint32_t CACHE_MAGIC = 0x31425045;
+
+    struct EntryHeader {
+        uint32_t magic;
+        uint32_t format;
+        uint64_t key;
+        uint64_t length;
+    };
+
+    void hashBytes(uint64_t& hash, const void* data, size_t size)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 1099511628211ull;
+        }
+    }
+
+    // El separador evita que "ab" + "c" y "a" + "bc" den la misma clave
+    void hashString(uint64_t& hash, std::string_view text)
+    {
+        hashBytes(hash, text.data(), text.size());
+        hashBytes(hash, "", 1);
+    }
+
+    std::string_view glString(GLenum name)
+    {
+        const GLubyte* value = glGetString(name);
+        return value ? reinterpret_cast<const char*>(value) : "";
+    }
+
+} // namespace
+
+std::filesystem::path ProgramCache::entryPath(uint64_t key)
+{
+    std::ostringstream name;
+    name << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return directoryPath / name.str();
+}
+
+void ProgramCache::setDirectory(const std::filesystem::path& directory)
+{
+    directoryPath = directory;
+}
+
+const std::filesystem::path& ProgramCache::directory()
+{
+    return directoryPath;
+}
+
+uint64_t ProgramCache::key(std::initializer_list<std::string_view> sources)
+{
+    uint64_t hash = 14695981039346656037ull;
+    hashString(hash, glString(GL_VENDOR));
+    hashString(hash, glString(GL_RENDERER));
+    hashString(hash, glString(GL_VERSION));
+    for (std::string_view source : sources) {
+        hashString(hash, source);
+    }
+
+    return hash;
+}
+
+bool ProgramCache::enabled()
+{
+    if (directoryPath.empty()) {
+        return false;
+    }
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    return formats > 0;
+}
+
+GLuint ProgramCache::load(uint64_t key)
+{
+    if (!enabled()) {
+        return 0;
+    }
+
+    const std::filesystem::path path = entryPath(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        ++cacheStats.misses;
+        return 0;
+    }
+
+    EntryHeader header{};
+    std::vector<char> binary;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    bool valid = file && header.magic == CACHE_MAGIC && header.key == key && header.length > 0 &&
+                 header.length <= static_cast<uint64_t>(INT32_MAX);
+    if (valid) {
+        binary.resize(header.length);
+        file.read(binary.data(), static_cast<std::streamsize>(binary.size()));
+        valid = static_cast<bool>(file);
+    }
+    file.close();
+
+    GLuint program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        glProgramBinary(program, header.format, binary.data(), static_cast<GLsizei>(binary.size()));
+
+        GLint linked = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &linked);
+        if (!linked) {
+            GLStateCache::deleteProgram(program);
+            program = 0;
+        }
+    }
+
+    // Un binario truncado o de otro driver se borra para que se regenere
+    if (program == 0) {
+        std::error_code error;
+        std::filesystem::remove(path, error);
+        ++cacheStats.rejected;
+        ++cacheStats.misses;
+        return 0;
+    }
+
+    ++cacheStats.hits;
+    return program;
+}
+
+void ProgramCache::store(uint64_t key, GLuint program)
+{
+    if (program == 0 || !enabled()) {
+        return;
+    }
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<char> binary(length);
+    GLsizei written = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directoryPath, error);
+    if (error) {
+        std::cerr << "ERROR::PROGRAM_CACHE::DIRECTORY_FAILED: " << directoryPath.string()
+                  << " (" << error.message() << ")" << std::endl;
+        return;
+    }
+
+    // Nombre temporal único para que dos procesos no escriban el mismo fichero
+    const std::filesystem::path path = entryPath(key);
+    std::filesystem::path temporary = path;
+    temporary += "." + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + ".tmp";
+
+    EntryHeader header{ CACHE_MAGIC, format, key, static_cast<uint64_t>(written) };
+    std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+    file.close();
+
+    if (!file) {
+        std::cerr << "ERROR::PROGRAM_CACHE::WRITE_FAILED: " << temporary.string() << std::endl;
+        std::filesystem::remove(temporary, error);
+        return;
+    }
+
+    std::filesystem::rename(temporary, path, error);
+    if (error) {
+        std::cerr << "ERROR::PROGRAM_CACHE::WRITE_FAILED: " << path.string()
+                  << " (" << error.message() << ")" << std::endl;
+        std::filesystem::remove(temporary, error);
+        return;
+    }
+
+    ++cacheStats.stores;
+}
+
+const ProgramCacheStats& ProgramCache::stats()
+{
+    return cacheStats;
+}
@@ -1,30 +1,13 @@
 #include "engine/graphics/shader.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include "engine/graphics/camera_uniforms.hpp"
+#include "engine/graphics/program_cache.hpp"
+#include <algorithm>
 
 using namespace engine::graphics;
 
 namespace {
 
-    std::string loadShaderFromFile(const char* shaderPath)
-    {
-        std::string shaderCode;
-        std::ifstream shaderFile;
-
-        shaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
-        try {
-            shaderFile.open(shaderPath);
-            std::stringstream shaderStream;
-
-            shaderStream << shaderFile.rdbuf();
-            shaderFile.close();
-            shaderCode = shaderStream.str();
-        } catch (std::ifstream::failure& e) {
-            std::cout << "ERROR::SHADER::FILE_NOT_SUCCEFULLY_READ" << std::endl;
-        }
-
-        return shaderCode;
-    }
-
     GLuint compileShader(const char* shaderCode, GLenum shaderType, const std::string& typeName)
     {
         int sucess;
@@ -55,6 +38,9 @@ namespace {
         GLuint program = glCreateProgram();
         glAttachShader(program, vertexShader);
         glAttachShader(program, fragmentShader);
+        if (ProgramCache::enabled()) {
+            glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        }
         glLinkProgram(program);
 
         int sucess;
@@ -63,7 +49,7 @@ namespace {
         if (!sucess) {
             glGetProgramInfoLog(program, 512, NULL, infolog);
             std::cerr << "ERROR::SHADER::PROGRAM::LINKED_FAILED\n" << infolog << std::endl;
-            glDeleteProgram(program);
+            GLStateCache::deleteProgram(program);
             return 0;
         }
 
@@ -72,30 +58,238 @@ namespace {
 
 } // namespace
 
-Shader::Shader(const char* vertexPath, const char* fragmentPath)
+Shader::Shader(const char* vertexPath, const char* fragmentPath, const ShaderDefines& defines)
+    : m_uniformCount(0)
+    , m_activeUniformCount(0)
 {
-    std::string vertexCode = loadShaderFromFile(vertexPath);
-    std::string fragmentCode = loadShaderFromFile(fragmentPath);
+    std::string vertexCode = ShaderPreprocessor::load(vertexPath, defines).code;
+    std::string fragmentCode = ShaderPreprocessor::load(fragmentPath, defines).code;
+
+    // Si el binario está en caché no se compila nada
+    uint64_t cacheKey = ProgramCache::key({ vertexCode, fragmentCode });
+    m_ID = ProgramCache::load(cacheKey);
+    if (m_ID == 0) {
+        GLuint vertexShader = compileShader(vertexCode.c_str(), GL_VERTEX_SHADER, "VERTEX");
+        GLuint fragmentShader = compileShader(fragmentCode.c_str(), GL_FRAGMENT_SHADER, "FRAGMENT");
+
+        m_ID = createShaderProgram(vertexShader, fragmentShader);
+        ProgramCache::store(cacheKey, m_ID);
 
-    GLuint vertexShader = compileShader(vertexCode.c_str(), GL_VERTEX_SHADER, "VERTEX");
-    GLuint fragmentShader = compileShader(fragmentCode.c_str(), GL_FRAGMENT_SHADER, "FRAGMENT");
+        glDeleteShader(vertexShader);
+        glDeleteShader(fragmentShader);
+    }
 
-    m_ID = createShaderProgram(vertexShader, fragmentShader);
+    initialize();
+}
 
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+Shader::Shader(GLuint program)
+    : m_ID(program)
+    , m_uniformCount(0)
+    , m_activeUniformCount(0)
+{
+    initialize();
 }
 
 Shader::~Shader()
 {
     if (m_ID != 0) {
-        glDeleteProgram(m_ID);
+        GLStateCache::deleteProgram(m_ID);
+    }
+}
+
+void Shader::initialize()
+{
+    // El bloque de la cámara se enlaza aunque el GLSL no declare binding explícito
+    if (m_ID != 0) {
+        GLuint cameraBlock = glGetUniformBlockIndex(m_ID, CAMERA_UNIFORM_BLOCK);
+        if (cameraBlock != GL_INVALID_INDEX) {
+            glUniformBlockBinding(m_ID, cameraBlock, CAMERA_UNIFORM_BINDING);
+        }
+    }
+
+    reflectUniforms();
+}
+
+void Shader::reflectUniforms()
+{
+    m_uniforms.assign(16, UniformSlot());
+    m_uniformCount = 0;
+    m_activeUniformCount = 0;
+
+    if (m_ID == 0) {
+        return;
+    }
+
+    GLint uniformCount = 0;
+    GLint maxNameLength = 0;
+    glGetProgramiv(m_ID, GL_ACTIVE_UNIFORMS, &uniformCount);
+    glGetProgramiv(m_ID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::vector<char> name(std::max(maxNameLength, 1));
+    for (GLint i = 0; i < uniformCount; ++i) {
+        GLsizei length = 0;
+        GLint size = 0;
+        GLenum type = 0;
+        glGetActiveUniform(m_ID, static_cast<GLuint>(i), static_cast<GLsizei>(name.size()), &length, &size, &type, name.data());
+
+        // Los miembros de bloques uniformes no tienen ubicación propia
+        GLint location = glGetUniformLocation(m_ID, name.data());
+        if (location < 0) {
+            continue;
+        }
+
+        std::string uniformName(name.data(), length);
+        insertUniform(hashUniformName(uniformName.c_str()), location);
+        ++m_activeUniformCount;
+
+        // Un array aparece como "nombre[0]": se registran también "nombre" y cada elemento
+        if (uniformName.size() > 3 && uniformName.compare(uniformName.size() - 3, 3, "[0]") == 0) {
+            std::string base = uniformName.substr(0, uniformName.size() - 3);
+            insertUniform(hashUniformName(base.c_str()), location);
+            for (GLint element = 1; element < size; ++element) {
+                std::string elementName = base + "[" + std::to_string(element) + "]";
+                insertUniform(hashUniformName(elementName.c_str()), location + element);
+                ++m_activeUniformCount;
+            }
+        }
+    }
+}
+
+void Shader::insertUniform(uint64_t hash, GLint location)
+{
+    // Se mantiene la carga por debajo de 1/2 para que las búsquedas sondeen poco
+    if (2 * (m_uniformCount + 1) > m_uniforms.size()) {
+        growUniforms();
+    }
+
+    size_t mask = m_uniforms.size() - 1;
+    size_t index = hash & mask;
+    while (m_uniforms[index].hash != 0 && m_uniforms[index].hash != hash) {
+        index = (index + 1) & mask;
+    }
+
+    if (m_uniforms[index].hash == 0) {
+        ++m_uniformCount;
+    }
+    m_uniforms[index].hash = hash;
+    m_uniforms[index].location = location;
+    m_uniforms[index].hasValue = false;
+}
+
+void Shader::growUniforms()
+{
+    std::vector<UniformSlot> previous(m_uniforms.size() * 2);
+    previous.swap(m_uniforms);
+
+    // Se mueven las entradas completas: el valor sombreado debe sobrevivir al crecimiento
+    size_t mask = m_uniforms.size() - 1;
+    for (const UniformSlot& slot : previous) {
+        if (slot.hash == 0) {
+            continue;
+        }
+
+        size_t index = slot.hash & mask;
+        while (m_uniforms[index].hash != 0) {
+            index = (index + 1) & mask;
+        }
+        m_uniforms[index] = slot;
+    }
+}
+
+Shader::UniformSlot* Shader::findSlot(uint64_t hash)
+{
+    size_t mask = m_uniforms.size() - 1;
+    size_t index = hash & mask;
+    while (m_uniforms[index].hash != 0) {
+        if (m_uniforms[index].hash == hash) {
+            return &m_uniforms[index];
+        }
+        index = (index + 1) & mask;
+    }
+
+    return nullptr;
+}
+
+Shader::UniformSlot* Shader::findUniform(const UniformName& name)
+{
+    UniformSlot* slot = findSlot(name.hash);
+    if (slot != nullptr) {
+        return slot->location >= 0 ? slot : nullptr;
+    }
+
+    // Se avisa una sola vez: el nombre queda en la tabla sin ubicación
+    std::cerr << "ERROR::SHADER::UNIFORM_NOT_FOUND: " << name.name << std::endl;
+    insertUniform(name.hash, -1);
+    return nullptr;
+}
+
+size_t Shader::uniformCount() const
+{
+    return m_activeUniformCount;
+}
+
+void Shader::bindBlock(const char* name, GLuint binding)
+{
+    auto previous = std::find_if(m_blockBindings.begin(), m_blockBindings.end(),
+                                 [name](const auto& block) { return block.first == name; });
+    if (previous == m_blockBindings.end()) {
+        m_blockBindings.emplace_back(name, binding);
+    } else {
+        previous->second = binding;
+    }
+
+    GLuint block = glGetUniformBlockIndex(m_ID, name);
+    if (block != GL_INVALID_INDEX) {
+        glUniformBlockBinding(m_ID, block, binding);
+        return;
+    }
+
+    block = glGetProgramResourceIndex(m_ID, GL_SHADER_STORAGE_BLOCK, name);
+    if (block != GL_INVALID_INDEX) {
+        glShaderStorageBlockBinding(m_ID, block, binding);
+        return;
+    }
+
+    std::cerr << "ERROR::SHADER::BLOCK_NOT_FOUND: " << name << std::endl;
+}
+
+void Shader::replaceProgram(GLuint program)
+{
+    std::vector<UniformSlot> previous;
+    previous.swap(m_uniforms);
+
+    if (m_ID != 0) {
+        GLStateCache::deleteProgram(m_ID);
+    }
+    m_ID = program;
+    initialize();
+
+    // Los uniforms conservan su valor si el nuevo programa los sigue declarando
+    for (const UniformSlot& slot : previous) {
+        if (!slot.hasValue) {
+            continue;
+        }
+
+        UniformSlot* current = findSlot(slot.hash);
+        if (current != nullptr && current->location >= 0) {
+            std::memcpy(current->value, slot.value, sizeof(slot.value));
+            current->hasValue = true;
+            current->type = slot.type;
+            current->upload = slot.upload;
+            slot.upload(m_ID, current->location, slot.value);
+        }
+    }
+
+    std::vector<std::pair<std::string, GLuint>> blocks;
+    blocks.swap(m_blockBindings);
+    for (const auto& [name, binding] : blocks) {
+        bindBlock(name.c_str(), binding);
     }
 }
 
 void Shader::use() const
 {
-    glUseProgram(m_ID);
+    GLStateCache::useProgram(m_ID);
 }
 
 GLuint Shader::ID() const
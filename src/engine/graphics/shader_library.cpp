@@ -0,0 +1,535 @@
+#include "engine/graphics/shader_library.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include "engine/graphics/program_cache.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+using namespace engine::graphics;
+
+namespace {
+
+    // GL_KHR_parallel_shader_compile (mismos valores que la variante ARB)
+    constexpr GLenum COMPLETION_STATUS = 0x91B1;
+
+    bool hasExtension(const char* name)
+    {
+        GLint count = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+        for (GLint i = 0; i < count; ++i) {
+            const GLubyte* extension = glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i));
+            if (extension && std::strcmp(reinterpret_cast<const char*>(extension), name) == 0) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    GLuint queueShader(const std::string& source, GLenum shaderType)
+    {
+        const char* code = source.c_str();
+        GLuint shader = glCreateShader(shaderType);
+        glShaderSource(shader, 1, &code, NULL);
+        glCompileShader(shader);
+        return shader;
+    }
+
+    bool checkShader(GLuint shader, const char* typeName, const std::string& path, bool report)
+    {
+        GLint success = 0;
+        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+        if (!success && report) {
+            char infolog[512];
+            glGetShaderInfoLog(shader, 512, NULL, infolog);
+            std::cerr << "ERROR::SHADER::" << typeName << "_COMPILATION_FAILED: " << path << "\n" << infolog << std::endl;
+        }
+
+        return success;
+    }
+
+} // namespace
+
+ShaderLibrary::ShaderLibrary(GLADloadproc loader)
+    : m_maxShaderCompilerThreads(nullptr)
+    , m_parallelCompile(false)
+{
+    if (loader == nullptr) {
+        return;
+    }
+
+    if (hasExtension("GL_KHR_parallel_shader_compile")) {
+        m_maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(loader("glMaxShaderCompilerThreadsKHR"));
+    } else if (hasExtension("GL_ARB_parallel_shader_compile")) {
+        m_maxShaderCompilerThreads = reinterpret_cast<MaxShaderCompilerThreadsProc>(loader("glMaxShaderCompilerThreadsARB"));
+    }
+
+    m_parallelCompile = m_maxShaderCompilerThreads != nullptr;
+}
+
+ShaderLibrary::~ShaderLibrary()
+{
+    for (const std::unique_ptr<Program>& program : m_programs) {
+        if (program->shader == nullptr) {
+            GLStateCache::deleteProgram(program->program);
+        }
+        GLStateCache::deleteProgram(program->reload.program);
+    }
+
+    for (const auto& [source, stage] : m_vertexStages) {
+        glDeleteShader(stage->shader);
+    }
+    for (const auto& [source, stage] : m_fragmentStages) {
+        glDeleteShader(stage->shader);
+    }
+}
+
+void ShaderLibrary::add(const std::string& name, const std::string& vertexPath, const std::string& fragmentPath,
+                        const ShaderDefines& defines)
+{
+    Entry* entry = find(name);
+    if (entry == nullptr) {
+        m_entries.push_back(std::make_unique<Entry>());
+        entry = m_entries.back().get();
+        entry->name = name;
+        entry->vertexPath = vertexPath;
+        entry->fragmentPath = fragmentPath;
+    } else if (entry->vertexPath != vertexPath || entry->fragmentPath != fragmentPath) {
+        std::cerr << "ERROR::SHADER_LIBRARY::DUPLICATED_NAME: " << name << std::endl;
+        return;
+    }
+
+    variant(*entry, defines);
+}
+
+void ShaderLibrary::compileAll(GLuint compilerThreads)
+{
+    if (m_parallelCompile) {
+        m_maxShaderCompilerThreads(compilerThreads);
+        m_stats.compilerThreads = compilerThreads;
+    }
+
+    for (const std::unique_ptr<Entry>& entry : m_entries) {
+        for (Variant& variant : entry->variants) {
+            if (variant.program == nullptr) {
+                queue(*entry, variant);
+            }
+        }
+    }
+}
+
+ShaderLibrary::Entry* ShaderLibrary::find(const std::string& name) const
+{
+    for (const std::unique_ptr<Entry>& entry : m_entries) {
+        if (entry->name == name) {
+            return entry.get();
+        }
+    }
+
+    return nullptr;
+}
+
+ShaderLibrary::Variant* ShaderLibrary::findVariant(const std::string& name, const ShaderDefines& defines) const
+{
+    Entry* entry = find(name);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    const ShaderDefines key = ShaderPreprocessor::normalize(defines);
+    for (Variant& variant : entry->variants) {
+        if (variant.defines == key) {
+            return &variant;
+        }
+    }
+
+    return nullptr;
+}
+
+ShaderLibrary::Variant& ShaderLibrary::variant(Entry& entry, const ShaderDefines& defines)
+{
+    ShaderDefines key = ShaderPreprocessor::normalize(defines);
+    for (Variant& variant : entry.variants) {
+        if (variant.defines == key) {
+            return variant;
+        }
+    }
+
+    entry.variants.push_back(Variant{ std::move(key), nullptr });
+    ++m_stats.variants;
+    return entry.variants.back();
+}
+
+ShaderLibrary::Stage* ShaderLibrary::stage(const ShaderSource& source, GLenum shaderType)
+{
+    auto& stages = shaderType == GL_VERTEX_SHADER ? m_vertexStages : m_fragmentStages;
+    auto [it, inserted] = stages.try_emplace(source.code);
+    if (!inserted) {
+        ++m_stats.sharedStages;
+        return it->second.get();
+    }
+
+    it->second = std::make_unique<Stage>();
+    it->second->shader = queueShader(source.code, shaderType);
+    it->second->path = source.files.front().string();
+    ++m_stats.stages;
+    return it->second.get();
+}
+
+void ShaderLibrary::queue(const Entry& entry, Variant& variant)
+{
+    ShaderSource vertex = ShaderPreprocessor::load(entry.vertexPath, variant.defines);
+    ShaderSource fragment = ShaderPreprocessor::load(entry.fragmentPath, variant.defines);
+
+    // Cada variante recibe su programa: con los mismos defines que ella se recargará
+    uint64_t cacheKey = ProgramCache::key({ vertex.code, fragment.code });
+    m_programs.push_back(std::make_unique<Program>());
+    Program& program = *m_programs.back();
+    variant.program = &program;
+    program.name = entry.name;
+    for (const std::string& define : variant.defines) {
+        program.name += " " + define;
+    }
+    program.vertexPath = entry.vertexPath;
+    program.fragmentPath = entry.fragmentPath;
+    program.defines = variant.defines;
+    program.cacheKey = cacheKey;
+    watchFiles(program, vertex, fragment);
+
+    program.program = ProgramCache::load(cacheKey);
+    if (program.program != 0) {
+        program.state = ProgramState::Linked;
+        ++m_stats.cached;
+        return;
+    }
+
+    // Ninguna consulta de estado aquí: el driver compila y enlaza mientras seguimos encolando
+    program.vertex = stage(vertex, GL_VERTEX_SHADER);
+    program.fragment = stage(fragment, GL_FRAGMENT_SHADER);
+    program.program = glCreateProgram();
+    glAttachShader(program.program, program.vertex->shader);
+    glAttachShader(program.program, program.fragment->shader);
+    if (ProgramCache::enabled()) {
+        glProgramParameteri(program.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(program.program);
+
+    program.state = ProgramState::Compiling;
+    ++m_stats.compiled;
+}
+
+bool ShaderLibrary::isComplete(const Variant& variant) const
+{
+    const Program* program = variant.program;
+    if (program == nullptr) {
+        return false;
+    }
+
+    if (program->shader != nullptr || program->state != ProgramState::Compiling) {
+        return true;
+    }
+
+    return isLinkComplete(program->program);
+}
+
+bool ShaderLibrary::isLinkComplete(GLuint program) const
+{
+    if (!m_parallelCompile) {
+        return true;
+    }
+
+    GLint complete = 0;
+    glGetProgramiv(program, COMPLETION_STATUS, &complete);
+    return complete != 0;
+}
+
+void ShaderLibrary::finish(Program& program)
+{
+    if (program.state == ProgramState::Compiling) {
+        // El enlazado falla si falla una etapa; solo entonces se buscan sus errores
+        GLint linked = 0;
+        glGetProgramiv(program.program, GL_LINK_STATUS, &linked);
+        if (linked) {
+            ProgramCache::store(program.cacheKey, program.program);
+            program.state = ProgramState::Linked;
+        } else {
+            // Una etapa compartida solo informa de su error la primera vez
+            bool vertexCompiled = checkShader(program.vertex->shader, "VERTEX", program.vertex->path, !program.vertex->checked);
+            bool fragmentCompiled = checkShader(program.fragment->shader, "FRAGMENT", program.fragment->path, !program.fragment->checked);
+            program.vertex->checked = true;
+            program.fragment->checked = true;
+
+            if (vertexCompiled && fragmentCompiled) {
+                char infolog[512];
+                glGetProgramInfoLog(program.program, 512, NULL, infolog);
+                std::cerr << "ERROR::SHADER::PROGRAM::LINKED_FAILED: " << program.name << "\n" << infolog << std::endl;
+            }
+
+            GLStateCache::deleteProgram(program.program);
+            program.program = 0;
+            program.state = ProgramState::Failed;
+            ++m_stats.failed;
+        }
+
+        // Las etapas siguen vivas para otras variantes; el programa ya no las necesita
+        if (program.program != 0) {
+            glDetachShader(program.program, program.vertex->shader);
+            glDetachShader(program.program, program.fragment->shader);
+        }
+    }
+
+    program.shader = std::make_unique<Shader>(program.program);
+}
+
+void ShaderLibrary::watchFiles(Program& program, const ShaderSource& vertex, const ShaderSource& fragment)
+{
+    program.files.clear();
+    for (const ShaderSource* source : { &vertex, &fragment }) {
+        for (const std::filesystem::path& file : source->files) {
+            std::filesystem::path path = engine::core::FileWatcher::normalize(file);
+            if (std::find(program.files.begin(), program.files.end(), path) == program.files.end()) {
+                program.files.push_back(std::move(path));
+            }
+        }
+    }
+
+    if (m_watcher != nullptr) {
+        for (const std::filesystem::path& file : program.files) {
+            m_watcher->watch(file);
+        }
+    }
+}
+
+void ShaderLibrary::watch()
+{
+    if (m_watcher != nullptr) {
+        return;
+    }
+
+    m_watcher = std::make_unique<engine::core::FileWatcher>();
+    for (const std::unique_ptr<Program>& program : m_programs) {
+        for (const std::filesystem::path& file : program->files) {
+            m_watcher->watch(file);
+        }
+    }
+}
+
+void ShaderLibrary::update()
+{
+    if (m_watcher != nullptr) {
+        const std::vector<std::filesystem::path>& changed = m_watcher->poll();
+        if (!changed.empty()) {
+            for (const std::unique_ptr<Program>& program : m_programs) {
+                bool affected = std::any_of(program->files.begin(), program->files.end(), [&changed](const auto& file) {
+                    return std::find(changed.begin(), changed.end(), file) != changed.end();
+                });
+                if (affected) {
+                    startReload(*program);
+                }
+            }
+        }
+    }
+
+    for (const std::unique_ptr<Program>& program : m_programs) {
+        Reload& reload = program->reload;
+        if (reload.program == 0) {
+            continue;
+        }
+
+        if (!m_parallelCompile && !reload.deferred) {
+            reload.deferred = true;
+            continue;
+        }
+
+        if (isLinkComplete(reload.program)) {
+            finishReload(*program);
+        }
+    }
+}
+
+void ShaderLibrary::startReload(Program& program)
+{
+    ShaderSource vertex = ShaderPreprocessor::load(program.vertexPath, program.defines);
+    ShaderSource fragment = ShaderPreprocessor::load(program.fragmentPath, program.defines);
+    if (!vertex.valid || !fragment.valid) {
+        return;
+    }
+
+    // Guardar sin cambios (o volver al código que ya se está compilando) no recompila nada
+    uint64_t cacheKey = ProgramCache::key({ vertex.code, fragment.code });
+    uint64_t currentKey = program.reload.program != 0 ? program.reload.cacheKey : program.cacheKey;
+    if (cacheKey == currentKey) {
+        return;
+    }
+
+    cancelReload(program);
+    watchFiles(program, vertex, fragment);
+
+    Reload& reload = program.reload;
+    reload.cacheKey = cacheKey;
+    reload.vertex = stage(vertex, GL_VERTEX_SHADER);
+    reload.fragment = stage(fragment, GL_FRAGMENT_SHADER);
+    reload.program = glCreateProgram();
+    glAttachShader(reload.program, reload.vertex->shader);
+    glAttachShader(reload.program, reload.fragment->shader);
+    if (ProgramCache::enabled()) {
+        glProgramParameteri(reload.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(reload.program);
+}
+
+void ShaderLibrary::finishReload(Program& program)
+{
+    Reload reload = program.reload;
+    program.reload = Reload();
+
+    GLint linked = 0;
+    glGetProgramiv(reload.program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        bool vertexCompiled = checkShader(reload.vertex->shader, "VERTEX", reload.vertex->path, !reload.vertex->checked);
+        bool fragmentCompiled = checkShader(reload.fragment->shader, "FRAGMENT", reload.fragment->path, !reload.fragment->checked);
+        reload.vertex->checked = true;
+        reload.fragment->checked = true;
+
+        if (vertexCompiled && fragmentCompiled) {
+            char infolog[512];
+            glGetProgramInfoLog(reload.program, 512, NULL, infolog);
+            std::cerr << "ERROR::SHADER::PROGRAM::LINKED_FAILED: " << program.name << "\n" << infolog << std::endl;
+        }
+        std::cerr << "ERROR::SHADER_LIBRARY::RELOAD_FAILED: " << program.name << " (keeping previous program)" << std::endl;
+
+        GLStateCache::deleteProgram(reload.program);
+        releaseStage(reload.vertex);
+        releaseStage(reload.fragment);
+        ++m_stats.reloadFailures;
+        return;
+    }
+
+    ProgramCache::store(reload.cacheKey, reload.program);
+    glDetachShader(reload.program, reload.vertex->shader);
+    glDetachShader(reload.program, reload.fragment->shader);
+
+    // Un programa que nadie ha pedido todavía aún no tiene Shader que actualizar
+    if (program.shader != nullptr) {
+        program.shader->replaceProgram(reload.program);
+    } else {
+        GLStateCache::deleteProgram(program.program);
+    }
+    program.program = reload.program;
+    program.state = ProgramState::Linked;
+
+    Stage* previousVertex = program.vertex;
+    Stage* previousFragment = program.fragment;
+    program.vertex = reload.vertex;
+    program.fragment = reload.fragment;
+    releaseStage(previousVertex);
+    releaseStage(previousFragment);
+
+    program.cacheKey = reload.cacheKey;
+
+    ++m_stats.reloads;
+    std::cout << "SHADER_LIBRARY::RELOADED: " << program.name << std::endl;
+}
+
+void ShaderLibrary::cancelReload(Program& program)
+{
+    Reload reload = program.reload;
+    if (reload.program == 0) {
+        return;
+    }
+
+    program.reload = Reload();
+    GLStateCache::deleteProgram(reload.program);
+    releaseStage(reload.vertex);
+    releaseStage(reload.fragment);
+}
+
+void ShaderLibrary::releaseStage(Stage* stage)
+{
+    if (stage == nullptr) {
+        return;
+    }
+
+    for (const std::unique_ptr<Program>& program : m_programs) {
+        if (program->vertex == stage || program->fragment == stage ||
+            program->reload.vertex == stage || program->reload.fragment == stage) {
+            return;
+        }
+    }
+
+    // Ningún programa usa ya este código: se libera para que las ediciones no acumulen etapas
+    for (auto* stages : { &m_vertexStages, &m_fragmentStages }) {
+        for (auto it = stages->begin(); it != stages->end(); ++it) {
+            if (it->second.get() == stage) {
+                glDeleteShader(stage->shader);
+                stages->erase(it);
+                return;
+            }
+        }
+    }
+}
+
+bool ShaderLibrary::isReady(const std::string& name, const ShaderDefines& defines) const
+{
+    const Variant* variant = findVariant(name, defines);
+    return variant != nullptr && isComplete(*variant);
+}
+
+bool ShaderLibrary::ready() const
+{
+    for (const std::unique_ptr<Entry>& entry : m_entries) {
+        for (const Variant& variant : entry->variants) {
+            if (!isComplete(variant)) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+float ShaderLibrary::progress() const
+{
+    size_t total = 0;
+    size_t complete = 0;
+    for (const std::unique_ptr<Entry>& entry : m_entries) {
+        for (const Variant& variant : entry->variants) {
+            ++total;
+            complete += isComplete(variant);
+        }
+    }
+
+    return total == 0 ? 1.0f : static_cast<float>(complete) / static_cast<float>(total);
+}
+
+Shader* ShaderLibrary::get(const std::string& name, const ShaderDefines& defines)
+{
+    Entry* entry = find(name);
+    if (entry == nullptr) {
+        std::cerr << "ERROR::SHADER_LIBRARY::NOT_FOUND: " << name << std::endl;
+        return nullptr;
+    }
+
+    // Una variante que nadie registró se compila ahora
+    Variant& requested = variant(*entry, defines);
+    if (requested.program == nullptr) {
+        queue(*entry, requested);
+    }
+
+    Program& program = *requested.program;
+    if (program.shader == nullptr) {
+        finish(program);
+    }
+
+    return program.shader.get();
+}
+
+bool ShaderLibrary::parallelCompile() const
+{
+    return m_parallelCompile;
+}
+
+const ShaderLibraryStats& ShaderLibrary::stats() const
+{
+    return m_stats;
+}
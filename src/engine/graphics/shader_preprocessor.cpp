@@ -0,0 +1,166 @@
+#include "engine/graphics/shader_preprocessor.hpp"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace engine::graphics;
+
+namespace {
+
+    struct Context {
+        ShaderSource& source;
+        std::vector<std::filesystem::path> stack;
+        const ShaderDefines& defines;
+        bool versionFound = false;
+    };
+
+    bool readFile(const std::filesystem::path& path, std::string& content)
+    {
+        std::ifstream file(path);
+        if (!file) {
+            return false;
+        }
+
+        std::stringstream stream;
+        stream << file.rdbuf();
+        content = stream.str();
+        return true;
+    }
+
+    void writeDefines(std::ostringstream& out, const ShaderDefines& defines)
+    {
+        for (const std::string& define : defines) {
+            size_t equals = define.find('=');
+            if (equals == std::string::npos) {
+                out << "#define " << define << '\n';
+            } else {
+                out << "#define " << define.substr(0, equals) << ' ' << define.substr(equals + 1) << '\n';
+            }
+        }
+    }
+
+    // Devuelve el nombre de la directiva ("include", "version"...) y deja pos tras él
+    std::string directive(const std::string& line, size_t& pos)
+    {
+        pos = line.find_first_not_of(" \t");
+        if (pos == std::string::npos || line[pos] != '#') {
+            return std::string();
+        }
+
+        size_t begin = line.find_first_not_of(" \t", pos + 1);
+        if (begin == std::string::npos) {
+            return std::string();
+        }
+
+        size_t end = begin;
+        while (end < line.size() && std::isalpha(static_cast<unsigned char>(line[end]))) {
+            ++end;
+        }
+
+        pos = end;
+        return line.substr(begin, end - begin);
+    }
+
+    bool expand(Context& context, std::filesystem::path path, size_t index, std::ostringstream& out)
+    {
+        std::string content;
+        if (!readFile(path, content)) {
+            std::cerr << "ERROR::SHADER::FILE_NOT_SUCCEFULLY_READ: " << path.string() << std::endl;
+            return false;
+        }
+
+        context.stack.push_back(path);
+
+        std::istringstream lines(content);
+        std::string line;
+        size_t lineNumber = 0;
+        while (std::getline(lines, line)) {
+            ++lineNumber;
+
+            size_t pos = 0;
+            std::string name = directive(line, pos);
+
+            if (name == "version" && index == 0 && !context.versionFound) {
+                context.versionFound = true;
+                out << line << '\n';
+                writeDefines(out, context.defines);
+                out << "#line " << lineNumber + 1 << " 0\n";
+                continue;
+            }
+
+            if (name != "include") {
+                out << line << '\n';
+                continue;
+            }
+
+            size_t open = line.find('"', pos);
+            size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+            if (close == std::string::npos) {
+                std::cerr << "ERROR::SHADER::INCLUDE_SYNTAX: " << path.string() << ":" << lineNumber << std::endl;
+                return false;
+            }
+
+            std::filesystem::path target = (path.parent_path() / line.substr(open + 1, close - open - 1)).lexically_normal();
+            if (std::find(context.stack.begin(), context.stack.end(), target) != context.stack.end()) {
+                std::cerr << "ERROR::SHADER::INCLUDE_CYCLE: " << target.string() << " (" << path.string() << ":"
+                          << lineNumber << ")" << std::endl;
+                return false;
+            }
+
+            // Un archivo ya insertado se sustituye por una línea vacía para no desplazar la numeración
+            std::vector<std::filesystem::path>& files = context.source.files;
+            if (std::find(files.begin(), files.end(), target) != files.end()) {
+                out << '\n';
+                continue;
+            }
+
+            size_t includeIndex = files.size();
+            files.push_back(target);
+            out << "#line 1 " << includeIndex << '\n';
+            if (!expand(context, target, includeIndex, out)) {
+                return false;
+            }
+            out << "#line " << lineNumber + 1 << ' ' << index << '\n';
+        }
+
+        context.stack.pop_back();
+        return true;
+    }
+
+} // namespace
+
+ShaderSource ShaderPreprocessor::load(const std::filesystem::path& path, const ShaderDefines& defines)
+{
+    const ShaderDefines sorted = normalize(defines);
+
+    ShaderSource source;
+    source.files.push_back(path.lexically_normal());
+
+    Context context{ source, {}, sorted };
+    std::ostringstream out;
+    source.valid = expand(context, source.files.front(), 0, out);
+    if (!source.valid) {
+        return source;
+    }
+
+    // Sin #version los #define pueden ir directamente al principio
+    if (!context.versionFound && !sorted.empty()) {
+        std::ostringstream header;
+        writeDefines(header, sorted);
+        header << "#line 1 0\n";
+        source.code = header.str() + out.str();
+    } else {
+        source.code = out.str();
+    }
+
+    return source;
+}
+
+ShaderDefines ShaderPreprocessor::normalize(ShaderDefines defines)
+{
+    std::sort(defines.begin(), defines.end());
+    defines.erase(std::unique(defines.begin(), defines.end()), defines.end());
+    return defines;
+}
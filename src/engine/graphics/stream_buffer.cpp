@@ -0,0 +1,131 @@
+#include "engine/graphics/stream_buffer.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
+#include <iostream>
+
+using namespace engine::graphics;
+
+namespace {
+
+    constexpr GLbitfield STREAM_FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+    /** Tiempo máximo de cada espera del fence (1 ms) antes de volver a intentar */
+    constexpr GLuint64 FENCE_TIMEOUT_NS = 1000000;
+
+    void waitFence(GLsync& fence)
+    {
+        if (!fence)
+            return;
+
+        GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+        while (true) {
+            GLenum result = glClientWaitSync(fence, flags, FENCE_TIMEOUT_NS);
+            if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+                break;
+            if (result == GL_WAIT_FAILED) {
+                std::cerr << "ERROR::STREAM_BUFFER::FENCE_WAIT_FAILED" << std::endl;
+                break;
+            }
+            flags = 0;
+        }
+
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+} // namespace
+
+StreamBuffer::StreamBuffer(GLenum target, GLsizeiptr partitionSize, GLuint partitionCount)
+    : m_ID(0)
+    , m_target(target)
+    , m_partitionSize(partitionSize)
+    , m_partitionCount(partitionCount == 0 ? 1 : partitionCount)
+    , m_currentPartition(0)
+    , m_partitionUsed(0)
+    , m_mapped(nullptr)
+    , m_fences(m_partitionCount, nullptr)
+{
+    GLsizeiptr totalSize = m_partitionSize * m_partitionCount;
+
+    // DSA: crear y mapear sin enlazar nada. Enlazar un GL_ELEMENT_ARRAY_BUFFER
+    // cambiaría el buffer de índices del VAO que haya enlazado
+    glCreateBuffers(1, &m_ID);
+    glNamedBufferStorage(m_ID, totalSize, nullptr, STREAM_FLAGS);
+    m_mapped = static_cast<unsigned char*>(glMapNamedBufferRange(m_ID, 0, totalSize, STREAM_FLAGS));
+
+    if (!m_mapped) {
+        std::cerr << "ERROR::STREAM_BUFFER::MAP_FAILED: "
+                  << "Could not map " << totalSize << " bytes persistently" << std::endl;
+    }
+
+    // La primera llamada a beginFrame() avanza a la partición 0
+    m_currentPartition = m_partitionCount - 1;
+}
+
+StreamBuffer::~StreamBuffer()
+{
+    for (GLsync& fence : m_fences) {
+        if (fence)
+            glDeleteSync(fence);
+    }
+
+    if (m_mapped)
+        glUnmapNamedBuffer(m_ID);
+
+    GLStateCache::deleteBuffer(m_ID);
+}
+
+void StreamBuffer::beginFrame()
+{
+    m_currentPartition = (m_currentPartition + 1) % m_partitionCount;
+    m_partitionUsed = 0;
+    waitFence(m_fences[m_currentPartition]);
+}
+
+void StreamBuffer::endFrame()
+{
+    GLsync& fence = m_fences[m_currentPartition];
+    if (fence)
+        glDeleteSync(fence);
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+GLintptr StreamBuffer::allocateBytes(GLsizeiptr bytes, GLsizeiptr alignment)
+{
+    if (!m_mapped)
+        return -1;
+
+    GLintptr partitionStart = static_cast<GLintptr>(m_currentPartition) * m_partitionSize;
+    GLintptr offset = partitionStart + m_partitionUsed;
+    if (alignment > 1)
+        offset = ((offset + alignment - 1) / alignment) * alignment;
+
+    if (offset + bytes > partitionStart + m_partitionSize) {
+        std::cerr << "ERROR::STREAM_BUFFER::PARTITION_FULL: "
+                  << "Requested " << bytes << " bytes but only "
+                  << available() << " are free" << std::endl;
+        return -1;
+    }
+
+    m_partitionUsed = offset + bytes - partitionStart;
+    return offset;
+}
+
+GLuint StreamBuffer::ID() const
+{
+    return m_ID;
+}
+
+GLenum StreamBuffer::target() const
+{
+    return m_target;
+}
+
+GLsizeiptr StreamBuffer::partitionSize() const
+{
+    return m_partitionSize;
+}
+
+GLsizeiptr StreamBuffer::available() const
+{
+    return m_partitionSize - m_partitionUsed;
+}
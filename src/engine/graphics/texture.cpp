@@ -1,22 +1,33 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include "engine/graphics/texture.hpp"
+#include "engine/graphics/gl_state_cache.hpp"
 
 using namespace engine::graphics;
 
 Texture::Texture(const char* path, const TextureParams& params) : m_path(path) 
+{
+    stbi_set_flip_vertically_on_load(params.flipVertically);
+    create(stbi_load(path, &m_width, &m_height, &m_channels, 0), params);
+}
+
+Texture::Texture(const unsigned char* encoded, size_t size, const TextureParams& params, const char* name)
+    : m_path(name)
+{
+    stbi_set_flip_vertically_on_load(params.flipVertically);
+    create(stbi_load_from_memory(encoded, static_cast<int>(size), &m_width, &m_height, &m_channels, 0), params);
+}
+
+void Texture::create(unsigned char* data, const TextureParams& params)
 {
     glGenTextures(1, &m_ID);
-    glBindTexture(GL_TEXTURE_2D, m_ID);
+    GLStateCache::bindTexture(GL_TEXTURE0, GL_TEXTURE_2D, m_ID);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, params.wrapS);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, params.wrapT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, params.minFilter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, params.magFilter);
 
-    stbi_set_flip_vertically_on_load(true);
-    unsigned char* data = stbi_load(path, &m_width, &m_height, &m_channels, 0);
-
     if (data) {
         GLenum format = (m_channels == 4) ? GL_RGBA : GL_RGB;
 
@@ -36,13 +47,12 @@ Texture::Texture(const char* path, const TextureParams& params) : m_path(path)
 
 Texture::~Texture() 
 {
-    glDeleteTextures(1, &m_ID);
+    GLStateCache::deleteTexture(m_ID);
 }
 
 void Texture::bind(GLenum textureUint) const 
 {
-    glActiveTexture(textureUint);
-    glBindTexture(GL_TEXTURE_2D, m_ID);
+    GLStateCache::bindTexture(textureUint, GL_TEXTURE_2D, m_ID);
 }
 
 GLuint Texture::ID() const 
@@ -0,0 +1,188 @@
+#include "engine/graphics/vertex_welder.hpp"
+#include "engine/core/parallel.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace engine::graphics;
+using namespace engine::core;
+
+namespace {
+
+    constexpr size_t COMPONENTS = sizeof(Vertex) / sizeof(float);
+    static_assert(sizeof(Vertex) == COMPONENTS * sizeof(float), "Vertex must be tightly packed floats");
+
+    /** Por debajo de este tamaño no compensa crear hilos */
+    constexpr size_t MIN_VERTICES_PER_THREAD = 1 << 16;
+
+    constexpr GLuint EMPTY_SLOT = ~0u;
+
+    /** Límite de las celdas: cabe en int64 y deja margen para el redondeo */
+    constexpr double MAX_CELL = 9.0e18;
+
+    /**
+     * Con tolerancia 0, los bits de cada componente (segunda mitad a cero).
+     * Con tolerancia, la celda de cada componente en 64 bits: mitad baja y alta
+     */
+    using VertexKey = std::array<std::uint32_t, COMPONENTS * 2>;
+
+    VertexKey makeKey(const Vertex& vertex, float epsilon)
+    {
+        VertexKey key = {};
+        if (epsilon <= 0.0f) {
+            std::memcpy(key.data(), &vertex, sizeof(Vertex));
+            return key;
+        }
+
+        float values[COMPONENTS];
+        std::memcpy(values, &vertex, sizeof(Vertex));
+        for (size_t i = 0; i < COMPONENTS; ++i) {
+            // En double y acotado: coordenadas grandes con un epsilon pequeño no caben
+            // en 32 bits, y convertir un valor fuera de rango (o NaN) a entero es UB
+            double cell = std::floor(static_cast<double>(values[i]) / epsilon + 0.5);
+            cell = std::isnan(cell) ? 0.0 : std::clamp(cell, -MAX_CELL, MAX_CELL);
+            auto bits = static_cast<std::uint64_t>(static_cast<std::int64_t>(cell));
+            key[i] = static_cast<std::uint32_t>(bits);
+            key[COMPONENTS + i] = static_cast<std::uint32_t>(bits >> 32);
+        }
+        return key;
+    }
+
+    std::uint64_t hashKey(const VertexKey& key)
+    {
+        std::uint64_t hash = 0xcbf29ce484222325ull;
+        for (std::uint32_t word : key) {
+            hash ^= word;
+            hash *= 0x100000001b3ull;
+        }
+
+        // Mezcla final para repartir bien los bits altos (partición) y bajos (slot)
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccdull;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53ull;
+        hash ^= hash >> 33;
+        return hash;
+    }
+
+    /** Tabla hash de direccionamiento abierto que guarda índices de vértices */
+    class WeldTable {
+    private:
+        std::vector<GLuint> m_slots;
+        size_t m_count;
+
+        void grow(const std::vector<std::uint64_t>& hashes)
+        {
+            std::vector<GLuint> old;
+            old.swap(m_slots);
+            m_slots.assign(old.size() * 2, EMPTY_SLOT);
+
+            size_t mask = m_slots.size() - 1;
+            for (GLuint index : old) {
+                if (index == EMPTY_SLOT)
+                    continue;
+                size_t slot = hashes[index] & mask;
+                while (m_slots[slot] != EMPTY_SLOT)
+                    slot = (slot + 1) & mask;
+                m_slots[slot] = index;
+            }
+        }
+
+    public:
+        explicit WeldTable(size_t expected)
+            : m_count(0)
+        {
+            size_t capacity = 16;
+            while (capacity < expected * 2)
+                capacity <<= 1;
+            m_slots.assign(capacity, EMPTY_SLOT);
+        }
+
+        /** Inserta el vértice o devuelve el índice del primer vértice equivalente */
+        GLuint insertOrFind(GLuint index,
+                            const std::vector<Vertex>& vertexs,
+                            const std::vector<std::uint64_t>& hashes,
+                            float epsilon)
+        {
+            if ((m_count + 1) * 2 > m_slots.size())
+                grow(hashes);
+
+            size_t mask = m_slots.size() - 1;
+            size_t slot = hashes[index] & mask;
+            VertexKey key = makeKey(vertexs[index], epsilon);
+
+            while (m_slots[slot] != EMPTY_SLOT) {
+                GLuint candidate = m_slots[slot];
+                if (hashes[candidate] == hashes[index] &&
+                    makeKey(vertexs[candidate], epsilon) == key)
+                    return candidate;
+                slot = (slot + 1) & mask;
+            }
+
+            m_slots[slot] = index;
+            ++m_count;
+            return index;
+        }
+    };
+
+} // namespace
+
+std::vector<GLuint> VertexWelder::weld(std::vector<Vertex>& vertexs, const VertexWeldParams& params)
+{
+    const size_t vertexCount = vertexs.size();
+    std::vector<GLuint> indexs(vertexCount);
+    if (vertexCount == 0)
+        return indexs;
+
+    unsigned threadCount = resolveThreadCount(params.threadCount);
+    threadCount = static_cast<unsigned>(std::clamp<size_t>(vertexCount / MIN_VERTICES_PER_THREAD,
+                                                           1, threadCount));
+
+    // 1. Hash de cada vértice, en bloques contiguos por hilo. Cada hilo anota
+    //    además qué vértices de su bloque caen en cada partición
+    std::vector<std::uint64_t> hashes(vertexCount);
+    std::vector<std::vector<std::vector<GLuint>>> buckets(threadCount,
+                                                          std::vector<std::vector<GLuint>>(threadCount));
+    parallelFor(threadCount, threadCount, [&](size_t thread) {
+        size_t begin = vertexCount * thread / threadCount;
+        size_t end = vertexCount * (thread + 1) / threadCount;
+        std::vector<std::vector<GLuint>>& partitions = buckets[thread];
+        for (std::vector<GLuint>& partition : partitions)
+            partition.reserve((end - begin) / threadCount + 1);
+        for (size_t i = begin; i < end; ++i) {
+            hashes[i] = hashKey(makeKey(vertexs[i], params.epsilon));
+            partitions[(hashes[i] >> 32) % threadCount].push_back(static_cast<GLuint>(i));
+        }
+    });
+
+    // 2. Cada hilo inserta solo los vértices de su partición de hash. Los
+    //    bloques se recorren en orden, así que el representante de cada grupo
+    //    es siempre su primera aparición
+    std::vector<GLuint> representatives(vertexCount);
+    parallelFor(threadCount, threadCount, [&](size_t thread) {
+        WeldTable table(vertexCount / threadCount + 1);
+        for (const std::vector<std::vector<GLuint>>& partitions : buckets) {
+            for (GLuint i : partitions[thread])
+                representatives[i] = table.insertOrFind(i, vertexs, hashes, params.epsilon);
+        }
+    });
+
+    // 3. Compactación en orden de primera aparición
+    std::vector<GLuint> remap(vertexCount);
+    std::vector<Vertex> unique;
+    unique.reserve(vertexCount);
+    for (size_t i = 0; i < vertexCount; ++i) {
+        if (representatives[i] == i) {
+            remap[i] = static_cast<GLuint>(unique.size());
+            unique.push_back(vertexs[i]);
+        }
+        indexs[i] = remap[representatives[i]];
+    }
+
+    unique.shrink_to_fit();
+    vertexs.swap(unique);
+
+    return indexs;
+}
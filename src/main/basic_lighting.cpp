@@ -17,63 +17,6 @@ struct Paths {
 };
 
 struct Objects {
-std::vector<engine::core::Vertex> vertexs = {
-    // Cara frontal (z = -0.5) - Normal: (0, 0, -1)
-    {{0.5f, 0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},   // 0
-    {{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},  // 1
-    {{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}}, // 2
-    {{-0.5f, 0.5f, -0.5f}, {0.0f, 0.0f, -1.0f}},  // 3
-
-    // Cara trasera (z = 0.5) - Normal: (0, 0, 1)
-    {{0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},   // 4
-    {{0.5f, -0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},  // 5
-    {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}}, // 6
-    {{-0.5f, 0.5f, 0.5f}, {0.0f, 0.0f, 1.0f}},  // 7
-
-    // Cara derecha (x = 0.5) - Normal: (1, 0, 0)
-    {{0.5f, 0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}},   // 8
-    {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f, 0.0f}},  // 9
-    {{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f, 0.0f}}, // 10
-    {{0.5f, 0.5f, -0.5f}, {1.0f, 0.0f, 0.0f}},  // 11
-
-    // Cara izquierda (x = -0.5) - Normal: (-1, 0, 0)
-    {{-0.5f, 0.5f, -0.5f}, {-1.0f, 0.0f, 0.0f}},  // 12
-    {{-0.5f, -0.5f, -0.5f}, {-1.0f, 0.0f, 0.0f}}, // 13
-    {{-0.5f, -0.5f, 0.5f}, {-1.0f, 0.0f, 0.0f}},  // 14
-    {{-0.5f, 0.5f, 0.5f}, {-1.0f, 0.0f, 0.0f}},   // 15
-
-    // Cara superior (y = 0.5) - Normal: (0, 1, 0)
-    {{0.5f, 0.5f, 0.5f}, {0.0f, 1.0f, 0.0f}},   // 16
-    {{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f, 0.0f}},  // 17
-    {{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f, 0.0f}}, // 18
-    {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f, 0.0f}},  // 19
-
-    // Cara inferior (y = -0.5) - Normal: (0, -1, 0)
-    {{0.5f, -0.5f, -0.5f}, {0.0f, -1.0f, 0.0f}}, // 20
-    {{0.5f, -0.5f, 0.5f}, {0.0f, -1.0f, 0.0f}},  // 21
-    {{-0.5f, -0.5f, 0.5f}, {0.0f, -1.0f, 0.0f}}, // 22
-    {{-0.5f, -0.5f, -0.5f}, {0.0f, -1.0f, 0.0f}} // 23
-};
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-
     glm::vec3 lightPos = glm::vec3(1.2f, 1.0f, 2.0f);
 };
 
@@ -168,11 +111,12 @@ int main()
 
     engine::graphics::Shader lighting(paths.VERTEX_PATH, paths.LIGHTING_PATH);
     engine::graphics::Shader lightCube(paths.VERTEX_PATH, paths.LIGHT_CUBE_PATH);
-    engine::graphics::Mesh object(obj.vertexs, obj.indexs, {}, 
-                                  engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh object = shapes.mesh(0, {},
+                                                engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
         
-    engine::graphics::Mesh light(obj.vertexs, obj.indexs, {},
-                                 engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
+    engine::graphics::Mesh light = shapes.mesh(0, {},
+                                               engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
 
     glEnable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
@@ -185,17 +129,12 @@ int main()
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         
-        glm::mat4 view = camera.getViewMatrix();
-        glm::mat4 projection = camera.getProjectionMatrix((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
+        camera.publish((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
 
         lighting.use();
-        lighting.setUniform("uView", view);
-        lighting.setUniform("uProjection", projection);
-
         lighting.setUniform("uObjectColor", glm::vec3(1.0f, 0.5f, 0.31f));
         lighting.setUniform("uLightColor", glm::vec3(1.0f, 1.0f, 1.0f));
         lighting.setUniform("uLightPos", obj.lightPos);
-        lighting.setUniform("uViewPos", camera.position());
 
         glm::mat4 model = glm::mat4(1.0f);
         lighting.setUniform("uModel", model);
@@ -203,8 +142,6 @@ int main()
         object.draw(lighting);
 
         lightCube.use();
-        lightCube.setUniform("uView", view);
-        lightCube.setUniform("uProjection", projection);
         
         model = glm::mat4(1.0f);
         model = glm::translate(model, obj.lightPos);
@@ -0,0 +1,208 @@
+/**
+ * @file bvh_picking_benchmark.cpp
+ * @brief Mide la construcción, el refit, el picking y el culling con Bvh
+ *
+ * Coloca una rejilla de icoesferas (unos 500k triángulos) delante de la
+ * cámara y lanza rayos desde posiciones de cursor al azar, como haría un
+ * clic con Mouse::positionX()/positionY(). Cada impacto se compara con una
+ * búsqueda por fuerza bruta en una muestra de rayos. Después compara el
+ * culling jerárquico de Bvh con el culling por lotes de Frustum sobre un
+ * millón de cajas.
+ *
+ * Uso: bvh_picking_benchmark [instancias por lado]
+ */
+
+#include "engine/engine.hpp"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+
+struct Window {
+    int SCREEN_WIDTH = 1280;
+    int SCREEN_HEIGHT = 720;
+};
+
+struct Settings {
+    int GRID_SIDE = 20;
+    float GRID_SPACING = 1.5f;
+    int CLICKS = 10000;
+    int VERIFIED_CLICKS = 200;
+    int REFIT_FRAMES = 20;
+    size_t CULL_OBJECTS = 1000000;
+    int CULL_FRAMES = 90;
+    float WORLD_EXTENT = 100.0f;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Impacto más cercano probando todos los triángulos (Möller-Trumbore) */
+float bruteForceRaycast(const engine::graphics::Ray& ray,
+                        const std::vector<glm::vec3>& positions,
+                        const std::vector<GLuint>& indexs)
+{
+    float closest = FLT_MAX;
+    for (size_t t = 0; t < indexs.size(); t += 3) {
+        glm::vec3 vertex = positions[indexs[t]];
+        glm::vec3 edge1 = positions[indexs[t + 1]] - vertex;
+        glm::vec3 edge2 = positions[indexs[t + 2]] - vertex;
+        glm::vec3 p = glm::cross(ray.direction, edge2);
+        float determinant = glm::dot(edge1, p);
+        if (std::fabs(determinant) < 1e-12f)
+            continue;
+        glm::vec3 s = ray.origin - vertex;
+        float u = glm::dot(s, p) / determinant;
+        glm::vec3 q = glm::cross(s, edge1);
+        float v = glm::dot(ray.direction, q) / determinant;
+        float distance = glm::dot(edge2, q) / determinant;
+        if (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && distance >= 0.0f && distance < closest)
+            closest = distance;
+    }
+    return closest;
+}
+
+int main(int argc, char** argv)
+{
+    Window window;
+    Settings settings;
+    if (argc > 1)
+        settings.GRID_SIDE = std::atoi(argv[1]);
+
+    // Escena: rejilla de icoesferas en el plano z = -10
+    const auto& sphere = engine::graphics::primitives::ICOSPHERE<3>;
+    std::vector<glm::vec3> positions;
+    std::vector<GLuint> indexs;
+    positions.reserve(sphere.vertexs.size() * settings.GRID_SIDE * settings.GRID_SIDE);
+    indexs.reserve(sphere.indexs.size() * settings.GRID_SIDE * settings.GRID_SIDE);
+    const float half = 0.5f * settings.GRID_SPACING * (settings.GRID_SIDE - 1);
+    for (int row = 0; row < settings.GRID_SIDE; ++row) {
+        for (int column = 0; column < settings.GRID_SIDE; ++column) {
+            glm::vec3 center(column * settings.GRID_SPACING - half, row * settings.GRID_SPACING - half, -10.0f);
+            GLuint base = static_cast<GLuint>(positions.size());
+            for (const engine::core::Vertex& vertex : sphere.vertexs)
+                positions.push_back(center + vertex.m_position);
+            for (GLuint index : sphere.indexs)
+                indexs.push_back(base + index);
+        }
+    }
+    const size_t triangleCount = indexs.size() / 3;
+
+    // Construcción con un hilo y con todos
+    engine::graphics::Bvh bvh;
+    engine::graphics::BvhBuildParams serial;
+    serial.threadCount = 1;
+    auto start = std::chrono::steady_clock::now();
+    bvh.build(positions, indexs, serial);
+    const double serialBuildMs = millisecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    bvh.build(positions, indexs);
+    const double parallelBuildMs = millisecondsSince(start);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << triangleCount << " triangles" << std::endl
+              << bvh.stats() << std::endl
+              << "Build:   1 thread " << serialBuildMs << " ms, " << std::thread::hardware_concurrency()
+              << " threads " << parallelBuildMs << " ms" << std::endl;
+
+    // Picking: en una aplicación screenX/screenY serían Mouse::positionX()/positionY()
+    engine::graphics::Camera camera;
+    std::mt19937 random(42);
+    std::uniform_real_distribution<double> screenX(0.0, window.SCREEN_WIDTH);
+    std::uniform_real_distribution<double> screenY(0.0, window.SCREEN_HEIGHT);
+
+    double totalPickMs = 0.0, maxPickMs = 0.0;
+    int hits = 0;
+    for (int click = 0; click < settings.CLICKS; ++click) {
+        engine::graphics::Ray ray = camera.screenRay(screenX(random), screenY(random),
+                                                     window.SCREEN_WIDTH, window.SCREEN_HEIGHT);
+        engine::graphics::BvhHit hit;
+        start = std::chrono::steady_clock::now();
+        bool found = bvh.raycast(ray, hit);
+        double pickMs = millisecondsSince(start);
+        totalPickMs += pickMs;
+        maxPickMs = std::max(maxPickMs, pickMs);
+        hits += found;
+
+        if (click < settings.VERIFIED_CLICKS) {
+            float expected = bruteForceRaycast(ray, positions, indexs);
+            if ((expected == FLT_MAX) != !found || (found && std::fabs(expected - hit.distance) > 1e-4f * expected)) {
+                std::cerr << "ERROR::BVH_PICKING_BENCHMARK::MISMATCH: click " << click << " (bvh "
+                          << (found ? hit.distance : -1.0f) << ", brute force "
+                          << (expected == FLT_MAX ? -1.0f : expected) << ")" << std::endl;
+                return -1;
+            }
+        }
+    }
+
+    std::cout << std::setprecision(4)
+              << "Picking: " << totalPickMs * 1000.0 / settings.CLICKS << " us average, "
+              << maxPickMs * 1000.0 << " us max, " << hits << "/" << settings.CLICKS << " hits" << std::endl;
+
+    // Refit: las esferas suben y bajan cada frame
+    std::vector<glm::vec3> animated(positions);
+    double refitMs = 0.0;
+    for (int frame = 0; frame < settings.REFIT_FRAMES; ++frame) {
+        const size_t verticesPerSphere = sphere.vertexs.size();
+        for (size_t v = 0; v < positions.size(); ++v)
+            animated[v].y = positions[v].y + 0.25f * std::sin(0.3f * frame + static_cast<float>(v / verticesPerSphere));
+        start = std::chrono::steady_clock::now();
+        bvh.refit(animated);
+        refitMs += millisecondsSince(start);
+    }
+    std::cout << std::setprecision(3)
+              << "Refit:   " << refitMs / settings.REFIT_FRAMES << " ms" << std::endl;
+
+    // Culling jerárquico frente al lote plano de Frustum
+    std::uniform_real_distribution<float> position(-settings.WORLD_EXTENT, settings.WORLD_EXTENT);
+    std::uniform_real_distribution<float> size(0.1f, 1.0f);
+    engine::graphics::BoxBatch boxes;
+    boxes.reserve(settings.CULL_OBJECTS);
+    for (size_t i = 0; i < settings.CULL_OBJECTS; ++i) {
+        glm::vec3 center(position(random), position(random), position(random));
+        glm::vec3 halfExtent(size(random), size(random), size(random));
+        boxes.add(center - halfExtent, center + halfExtent);
+    }
+
+    engine::graphics::Bvh sceneBvh;
+    start = std::chrono::steady_clock::now();
+    sceneBvh.build(boxes);
+    const double sceneBuildMs = millisecondsSince(start);
+
+    camera.setZFar(settings.WORLD_EXTENT);
+    const float aspectRatio = static_cast<float>(window.SCREEN_WIDTH) / window.SCREEN_HEIGHT;
+    std::vector<GLuint> visible;
+    double treeMs = 0.0, batchMs = 0.0;
+    for (int frame = 0; frame < settings.CULL_FRAMES; ++frame) {
+        camera.rotate(360.0f / settings.CULL_FRAMES / camera.mouseSensitivity(), 0.0f);
+        const engine::graphics::Frustum frustum = camera.frustum(aspectRatio);
+
+        start = std::chrono::steady_clock::now();
+        size_t treeVisible = sceneBvh.cull(frustum, visible);
+        treeMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t batchVisible = frustum.cull(boxes, visible);
+        batchMs += millisecondsSince(start);
+
+        const size_t tolerance = settings.CULL_OBJECTS / 10000;
+        if (treeVisible + tolerance < batchVisible || batchVisible + tolerance < treeVisible) {
+            std::cerr << "ERROR::BVH_PICKING_BENCHMARK::MISMATCH: frame " << frame << " (bvh " << treeVisible
+                      << ", batch " << batchVisible << ")" << std::endl;
+            return -1;
+        }
+    }
+
+    std::cout << settings.CULL_OBJECTS << " boxes, built in " << sceneBuildMs << " ms" << std::endl
+              << "Culling: bvh " << treeMs / settings.CULL_FRAMES << " ms, batch "
+              << batchMs / settings.CULL_FRAMES << " ms" << std::endl;
+
+    return 0;
+}
@@ -12,68 +12,11 @@ struct Window {
 
 struct Paths {
     const char *FRAGMENT_PATH = "../../assets/shaders/coordinate_systems/fragment_shader.frag";
-    const char *VERTEX_PATH = "../../assets/shaders/coordinate_systems/vertex_shader.vert";
+    const char *VERTEX_PATH = "../../assets/shaders/instancing/vertex_shader.vert";
     const char *TEXTURE_PATH = "../../assets/textures/ellen_joe.png";
 };
 
 struct Objects {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5)
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 0
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 1
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 2
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 3
-
-        // Cara trasera (z = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},   // 4
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}},  // 5
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 6
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},  // 7
-
-        // Cara derecha (x = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 8
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 9
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 10
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 11
-
-        // Cara izquierda (x = -0.5)
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},  // 12
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 13
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}},  // 14
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},   // 15
-
-        // Cara superior (y = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 16
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 17
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 18
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 19
-
-        // Cara inferior (y = -0.5)
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 20
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 21
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 22
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}} // 23
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-
     std::vector<glm::vec3> cubePosition = {
         glm::vec3(0.0f, 0.0f, 0.0f),    glm::vec3(2.0f, 5.0f, -15.0f),
         glm::vec3(-1.5f, -2.2f, -2.5f), glm::vec3(-3.8f, -2.0f, -12.3f),
@@ -345,7 +288,30 @@ int main()
 
     engine::graphics::Shader shader(paths.VERTEX_PATH, paths.FRAGMENT_PATH);
     engine::graphics::Texture texture0(paths.TEXTURE_PATH);
-    engine::graphics::Mesh mesh(obj.vertexs, obj.indexs, {&texture0});
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh mesh = shapes.mesh(0, {&texture0},
+                                              engine::graphics::VertexAttributes::POSITION
+                                            | engine::graphics::VertexAttributes::COLOR
+                                            | engine::graphics::VertexAttributes::TEXCOORDS);
+
+    std::vector<glm::mat4> models(obj.cubePosition.size());
+    for (GLuint i = 0; i < obj.cubePosition.size(); ++i) {
+        glm::mat4 model(1.0f);
+        model = glm::translate(model, obj.cubePosition[i]);
+        float angle = 20.0f * i;
+        models[i] = glm::rotate(model, glm::radians(angle),
+                                glm::vec3(1.0f, 0.3f, 0.5f));
+    }
+
+    // El shader de instancias lee las matrices del bloque "Camera"; esta demo
+    // construye su propia cámara, así que rellena el bloque ella misma
+    engine::graphics::CameraUniforms cameraUniforms = {};
+    GLuint cameraBuffer = 0;
+    glCreateBuffers(1, &cameraBuffer);
+    glNamedBufferData(cameraBuffer, sizeof(cameraUniforms), nullptr, GL_DYNAMIC_DRAW);
+    engine::graphics::GLStateCache::bindBufferBase(GL_UNIFORM_BUFFER,
+                                                   engine::graphics::CAMERA_UNIFORM_BINDING,
+                                                   cameraBuffer);
 
     shader.use();
     shader.setUniform("uTexture", 0);
@@ -366,30 +332,29 @@ int main()
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        glm::mat4 view = glm::lookAt(
+        float aspectRatio = (float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT;
+        cameraUniforms.view = glm::lookAt(
             camera.position, camera.position + camera.forward, camera.up);
-        shader.setUniform("uView", view);
-
-        glm::mat4 projection = glm::perspective(glm::radians(camera.fov),
-                                                (float)window.SCREEN_WIDTH /
-                                                    (float)window.SCREEN_HEIGHT,
-                                                0.1f, 100.0f);
-        shader.setUniform("uProjection", projection);
-
-        for (GLuint i = 0; i < obj.cubePosition.size(); ++i) {
-            glm::mat4 model(1.0f);
-            model = glm::translate(model, obj.cubePosition[i]);
-            float angle = 20.0f * i;
-            model = glm::rotate(model, glm::radians(angle),
-                                glm::vec3(1.0f, 0.3f, 0.5f));
-            shader.setUniform("uModel", model);
-            mesh.draw(shader);
-        }
+        cameraUniforms.projection = glm::perspective(glm::radians(camera.fov),
+                                                     aspectRatio,
+                                                     0.1f, 100.0f);
+        cameraUniforms.viewProjection = cameraUniforms.projection * cameraUniforms.view;
+        cameraUniforms.inverseView = glm::inverse(cameraUniforms.view);
+        cameraUniforms.inverseProjection = glm::inverse(cameraUniforms.projection);
+        cameraUniforms.position = camera.position;
+        cameraUniforms.zNear = 0.1f;
+        cameraUniforms.zFar = 100.0f;
+        cameraUniforms.fov = glm::radians(camera.fov);
+        cameraUniforms.aspectRatio = aspectRatio;
+        glNamedBufferSubData(cameraBuffer, 0, sizeof(cameraUniforms), &cameraUniforms);
+
+        mesh.drawInstanced(shader, models);
 
         glfwSwapBuffers(window.window);
         glfwPollEvents();
     }
 
+    engine::graphics::GLStateCache::deleteBuffer(cameraBuffer);
     glfwTerminate();
 
     return 0;
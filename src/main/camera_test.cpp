@@ -12,68 +12,11 @@ struct Window {
 
 struct Paths {
     const char *FRAGMENT_PATH = "../../assets/shaders/coordinate_systems/fragment_shader.frag";
-    const char *VERTEX_PATH = "../../assets/shaders/coordinate_systems/vertex_shader.vert";
+    const char *VERTEX_PATH = "../../assets/shaders/instancing/vertex_shader.vert";
     const char *TEXTURE_PATH = "../../assets/textures/ellen_joe.png";
 };
 
 struct Objects {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5)
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 0
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 1
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 2
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 3
-
-        // Cara trasera (z = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},   // 4
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}},  // 5
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 6
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},  // 7
-
-        // Cara derecha (x = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 8
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 9
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 10
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 11
-
-        // Cara izquierda (x = -0.5)
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},  // 12
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 13
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}},  // 14
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},   // 15
-
-        // Cara superior (y = 0.5)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}},   // 16
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 17
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 18
-        {{-0.5f, 0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}},  // 19
-
-        // Cara inferior (y = -0.5)
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 20
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}},  // 21
-        {{-0.5f, -0.5f, 0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 22
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}} // 23
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-
     std::vector<glm::vec3> cubePosition = {
         glm::vec3(0.0f, 0.0f, 0.0f),    glm::vec3(2.0f, 5.0f, -15.0f),
         glm::vec3(-1.5f, -2.2f, -2.5f), glm::vec3(-3.8f, -2.0f, -12.3f),
@@ -194,7 +137,20 @@ int main()
 
     engine::graphics::Shader shader(paths.VERTEX_PATH, paths.FRAGMENT_PATH);
     engine::graphics::Texture texture0(paths.TEXTURE_PATH);
-    engine::graphics::Mesh mesh(obj.vertexs, obj.indexs, {&texture0});
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh mesh = shapes.mesh(0, {&texture0},
+                                              engine::graphics::VertexAttributes::POSITION
+                                            | engine::graphics::VertexAttributes::COLOR
+                                            | engine::graphics::VertexAttributes::TEXCOORDS);
+
+    std::vector<glm::mat4> models(obj.cubePosition.size());
+    for (GLuint i = 0; i < obj.cubePosition.size(); ++i) {
+        glm::mat4 model(1.0f);
+        model = glm::translate(model, obj.cubePosition[i]);
+        float angle = 20.0f * i;
+        models[i] = glm::rotate(model, glm::radians(angle),
+                                glm::vec3(1.0f, 0.3f, 0.5f));
+    }
 
     shader.use();
     shader.setUniform("uTexture", 0);
@@ -209,21 +165,9 @@ int main()
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        shader.setUniform("uView", camera.getViewMatrix());
+        camera.publish((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
 
-        shader.setUniform("uProjection", camera.getProjectionMatrix(
-                                             (float)window.SCREEN_WIDTH /
-                                             (float)window.SCREEN_HEIGHT));
-
-        for (GLuint i = 0; i < obj.cubePosition.size(); ++i) {
-            glm::mat4 model(1.0f);
-            model = glm::translate(model, obj.cubePosition[i]);
-            float angle = 20.0f * i;
-            model = glm::rotate(model, glm::radians(angle),
-                                glm::vec3(1.0f, 0.3f, 0.5f));
-            shader.setUniform("uModel", model);
-            mesh.draw(shader);
-        }
+        mesh.drawInstanced(shader, models);
 
         engine::input::Mouse::update();
 
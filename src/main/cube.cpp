@@ -16,70 +16,6 @@ struct Paths {
 };
 
 struct Objects {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5)
-        {{ 0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 0
-        {{ 0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 1
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 2
-        {{-0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}, // 3
-        
-        // Cara trasera (z = 0.5)
-        {{ 0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}, // 4
-        {{ 0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 5
-        {{-0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 6
-        {{-0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 7
-        
-        // Cara derecha (x = 0.5)
-        {{ 0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 8
-        {{ 0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 9
-        {{ 0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 10
-        {{ 0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}, // 11
-        
-        // Cara izquierda (x = -0.5)
-        {{-0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 12
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 13
-        {{-0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 14
-        {{-0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}, // 15
-        
-        // Cara superior (y = 0.5)
-        {{ 0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 16
-        {{ 0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 17
-        {{-0.5f,  0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 18
-        {{-0.5f,  0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}, // 19
-        
-        // Cara inferior (y = -0.5)
-        {{ 0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 1.0f}}, // 20
-        {{ 0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {1.0f, 0.0f}}, // 21
-        {{-0.5f, -0.5f,  0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 0.0f}}, // 22
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, 1.0f}}  // 23
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3,
-        1, 2, 3,
-        
-        // Cara trasera
-        4, 5, 7,
-        5, 6, 7,
-        
-        // Cara derecha
-        8, 9, 11,
-        9, 10, 11,
-        
-        // Cara izquierda
-        12, 13, 15,
-        13, 14, 15,
-        
-        // Cara superior
-        16, 17, 19,
-        17, 18, 19,
-        
-        // Cara inferior
-        20, 21, 23,
-        21, 22, 23
-    };
-
     std::vector<glm::vec3> cubePosition = {
         glm::vec3( 0.0f,  0.0f,  -10.0f), 
         glm::vec3( 2.0f,  5.0f, -25.0f), 
@@ -150,7 +86,11 @@ int main() {
 
     engine::graphics::Texture texture0(paths.TEXTURE_PATH);
 
-    engine::graphics::Mesh cube(obj.vertexs, obj.indexs, {&texture0});
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh cube = shapes.mesh(0, {&texture0},
+                                              engine::graphics::VertexAttributes::POSITION
+                                            | engine::graphics::VertexAttributes::COLOR
+                                            | engine::graphics::VertexAttributes::TEXCOORDS);
 
     shader.use();
     shader.setUniform("uTexture", 0);
@@ -0,0 +1,114 @@
+/**
+ * @file frustum_culling_benchmark.cpp
+ * @brief Mide el culling por lotes de Camera con un millón de cajas y esferas
+ *
+ * Reparte los volúmenes al azar alrededor de la cámara y la hace girar una
+ * vuelta completa. En cada frame compara el lote SIMD de Frustum::cull con
+ * un bucle que prueba objeto a objeto con Frustum::intersects, y comprueba
+ * que ambos aceptan el mismo número de objetos.
+ *
+ * Uso: frustum_culling_benchmark [objetos]
+ */
+
+#include "engine/engine.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+struct Settings {
+    size_t OBJECT_COUNT = 1000000;
+    int FRAMES = 360;
+    float WORLD_EXTENT = 100.0f;
+    float ASPECT_RATIO = 16.0f / 9.0f;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    if (argc > 1)
+        settings.OBJECT_COUNT = std::strtoull(argv[1], nullptr, 10);
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> position(-settings.WORLD_EXTENT, settings.WORLD_EXTENT);
+    std::uniform_real_distribution<float> size(0.1f, 1.0f);
+
+    engine::graphics::BoxBatch boxes;
+    engine::graphics::SphereBatch spheres;
+    boxes.reserve(settings.OBJECT_COUNT);
+    spheres.reserve(settings.OBJECT_COUNT);
+    for (size_t i = 0; i < settings.OBJECT_COUNT; ++i) {
+        glm::vec3 center(position(random), position(random), position(random));
+        glm::vec3 halfExtent(size(random), size(random), size(random));
+        boxes.add(center - halfExtent, center + halfExtent);
+        spheres.add(center, glm::length(halfExtent));
+    }
+
+    engine::graphics::Camera camera;
+    camera.setZFar(settings.WORLD_EXTENT);
+
+    std::vector<GLuint> visible;
+    double boxBatchMs = 0.0, boxScalarMs = 0.0, sphereBatchMs = 0.0, sphereScalarMs = 0.0;
+    size_t visibleBoxes = 0, visibleSpheres = 0;
+
+    for (int frame = 0; frame < settings.FRAMES; ++frame) {
+        camera.rotate(360.0f / settings.FRAMES / camera.mouseSensitivity(), 0.0f);
+        const engine::graphics::Frustum frustum = camera.frustum(settings.ASPECT_RATIO);
+
+        auto start = std::chrono::steady_clock::now();
+        size_t batchBoxes = camera.cull(boxes, settings.ASPECT_RATIO, visible);
+        boxBatchMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t scalarBoxes = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            scalarBoxes += frustum.intersects(glm::vec3(boxes.minX[i], boxes.minY[i], boxes.minZ[i]),
+                                              glm::vec3(boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]));
+        }
+        boxScalarMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t batchSpheres = camera.cull(spheres, settings.ASPECT_RATIO, visible);
+        sphereBatchMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        size_t scalarSpheres = 0;
+        for (size_t i = 0; i < spheres.size(); ++i) {
+            scalarSpheres += frustum.intersects(glm::vec3(spheres.centerX[i], spheres.centerY[i], spheres.centerZ[i]),
+                                                spheres.radius[i]);
+        }
+        sphereScalarMs += millisecondsSince(start);
+
+        // Con FMA el compilador puede contraer el bucle escalar y redondear distinto en los bordes
+        const size_t tolerance = settings.OBJECT_COUNT / 10000;
+        if (batchBoxes + tolerance < scalarBoxes || scalarBoxes + tolerance < batchBoxes ||
+            batchSpheres + tolerance < scalarSpheres || scalarSpheres + tolerance < batchSpheres) {
+            std::cerr << "ERROR::FRUSTUM_CULLING_BENCHMARK::MISMATCH: frame " << frame << " (boxes "
+                      << batchBoxes << "/" << scalarBoxes << ", spheres " << batchSpheres << "/" << scalarSpheres
+                      << ")" << std::endl;
+            return -1;
+        }
+        visibleBoxes += batchBoxes;
+        visibleSpheres += batchSpheres;
+    }
+
+    const double frames = settings.FRAMES;
+    std::cout << std::fixed << std::setprecision(3)
+              << settings.OBJECT_COUNT << " objects, " << settings.FRAMES << " frames" << std::endl
+              << "Boxes:   batch " << boxBatchMs / frames << " ms, scalar " << boxScalarMs / frames
+              << " ms (" << std::setprecision(1) << boxScalarMs / boxBatchMs << "x), "
+              << visibleBoxes / settings.FRAMES << " visible/frame" << std::endl
+              << std::setprecision(3)
+              << "Spheres: batch " << sphereBatchMs / frames << " ms, scalar " << sphereScalarMs / frames
+              << " ms (" << std::setprecision(1) << sphereScalarMs / sphereBatchMs << "x), "
+              << visibleSpheres / settings.FRAMES << " visible/frame" << std::endl;
+
+    return 0;
+}
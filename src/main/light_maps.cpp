@@ -24,65 +24,6 @@ struct Paths {
     const char* SPECULAR_MAP_PATH = "../../assets/textures/light_maps/container2_specular.png";
 };
 
-struct Cube {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5) - Normal: (0, 0, -1)
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},   // 0 - Esquina superior derecha
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},  // 1 - Esquina inferior derecha
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}}, // 2 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},  // 3 - Esquina superior izquierda
-
-        // Cara trasera (z = 0.5) - Normal: (0, 0, 1)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},   // 4 - Esquina superior derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},  // 5 - Esquina inferior derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}, // 6 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},  // 7 - Esquina superior izquierda
-
-        // Cara derecha (x = 0.5) - Normal: (1, 0, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},   // 8 - Esquina superior trasera
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},  // 9 - Esquina inferior trasera
-        {{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}, // 10 - Esquina inferior frontal
-        {{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},  // 11 - Esquina superior frontal
-
-        // Cara izquierda (x = -0.5) - Normal: (-1, 0, 0)
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},  // 12 - Esquina superior frontal
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}, // 13 - Esquina inferior frontal
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}},  // 14 - Esquina inferior trasera
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},   // 15 - Esquina superior trasera
-
-        // Cara superior (y = 0.5) - Normal: (0, 1, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},   // 16 - Esquina trasera derecha
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}},  // 17 - Esquina frontal derecha
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}, // 18 - Esquina frontal izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},  // 19 - Esquina trasera izquierda
-
-        // Cara inferior (y = -0.5) - Normal: (0, -1, 0)
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, -1.0f, 0.0f}}, // 20 - Esquina frontal derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}},  // 21 - Esquina trasera derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}, // 22 - Esquina trasera izquierda
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}} // 23 - Esquina frontal izquierda
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-};
-
 void framebufferSizeCallback(GLFWwindow *window, int width, int height)
 {
     glViewport(0, 0, width, height);
@@ -187,7 +128,6 @@ int main()
 {
     Window window;
     Paths paths;
-    Cube cube;
     
     engine::core::Light light;
     light.position = glm::vec3(1.2f, 1.0f, 2.0f);
@@ -203,24 +143,58 @@ int main()
         return -1;
     }
 
-    engine::graphics::Shader lighting(paths.VERTEX_PATH, paths.LIGHTING_PATH);
-    engine::graphics::Shader lightCube(paths.VERTEX_PATH, paths.LIGHT_CUBE_PATH);
+    // Los programas se compilan en el driver mientras se cargan las texturas;
+    // vertex_shader.vert se compila una sola vez para los dos
+    engine::graphics::ShaderLibrary shaders;
+    shaders.add("lighting", paths.VERTEX_PATH, paths.LIGHTING_PATH, {"HAS_SPECULAR_MAP"});
+    shaders.add("lightCube", paths.VERTEX_PATH, paths.LIGHT_CUBE_PATH);
+    shaders.compileAll();
+
     engine::graphics::Texture diffuseMap(paths.DIFFUSE_MAP_PATH);
     engine::graphics::Texture specularMap(paths.SPECULAR_MAP_PATH);
-    engine::graphics::Mesh object(cube.vertexs, cube.indexs, {&diffuseMap, &specularMap}, 
-                                  engine::graphics::VertexAttributes::POSITION
-                                | engine::graphics::VertexAttributes::NORMAL 
-                                | engine::graphics::VertexAttributes::TEXCOORDS);
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh object = shapes.mesh(0, {&diffuseMap, &specularMap},
+                                                engine::graphics::VertexAttributes::POSITION
+                                              | engine::graphics::VertexAttributes::NORMAL
+                                              | engine::graphics::VertexAttributes::TEXCOORDS);
         
-    engine::graphics::Mesh lightMesh(cube.vertexs, cube.indexs, {},
-                                     engine::graphics::VertexAttributes::POSITION | 
-                                     engine::graphics::VertexAttributes::NORMAL);
+    engine::graphics::Mesh lightMesh = shapes.mesh(0, {}, engine::graphics::VertexAttributes::POSITION);
+
+    // Pantalla de carga: una barra de progreso dibujada solo con glClear
+    engine::graphics::GLStateCache::enable(GL_SCISSOR_TEST);
+    while (!shaders.ready() && !glfwWindowShouldClose(window.window)) {
+        GLint barWidth = static_cast<GLint>(shaders.progress() * window.SCREEN_WIDTH);
+
+        glScissor(0, 0, window.SCREEN_WIDTH, window.SCREEN_HEIGHT);
+        glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glScissor(0, window.SCREEN_HEIGHT / 2 - 4, barWidth, 8);
+        glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+
+        glfwSwapBuffers(window.window);
+        glfwPollEvents();
+    }
+    engine::graphics::GLStateCache::disable(GL_SCISSOR_TEST);
+
+    engine::graphics::Shader& lighting = *shaders.get("lighting", {"HAS_SPECULAR_MAP"});
+    engine::graphics::Shader& lightCube = *shaders.get("lightCube");
+    std::cout << shaders.stats() << std::endl;
+
+    // Guardar cualquier .vert, .frag o .glsl usado recompila el programa sin reiniciar
+    shaders.watch();
 
     lighting.use();
     lighting.setUniform("uMaterial.diffuse", 0);
     lighting.setUniform("uMaterial.specular", 1);
 
-    glEnable(GL_DEPTH_TEST);
+    // La luz no cambia: se sube una vez entera al bloque "Lights"
+    engine::graphics::BlockBuffer<engine::core::Light> lightBlock(1);
+    lighting.bindBlock("Lights", lightBlock.binding());
+    lightBlock.upload(light);
+
+    engine::graphics::GLStateCache::enable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
 
@@ -229,14 +203,19 @@ int main()
         double currentTime = engine::core::Timer::getTimeSinceStart();
         float fps = engine::core::Timer::getFPS();
         if (currentTime - lastTime >= 1.0) {
+            // Llamadas de estado del último segundo: las omitidas no llegaron al driver
+            engine::graphics::GLStateCounter state = engine::graphics::GLStateCache::stats().total();
             glfwSetWindowTitle(window.window,
-                               std::format("{}{}", window.WINDOW_TITLE, engine::core::Timer::getFPS()).c_str());
+                               std::format("{}{} | GL state: {} issued, {} elided", window.WINDOW_TITLE,
+                                           engine::core::Timer::getFPS(), state.issued, state.elided).c_str());
+            engine::graphics::GLStateCache::resetStats();
 
             lastTime = currentTime;    
         }
 
         engine::core::Timer::update();
         processInput(window.window, camera);
+        shaders.update();
 
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
@@ -245,21 +224,11 @@ int main()
         float theta = time * 0.135f * std::sqrt(2.0);
         float phi = time * 0.3f * glm::pi<float>();
 
-        glm::mat4 view = camera.getViewMatrix();
-        glm::mat4 projection = camera.getProjectionMatrix((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
+        camera.publish((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
         glm::mat4 model(1.0f);
 
-        glm::mat3 normalMatrix = glm::mat3(view * model);
-
         lighting.use();
-        lighting.setUniform("uView", view);
-        lighting.setUniform("uProjection", projection);
-        lighting.setUniform("uNormalMatrix", normalMatrix);
         lighting.setUniform("uMaterial.shininess", 64.0f);
-        lighting.setUniform("uLight.position", light.position);
-        lighting.setUniform("uLight.ambient", light.ambient);
-        lighting.setUniform("uLight.diffuse", light.diffuse);
-        lighting.setUniform("uLight.specular", light.specular);
 
         model = glm::mat4(1.0f);
         lighting.setUniform("uModel", model);
@@ -267,8 +236,6 @@ int main()
         object.draw(lighting);
 
         lightCube.use();
-        lightCube.setUniform("uView", view);
-        lightCube.setUniform("uProjection", projection);
         lightCube.setUniform("uLightColor", light.diffuse);
         
         model = glm::mat4(1.0f);
@@ -20,63 +20,6 @@ struct Paths {
 };
 
 struct Objects {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5) - Normal: (0, 0, -1)
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},   // 0 - Esquina superior derecha
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},  // 1 - Esquina inferior derecha
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}}, // 2 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},  // 3 - Esquina superior izquierda
-
-        // Cara trasera (z = 0.5) - Normal: (0, 0, 1)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},   // 4 - Esquina superior derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},  // 5 - Esquina inferior derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}, // 6 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},  // 7 - Esquina superior izquierda
-
-        // Cara derecha (x = 0.5) - Normal: (1, 0, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},   // 8 - Esquina superior trasera
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},  // 9 - Esquina inferior trasera
-        {{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}, // 10 - Esquina inferior frontal
-        {{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},  // 11 - Esquina superior frontal
-
-        // Cara izquierda (x = -0.5) - Normal: (-1, 0, 0)
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},  // 12 - Esquina superior frontal
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}, // 13 - Esquina inferior frontal
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}},  // 14 - Esquina inferior trasera
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},   // 15 - Esquina superior trasera
-
-        // Cara superior (y = 0.5) - Normal: (0, 1, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},   // 16 - Esquina trasera derecha
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}},  // 17 - Esquina frontal derecha
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}, // 18 - Esquina frontal izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},  // 19 - Esquina trasera izquierda
-
-        // Cara inferior (y = -0.5) - Normal: (0, -1, 0)
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, -1.0f, 0.0f}}, // 20 - Esquina frontal derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}},  // 21 - Esquina trasera derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}, // 22 - Esquina trasera izquierda
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}} // 23 - Esquina frontal izquierda
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-
     glm::vec3 lightPos = glm::vec3(1.2f, 1.0f, 2.0f);
     glm::vec3 lightColor = glm::vec3(1.0f, 1.0f, 1.0f);
     float ambientStrength = 0.1f;
@@ -192,13 +135,14 @@ int main()
     engine::graphics::Shader lighting(paths.VERTEX_PATH, paths.LIGHTING_PATH);
     engine::graphics::Shader lightCube(paths.VERTEX_PATH, paths.LIGHT_CUBE_PATH);
     engine::graphics::Texture rubikCube(paths.TEXTURE_PATH);
-    engine::graphics::Mesh object(obj.vertexs, obj.indexs, {&rubikCube}, 
-                                  engine::graphics::VertexAttributes::POSITION | 
-                                  engine::graphics::VertexAttributes::NORMAL | 
-                                  engine::graphics::VertexAttributes::TEXCOORDS);
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh object = shapes.mesh(0, {&rubikCube},
+                                                engine::graphics::VertexAttributes::POSITION |
+                                                engine::graphics::VertexAttributes::NORMAL |
+                                                engine::graphics::VertexAttributes::TEXCOORDS);
         
-    engine::graphics::Mesh light(obj.vertexs, obj.indexs, {},
-                                 engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
+    engine::graphics::Mesh light = shapes.mesh(0, {},
+                                               engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
 
     lighting.use();
     lighting.setUniform("uTexture", 0);
@@ -222,12 +166,9 @@ int main()
         // obj.lightPos.y = radius * sin(phi);
         // obj.lightPos.z = radius * cos(phi) * sin(theta);
 
-        glm::mat4 view = camera.getViewMatrix();
-        glm::mat4 projection = camera.getProjectionMatrix((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
+        camera.publish((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
 
         lighting.use();
-        lighting.setUniform("uView", view);
-        lighting.setUniform("uProjection", projection);
         lighting.setUniform("uLightColor", obj.lightColor);
         lighting.setUniform("uLightPos", obj.lightPos);
         lighting.setUniform("uAmbientStrength", obj.ambientStrength);
@@ -240,8 +181,6 @@ int main()
         object.draw(lighting);
 
         lightCube.use();
-        lightCube.setUniform("uView", view);
-        lightCube.setUniform("uProjection", projection);
         lightCube.setUniform("uLightColor", obj.lightColor);
         
         model = glm::mat4(1.0f);
@@ -24,65 +24,6 @@ struct Paths {
     const char* TEXTURE_PATH = "../../assets/textures/ellen_joe.png";
 };
 
-struct Cube {
-    std::vector<engine::core::Vertex> vertexs = {
-        // Cara frontal (z = -0.5) - Normal: (0, 0, -1)
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},   // 0 - Esquina superior derecha
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}},  // 1 - Esquina inferior derecha
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}}, // 2 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, -1.0f}},  // 3 - Esquina superior izquierda
-
-        // Cara trasera (z = 0.5) - Normal: (0, 0, 1)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},   // 4 - Esquina superior derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}},  // 5 - Esquina inferior derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, 0.0f, 1.0f}}, // 6 - Esquina inferior izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 0.0f, 1.0f}},  // 7 - Esquina superior izquierda
-
-        // Cara derecha (x = 0.5) - Normal: (1, 0, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},   // 8 - Esquina superior trasera
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {1.0f, 0.0f, 0.0f}},  // 9 - Esquina inferior trasera
-        {{0.5f, -0.5f, -0.5f}, {0.0f, 0.0f}, {1.0f, 0.0f, 0.0f}}, // 10 - Esquina inferior frontal
-        {{0.5f, 0.5f, -0.5f}, {0.0f, 1.0f}, {1.0f, 0.0f, 0.0f}},  // 11 - Esquina superior frontal
-
-        // Cara izquierda (x = -0.5) - Normal: (-1, 0, 0)
-        {{-0.5f, 0.5f, -0.5f}, {1.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},  // 12 - Esquina superior frontal
-        {{-0.5f, -0.5f, -0.5f}, {1.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}}, // 13 - Esquina inferior frontal
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f}},  // 14 - Esquina inferior trasera
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {-1.0f, 0.0f, 0.0f}},   // 15 - Esquina superior trasera
-
-        // Cara superior (y = 0.5) - Normal: (0, 1, 0)
-        {{0.5f, 0.5f, 0.5f}, {1.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},   // 16 - Esquina trasera derecha
-        {{0.5f, 0.5f, -0.5f}, {1.0f, 0.0f}, {0.0f, 1.0f, 0.0f}},  // 17 - Esquina frontal derecha
-        {{-0.5f, 0.5f, -0.5f}, {0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}}, // 18 - Esquina frontal izquierda
-        {{-0.5f, 0.5f, 0.5f}, {0.0f, 1.0f}, {0.0f, 1.0f, 0.0f}},  // 19 - Esquina trasera izquierda
-
-        // Cara inferior (y = -0.5) - Normal: (0, -1, 0)
-        {{0.5f, -0.5f, -0.5f}, {1.0f, 1.0f}, {0.0f, -1.0f, 0.0f}}, // 20 - Esquina frontal derecha
-        {{0.5f, -0.5f, 0.5f}, {1.0f, 0.0f}, {0.0f, -1.0f, 0.0f}},  // 21 - Esquina trasera derecha
-        {{-0.5f, -0.5f, 0.5f}, {0.0f, 0.0f}, {0.0f, -1.0f, 0.0f}}, // 22 - Esquina trasera izquierda
-        {{-0.5f, -0.5f, -0.5f}, {0.0f, 1.0f}, {0.0f, -1.0f, 0.0f}} // 23 - Esquina frontal izquierda
-    };
-
-    std::vector<GLuint> indexs = {
-        // Cara frontal
-        0, 1, 3, 1, 2, 3,
-
-        // Cara trasera
-        4, 5, 7, 5, 6, 7,
-
-        // Cara derecha
-        8, 9, 11, 9, 10, 11,
-
-        // Cara izquierda
-        12, 13, 15, 13, 14, 15,
-
-        // Cara superior
-        16, 17, 19, 17, 18, 19,
-
-        // Cara inferior
-        20, 21, 23, 21, 22, 23};
-};
-
 void framebufferSizeCallback(GLFWwindow *window, int width, int height)
 {
     glViewport(0, 0, width, height);
@@ -187,7 +128,6 @@ int main()
 {
     Window window;
     Paths paths;
-    Cube cube;
     engine::core::Material material;
     material.ambient = glm::vec3(1.0f, 0.5f, 0.31f);
     material.diffuse = glm::vec3(1.0f, 0.5f, 0.31f);
@@ -216,17 +156,23 @@ int main()
     engine::graphics::Shader lighting(paths.VERTEX_PATH, paths.LIGHTING_PATH);
     engine::graphics::Shader lightCube(paths.VERTEX_PATH, paths.LIGHT_CUBE_PATH);
     engine::graphics::Texture rubikCube(paths.TEXTURE_PATH);
-    engine::graphics::Mesh object(cube.vertexs, cube.indexs, {&rubikCube}, 
-                                  engine::graphics::VertexAttributes::POSITION | 
-                                  engine::graphics::VertexAttributes::NORMAL | 
-                                  engine::graphics::VertexAttributes::TEXCOORDS);
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh object = shapes.mesh(0, {&rubikCube},
+                                                engine::graphics::VertexAttributes::POSITION |
+                                                engine::graphics::VertexAttributes::NORMAL |
+                                                engine::graphics::VertexAttributes::TEXCOORDS);
         
-    engine::graphics::Mesh lightMesh(cube.vertexs, cube.indexs, {},
-                                 engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
+    engine::graphics::Mesh lightMesh = shapes.mesh(0, {},
+                                                   engine::graphics::VertexAttributes::POSITION | engine::graphics::VertexAttributes::NORMAL);
 
     // lighting.use();
     // lighting.setUniform("uTexture", 0);
 
+    engine::graphics::BlockBuffer<engine::core::Light> lightBlock(1);
+    engine::graphics::BlockBuffer<engine::core::Material> materialBlock(2);
+    lighting.bindBlock("Lights", lightBlock.binding());
+    lighting.bindBlock("Materials", materialBlock.binding());
+
     glEnable(GL_DEPTH_TEST);
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
@@ -256,20 +202,13 @@ int main()
         // material.lightPos.y = radius * sin(phi);
         // material.lightPos.z = radius * cos(phi) * sin(theta);
 
-        glm::mat4 view = camera.getViewMatrix();
-        glm::mat4 projection = camera.getProjectionMatrix((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
+        camera.publish((float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT);
+
+        // El editor puede cambiar el material y la luz en cualquier momento
+        lightBlock.upload(light);
+        materialBlock.upload(material);
 
         lighting.use();
-        lighting.setUniform("uView", view);
-        lighting.setUniform("uProjection", projection);
-        lighting.setUniform("uMaterial.ambient", material.ambient);
-        lighting.setUniform("uMaterial.diffuse", material.diffuse);
-        lighting.setUniform("uMaterial.specular", material.specular);
-        lighting.setUniform("uMaterial.shininess", material.shininess);
-        lighting.setUniform("uLight.position", light.position);
-        lighting.setUniform("uLight.ambient", light.ambient);
-        lighting.setUniform("uLight.diffuse", light.diffuse);
-        lighting.setUniform("uLight.specular", light.specular);
 
         glm::mat4 model = glm::mat4(1.0f);
         lighting.setUniform("uModel", model);
@@ -277,8 +216,6 @@ int main()
         object.draw(lighting);
 
         lightCube.use();
-        lightCube.setUniform("uView", view);
-        lightCube.setUniform("uProjection", projection);
         lightCube.setUniform("uLightColor", light.diffuse);
         
         model = glm::mat4(1.0f);
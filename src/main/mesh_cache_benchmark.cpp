@@ -0,0 +1,121 @@
+/**
+ * @file mesh_cache_benchmark.cpp
+ * @brief Compara el arranque desde OBJ con el arranque desde caché .emesh
+ *
+ * Carga el OBJ indicado (o el cubo de ejemplo) con ObjLoader, guarda cada
+ * malla en un archivo .emesh junto al OBJ y mide cuánto tarda en volver a
+ * crearse desde la caché. glFinish asegura que ambos tiempos incluyen la
+ * subida a la GPU.
+ *
+ * Uso: mesh_cache_benchmark [ruta.obj]
+ */
+
+#include "engine/engine.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct Window {
+    GLuint SCREEN_WIDTH = 256;
+    GLuint SCREEN_HEIGHT = 256;
+    const char *WINDOW_TITLE = "MeshCache Benchmark";
+    GLFWwindow *window = nullptr;
+};
+
+struct Paths {
+    const char* MODEL_PATH = "../../assets/models/cube.obj";
+};
+
+bool windowInit(Window &window)
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    window.window = glfwCreateWindow(window.SCREEN_WIDTH, window.SCREEN_HEIGHT,
+                                     window.WINDOW_TITLE, nullptr, nullptr);
+
+    if (!window.window) {
+        std::cerr << "ERROR::GLFW::WINDOW::FAILURE_INITIALITATION" << std::endl;
+        glfwTerminate();
+        return false;
+    }
+
+    glfwMakeContextCurrent(window.window);
+
+    return true;
+}
+
+bool gladInit()
+{
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "ERROR::GLAD::FAILURE_INITIALITATION" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv)
+{
+    Window window;
+    Paths paths;
+    const char* path = argc > 1 ? argv[1] : paths.MODEL_PATH;
+
+    if (!windowInit(window) || !gladInit())
+        return -1;
+
+    auto start = std::chrono::steady_clock::now();
+    engine::graphics::ObjModel model = engine::graphics::ObjLoader::load(path);
+    glFinish();
+    double objSeconds = secondsSince(start);
+
+    if (model.meshes.empty()) {
+        glfwTerminate();
+        return -1;
+    }
+
+    std::vector<std::string> cachePaths;
+    for (size_t i = 0; i < model.meshes.size(); ++i) {
+        cachePaths.push_back(std::string(path) + "." + std::to_string(i) + ".emesh");
+        if (!engine::graphics::MeshCache::save(cachePaths.back().c_str(), model.meshes[i])) {
+            glfwTerminate();
+            return -1;
+        }
+    }
+
+    start = std::chrono::steady_clock::now();
+    std::vector<engine::graphics::Mesh> cached;
+    for (const std::string& cachePath : cachePaths) {
+        std::optional<engine::graphics::Mesh> mesh = engine::graphics::MeshCache::load(cachePath.c_str());
+        if (mesh)
+            cached.push_back(std::move(*mesh));
+    }
+    glFinish();
+    double cacheSeconds = secondsSince(start);
+
+    size_t bytes = 0;
+    for (const engine::graphics::Mesh& mesh : cached)
+        bytes += mesh.memoryStats().vertexBytes + mesh.memoryStats().indexBytes;
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "OBJ:    " << objSeconds << " s" << std::endl
+              << "emesh:  " << cacheSeconds << " s (" << cached.size() << " meshes, "
+              << std::setprecision(1) << bytes / (1024.0 * 1024.0) << " MB)" << std::endl
+              << "Speedup: " << objSeconds / cacheSeconds << "x" << std::endl;
+
+    cached.clear();
+    model.meshes.clear();
+    glfwTerminate();
+    return 0;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file obj_loader_benchmark.cpp
+ * @brief Mide el tiempo de carga de un OBJ con ObjLoader
+ *
+ * Analiza el archivo indicado (o el cubo de ejemplo) con distinto número de
+ * hilos y muestra el tiempo, el throughput y la geometría resultante. Solo
+ * usa ObjLoader::parse, por lo que no necesita contexto OpenGL.
+ *
+ * Uso: obj_loader_benchmark [ruta.obj]
+ */
+
+#include "engine/graphics/obj_loader.hpp"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+struct Paths {
+    const char* MODEL_PATH = "../../assets/models/cube.obj";
+};
+
+int main(int argc, char** argv)
+{
+    Paths paths;
+    const char* path = argc > 1 ? argv[1] : paths.MODEL_PATH;
+
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    const double megabytes = probe ? static_cast<double>(probe.tellg()) / (1024.0 * 1024.0) : 0.0;
+
+    unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2) {
+        engine::graphics::ObjLoadParams params;
+        params.threadCount = threads;
+
+        engine::graphics::ObjData data;
+        auto start = std::chrono::steady_clock::now();
+        if (!engine::graphics::ObjLoader::parse(path, data, params))
+            return -1;
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        size_t vertices = 0, triangles = 0;
+        for (const engine::graphics::ObjMeshData& mesh : data.meshes) {
+            vertices += mesh.vertexs.size();
+            triangles += mesh.indexs.size() / 3;
+        }
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << threads << " threads: " << seconds << " s, "
+                  << std::setprecision(1) << megabytes / seconds << " MB/s, "
+                  << data.meshes.size() << " meshes, "
+                  << vertices << " vertices, " << triangles << " triangles" << std::endl;
+    }
+
+    return 0;
+}
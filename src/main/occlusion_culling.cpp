@@ -0,0 +1,244 @@
+#include "engine/engine.hpp"
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+struct Window {
+    GLuint SCREEN_WIDTH = 1280;
+    GLuint SCREEN_HEIGHT = 720;
+    const char *WINDOW_TITLE = "Occlusion Culling";
+    GLFWwindow *window = nullptr;
+};
+
+struct Paths {
+    const char *FRAGMENT_PATH = "../../assets/shaders/coordinate_systems/fragment_shader.frag";
+    const char *VERTEX_PATH = "../../assets/shaders/coordinate_systems/vertex_shader.vert";
+    const char *TEXTURE_PATH = "../../assets/textures/ellen_joe.png";
+};
+
+struct Scene {
+    int ROOMS_PER_SIDE = 8;
+    int CUBES_PER_ROOM = 48;
+    float ROOM_SIZE = 10.0f;
+    float WALL_HEIGHT = 3.0f;
+    float WALL_THICKNESS = 0.2f;
+    float DOOR_WIDTH = 1.5f;
+    float CUBE_SIZE = 0.5f;
+
+    engine::graphics::BoxBatch walls;
+    engine::graphics::BoxBatch cubes;
+    std::vector<glm::mat4> wallModels;
+    std::vector<glm::mat4> cubeModels;
+};
+
+void framebufferSizeCallback(GLFWwindow *window, int width, int height)
+{
+    glViewport(0, 0, width, height);
+
+    Window *win = static_cast<Window *>(glfwGetWindowUserPointer(window));
+    if (win) {
+        win->SCREEN_WIDTH = width;
+        win->SCREEN_HEIGHT = height;
+    }
+}
+
+void processInput(GLFWwindow *window, engine::graphics::Camera &camera)
+{
+    if (glfwGetKey(window, GLFW_KEY_ESCAPE) == GLFW_PRESS)
+        glfwSetWindowShouldClose(window, true);
+
+    double deltaTime = engine::core::Timer::getDeltaTime();
+
+    camera.rotate(engine::input::Mouse::positionDeltaX() * deltaTime,
+                  engine::input::Mouse::positionDeltaY() * deltaTime);
+
+    camera.zoom(static_cast<float>(engine::input::Mouse::scrollDeltaY()) *
+                deltaTime);
+
+    glm::vec3 forward =
+        glm::normalize(glm::vec3(camera.forward().x, 0.0f, camera.forward().z));
+
+    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+        camera.move((float)deltaTime * forward);
+    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+        camera.move(-(float)deltaTime * forward);
+    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+        camera.moveRight(-camera.movementSpeed() * deltaTime);
+    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+        camera.moveRight(camera.movementSpeed() * deltaTime);
+}
+
+bool windowInit(Window &window)
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    window.window = glfwCreateWindow(window.SCREEN_WIDTH, window.SCREEN_HEIGHT,
+                                     window.WINDOW_TITLE, nullptr, nullptr);
+
+    if (!window.window) {
+        std::cerr << "ERROR::GLFW::WINDOW::FAILURE_INITIALITATION" << std::endl;
+        glfwTerminate();
+        return false;
+    }
+
+    glfwSetWindowUserPointer(window.window, &window);
+    glfwMakeContextCurrent(window.window);
+    glfwSetFramebufferSizeCallback(window.window, framebufferSizeCallback);
+    glfwSetInputMode(window.window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
+    glfwSetCursorPosCallback(window.window,
+                             engine::input::Mouse::cursorPositionCallback);
+    glfwSetScrollCallback(window.window, engine::input::Mouse::scrollCallback);
+
+    return true;
+}
+
+bool gladInit()
+{
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "ERROR::GLAD::FAILURE_INITIALITATION" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+/** Modelo que lleva el cubo unidad centrado en el origen a la caja dada */
+glm::mat4 boxModel(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), 0.5f * (boundsMin + boundsMax));
+    return glm::scale(model, boundsMax - boundsMin);
+}
+
+/** Rejilla de habitaciones con una puerta en cada pared interior y cubos repartidos dentro */
+void sceneInit(Scene &scene)
+{
+    const float half = 0.5f * scene.WALL_THICKNESS;
+    const float door = 0.5f * scene.DOOR_WIDTH;
+    auto addWall = [&](const glm::vec3 &boundsMin, const glm::vec3 &boundsMax) {
+        scene.walls.add(boundsMin, boundsMax);
+        scene.wallModels.push_back(boxModel(boundsMin, boundsMax));
+    };
+
+    for (int line = 0; line <= scene.ROOMS_PER_SIDE; ++line) {
+        const float fixed = line * scene.ROOM_SIZE;
+        const bool border = line == 0 || line == scene.ROOMS_PER_SIDE;
+        for (int room = 0; room < scene.ROOMS_PER_SIDE; ++room) {
+            const float start = room * scene.ROOM_SIZE;
+            const float middle = start + 0.5f * scene.ROOM_SIZE;
+            const float end = start + scene.ROOM_SIZE;
+            const float from[2] = { start, middle + door };
+            const float to[2] = { border ? end : middle - door, end };
+            for (int piece = 0; piece < (border ? 1 : 2); ++piece) {
+                addWall({ fixed - half, 0.0f, from[piece] }, { fixed + half, scene.WALL_HEIGHT, to[piece] });
+                addWall({ from[piece], 0.0f, fixed - half }, { to[piece], scene.WALL_HEIGHT, fixed + half });
+            }
+        }
+    }
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> inside(1.0f, scene.ROOM_SIZE - 1.0f);
+    std::uniform_real_distribution<float> height(0.0f, scene.WALL_HEIGHT - scene.CUBE_SIZE);
+    for (int roomZ = 0; roomZ < scene.ROOMS_PER_SIDE; ++roomZ) {
+        for (int roomX = 0; roomX < scene.ROOMS_PER_SIDE; ++roomX) {
+            for (int i = 0; i < scene.CUBES_PER_ROOM; ++i) {
+                glm::vec3 corner(roomX * scene.ROOM_SIZE + inside(random), height(random),
+                                 roomZ * scene.ROOM_SIZE + inside(random));
+                scene.cubes.add(corner, corner + glm::vec3(scene.CUBE_SIZE));
+                scene.cubeModels.push_back(boxModel(corner, corner + glm::vec3(scene.CUBE_SIZE)));
+            }
+        }
+    }
+}
+
+int main()
+{
+    Window window;
+    Paths paths;
+    Scene scene;
+    sceneInit(scene);
+
+    engine::graphics::Camera camera(glm::vec3(0.5f * scene.ROOM_SIZE, 1.7f, 0.5f * scene.ROOM_SIZE), 45.0f);
+    camera.setZFar(scene.ROOM_SIZE * scene.ROOMS_PER_SIDE * 1.5f);
+    engine::input::Mouse::init(window.SCREEN_WIDTH, window.SCREEN_HEIGHT);
+    engine::core::Timer::initialitation();
+
+    if (!windowInit(window) | !gladInit())
+        return -1;
+
+    engine::graphics::Shader shader(paths.VERTEX_PATH, paths.FRAGMENT_PATH);
+    engine::graphics::Texture texture0(paths.TEXTURE_PATH);
+    engine::graphics::PrimitiveBuffer shapes({ engine::graphics::primitives::CUBE });
+    engine::graphics::Mesh cube = shapes.mesh(0, {&texture0},
+                                              engine::graphics::VertexAttributes::POSITION
+                                            | engine::graphics::VertexAttributes::COLOR
+                                            | engine::graphics::VertexAttributes::TEXCOORDS);
+
+    engine::graphics::OcclusionCuller culler;
+    std::vector<GLuint> visibleWalls;
+    std::vector<GLuint> visibleCubes;
+
+    shader.use();
+    shader.setUniform("uTexture", 0);
+
+    glEnable(GL_DEPTH_TEST);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+
+    double lastTime = engine::core::Timer::getTimeSinceStart();
+    while (!glfwWindowShouldClose(window.window)) {
+        engine::core::Timer::update();
+        processInput(window.window, camera);
+
+        const float aspectRatio = (float)window.SCREEN_WIDTH / (float)window.SCREEN_HEIGHT;
+        const glm::mat4 view = camera.getViewMatrix();
+        const glm::mat4 projection = camera.getProjectionMatrix(aspectRatio);
+
+        // Las paredes visibles tapan a los cubos: se rasterizan como oclusores
+        camera.cull(scene.walls, aspectRatio, visibleWalls);
+        culler.beginFrame(projection * view);
+        for (GLuint wall : visibleWalls) {
+            culler.addOccluder(glm::vec3(scene.walls.minX[wall], scene.walls.minY[wall], scene.walls.minZ[wall]),
+                               glm::vec3(scene.walls.maxX[wall], scene.walls.maxY[wall], scene.walls.maxZ[wall]),
+                               glm::mat4(1.0f));
+        }
+        culler.rasterize();
+        culler.cull(scene.cubes, visibleCubes);
+
+        double currentTime = engine::core::Timer::getTimeSinceStart();
+        if (currentTime - lastTime >= 1.0) {
+            std::ostringstream title;
+            title << window.WINDOW_TITLE << " | " << visibleWalls.size() + visibleCubes.size() << " draws | "
+                  << culler.stats();
+            glfwSetWindowTitle(window.window, title.str().c_str());
+            lastTime = currentTime;
+        }
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        shader.setUniform("uView", view);
+        shader.setUniform("uProjection", projection);
+
+        for (GLuint wall : visibleWalls) {
+            shader.setUniform("uModel", scene.wallModels[wall]);
+            cube.draw(shader);
+        }
+
+        for (GLuint object : visibleCubes) {
+            shader.setUniform("uModel", scene.cubeModels[object]);
+            cube.draw(shader);
+        }
+
+        engine::input::Mouse::update();
+
+        glfwSwapBuffers(window.window);
+        glfwPollEvents();
+    }
+
+    glfwTerminate();
+
+    return 0;
+}
@@ -0,0 +1,168 @@
+/**
+ * @file occlusion_culling_benchmark.cpp
+ * @brief Mide cuántas llamadas de dibujo ahorra OcclusionCuller en un interior denso
+ *
+ * Genera una rejilla de habitaciones separadas por paredes con puertas y
+ * llena cada habitación de cubos. La cámara recorre las habitaciones girando
+ * sobre sí misma; en cada frame las paredes se rasterizan como oclusores y
+ * se cuentan los cubos que quedan tras el culling por frustum y tras el de
+ * oclusión. No necesita ventana ni GPU.
+ *
+ * Como comprobación, ningún cubo de la habitación en la que está la cámara
+ * puede quedar tapado: las paredes solo ocultan lo que hay detrás de ellas.
+ *
+ * Uso: occlusion_culling_benchmark [habitaciones por lado]
+ */
+
+#include "engine/engine.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+struct Settings {
+    int ROOMS_PER_SIDE = 16;
+    int CUBES_PER_ROOM = 64;
+    float ROOM_SIZE = 10.0f;
+    float WALL_HEIGHT = 3.0f;
+    float WALL_THICKNESS = 0.2f;
+    float DOOR_WIDTH = 1.5f;
+    float CUBE_SIZE = 0.5f;
+    int FRAMES = 360;
+    float ASPECT_RATIO = 16.0f / 9.0f;
+};
+
+struct Box {
+    glm::vec3 boundsMin;
+    glm::vec3 boundsMax;
+};
+
+double millisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/** Paredes a lo largo de las líneas de la rejilla, con una puerta en el centro de cada tramo */
+std::vector<Box> buildWalls(const Settings& settings)
+{
+    std::vector<Box> walls;
+    const float size = settings.ROOM_SIZE;
+    const float half = 0.5f * settings.WALL_THICKNESS;
+    const float door = 0.5f * settings.DOOR_WIDTH;
+    for (int line = 0; line <= settings.ROOMS_PER_SIDE; ++line) {
+        for (int room = 0; room < settings.ROOMS_PER_SIDE; ++room) {
+            const float start = room * size;
+            const float middle = start + 0.5f * size;
+            const float end = start + size;
+            const bool border = line == 0 || line == settings.ROOMS_PER_SIDE;
+            const float fixed = line * size;
+
+            // Pared paralela a Z (x fija) y pared paralela a X (z fija)
+            for (int orientation = 0; orientation < 2; ++orientation) {
+                auto wall = [&](float from, float to) {
+                    if (orientation == 0)
+                        walls.push_back({ glm::vec3(fixed - half, 0.0f, from), glm::vec3(fixed + half, settings.WALL_HEIGHT, to) });
+                    else
+                        walls.push_back({ glm::vec3(from, 0.0f, fixed - half), glm::vec3(to, settings.WALL_HEIGHT, fixed + half) });
+                };
+                if (border) {
+                    wall(start, end);
+                } else {
+                    wall(start, middle - door);
+                    wall(middle + door, end);
+                }
+            }
+        }
+    }
+    return walls;
+}
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    if (argc > 1)
+        settings.ROOMS_PER_SIDE = std::atoi(argv[1]);
+
+    const std::vector<Box> walls = buildWalls(settings);
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> inside(1.0f, settings.ROOM_SIZE - 1.0f);
+    std::uniform_real_distribution<float> height(0.0f, settings.WALL_HEIGHT - settings.CUBE_SIZE);
+    engine::graphics::BoxBatch cubes;
+    std::vector<int> cubeRoom;
+    for (int roomZ = 0; roomZ < settings.ROOMS_PER_SIDE; ++roomZ) {
+        for (int roomX = 0; roomX < settings.ROOMS_PER_SIDE; ++roomX) {
+            for (int i = 0; i < settings.CUBES_PER_ROOM; ++i) {
+                glm::vec3 corner(roomX * settings.ROOM_SIZE + inside(random), height(random),
+                                 roomZ * settings.ROOM_SIZE + inside(random));
+                cubes.add(corner, corner + glm::vec3(settings.CUBE_SIZE));
+                cubeRoom.push_back(roomZ * settings.ROOMS_PER_SIDE + roomX);
+            }
+        }
+    }
+
+    engine::graphics::OcclusionCuller culler;
+    std::vector<GLuint> visible;
+    double rasterizeMs = 0.0, cullMs = 0.0, frustumMs = 0.0;
+    size_t frustumDraws = 0, occlusionDraws = 0, occluderTriangles = 0;
+
+    for (int frame = 0; frame < settings.FRAMES; ++frame) {
+        // La cámara visita las habitaciones de la diagonal girando una vuelta en cada una
+        const int room = frame * settings.ROOMS_PER_SIDE / settings.FRAMES;
+        const float center = (room + 0.5f) * settings.ROOM_SIZE;
+        engine::graphics::Camera camera(glm::vec3(center, 1.7f, center), 8.0f * 360.0f * frame / settings.FRAMES);
+        camera.setZFar(settings.ROOM_SIZE * settings.ROOMS_PER_SIDE * 1.5f);
+
+        const glm::mat4 viewProjection = camera.getProjectionMatrix(settings.ASPECT_RATIO) * camera.getViewMatrix();
+
+        auto start = std::chrono::steady_clock::now();
+        frustumDraws += camera.cull(cubes, settings.ASPECT_RATIO, visible);
+        frustumMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        culler.beginFrame(viewProjection);
+        for (const Box& wall : walls)
+            culler.addOccluder(wall.boundsMin, wall.boundsMax, glm::mat4(1.0f));
+        culler.rasterize();
+        rasterizeMs += millisecondsSince(start);
+
+        start = std::chrono::steady_clock::now();
+        occlusionDraws += culler.cull(cubes, visible);
+        cullMs += millisecondsSince(start);
+        occluderTriangles += culler.stats().occluderTriangles;
+
+        // Todo cubo de la habitación de la cámara que esté en el frustum debe seguir visible
+        const int cameraRoom = room * settings.ROOMS_PER_SIDE + room;
+        const engine::graphics::Frustum frustum = camera.frustum(settings.ASPECT_RATIO);
+        size_t expected = 0, found = 0;
+        for (size_t i = 0; i < cubes.size(); ++i) {
+            if (cubeRoom[i] != cameraRoom)
+                continue;
+            glm::vec3 boundsMin(cubes.minX[i], cubes.minY[i], cubes.minZ[i]);
+            glm::vec3 boundsMax(cubes.maxX[i], cubes.maxY[i], cubes.maxZ[i]);
+            expected += frustum.intersects(boundsMin, boundsMax);
+            found += culler.isVisible(boundsMin, boundsMax);
+        }
+        if (found != expected) {
+            std::cerr << "ERROR::OCCLUSION_CULLING_BENCHMARK::FALSE_OCCLUSION: frame " << frame << " ("
+                      << found << "/" << expected << " cubes of the camera room visible)" << std::endl;
+            return -1;
+        }
+    }
+
+    const double frames = settings.FRAMES;
+    std::cout << std::fixed << std::setprecision(3)
+              << cubes.size() << " cubes, " << walls.size() << " walls, " << settings.FRAMES << " frames" << std::endl
+              << "Last frame: " << culler.stats() << std::endl
+              << "Draw calls: frustum " << frustumDraws / settings.FRAMES << ", occlusion "
+              << occlusionDraws / settings.FRAMES << " per frame (" << std::setprecision(1)
+              << 100.0 * (1.0 - static_cast<double>(occlusionDraws) / frustumDraws) << "% fewer)" << std::endl
+              << std::setprecision(3)
+              << "Rasterize: " << rasterizeMs / frames << " ms (" << occluderTriangles / settings.FRAMES
+              << " triangles), test: " << cullMs / frames << " ms, frustum only: " << frustumMs / frames
+              << " ms" << std::endl;
+
+    return 0;
+}
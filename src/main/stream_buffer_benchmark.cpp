@@ -0,0 +1,209 @@
+/**
+ * @file stream_buffer_benchmark.cpp
+ * @brief Compara el rendimiento de subida de vértices dinámicos
+ *
+ * Mide el throughput de subir geometría cada frame de dos formas:
+ * - glBufferData re-especificando el almacenamiento (ruta actual de las demos)
+ * - StreamBuffer persistente con triple partición y fences
+ *
+ * En ambos casos se dibuja la geometría para que la GPU realmente la lea.
+ * Con StreamBuffer los vértices se generan directamente en la memoria
+ * mapeada, sin copia intermedia.
+ */
+
+#include "engine/engine.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <vector>
+
+struct Window {
+    GLuint SCREEN_WIDTH = 256;
+    GLuint SCREEN_HEIGHT = 256;
+    const char *WINDOW_TITLE = "StreamBuffer Benchmark";
+    GLFWwindow *window = nullptr;
+};
+
+struct Config {
+    GLuint FRAMES = 500;
+    GLuint VERTICES_PER_FRAME = 100000;
+};
+
+const char *VERTEX_SOURCE = R"(
+#version 460 core
+layout (location = 0) in vec3 aPos;
+void main() { gl_Position = vec4(aPos, 1.0); }
+)";
+
+const char *FRAGMENT_SOURCE = R"(
+#version 460 core
+layout (location = 0) out vec4 FragColor;
+void main() { FragColor = vec4(1.0); }
+)";
+
+bool windowInit(Window &window)
+{
+    glfwInit();
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+    window.window = glfwCreateWindow(window.SCREEN_WIDTH, window.SCREEN_HEIGHT,
+                                     window.WINDOW_TITLE, nullptr, nullptr);
+
+    if (!window.window) {
+        std::cerr << "ERROR::GLFW::WINDOW::FAILURE_INITIALITATION" << std::endl;
+        glfwTerminate();
+        return false;
+    }
+
+    glfwMakeContextCurrent(window.window);
+    glfwSwapInterval(0);
+
+    return true;
+}
+
+bool gladInit()
+{
+    if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
+        std::cerr << "ERROR::GLAD::FAILURE_INITIALITATION" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+GLuint createProgram()
+{
+    GLuint vertex = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(vertex, 1, &VERTEX_SOURCE, nullptr);
+    glCompileShader(vertex);
+
+    GLuint fragment = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(fragment, 1, &FRAGMENT_SOURCE, nullptr);
+    glCompileShader(fragment);
+
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vertex);
+    glAttachShader(program, fragment);
+    glLinkProgram(program);
+
+    glDeleteShader(vertex);
+    glDeleteShader(fragment);
+
+    return program;
+}
+
+void generateFrame(std::span<engine::core::Vertex> vertexs, GLuint frame)
+{
+    float t = static_cast<float>(frame) * 0.01f;
+    for (GLuint i = 0; i < vertexs.size(); ++i) {
+        float angle = static_cast<float>(i) * 0.001f + t;
+        vertexs[i].m_position = glm::vec3(std::cos(angle), std::sin(angle), 0.0f) * 0.5f;
+    }
+}
+
+void printResult(const char *name, double seconds, const Config &config)
+{
+    double bytes = static_cast<double>(config.FRAMES) * config.VERTICES_PER_FRAME *
+                   sizeof(engine::core::Vertex);
+    std::cout << std::left << std::setw(14) << name << std::right << std::fixed
+              << std::setprecision(2)
+              << std::setw(10) << seconds * 1000.0 << " ms  "
+              << std::setw(10) << bytes / (1024.0 * 1024.0) / seconds << " MB/s  "
+              << std::setprecision(3)
+              << std::setw(8) << seconds * 1000.0 / config.FRAMES << " ms/frame"
+              << std::endl;
+}
+
+double benchmarkBufferData(const Config &config, GLuint program)
+{
+    std::vector<engine::core::Vertex> vertexs(config.VERTICES_PER_FRAME);
+
+    GLuint VAO, VBO;
+    glGenVertexArrays(1, &VAO);
+    glGenBuffers(1, &VBO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, VBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(engine::core::Vertex), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glUseProgram(program);
+    glFinish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (GLuint frame = 0; frame < config.FRAMES; ++frame) {
+        generateFrame(vertexs, frame);
+        glBufferData(GL_ARRAY_BUFFER,
+                     vertexs.size() * sizeof(engine::core::Vertex),
+                     vertexs.data(),
+                     GL_DYNAMIC_DRAW);
+        glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(vertexs.size()));
+    }
+    glFinish();
+    auto end = std::chrono::steady_clock::now();
+
+    glBindVertexArray(0);
+    glDeleteBuffers(1, &VBO);
+    glDeleteVertexArrays(1, &VAO);
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+double benchmarkStreamBuffer(const Config &config, GLuint program)
+{
+    GLsizei count = static_cast<GLsizei>(config.VERTICES_PER_FRAME);
+    engine::graphics::StreamBuffer stream(GL_ARRAY_BUFFER,
+                                          (count + 1) * sizeof(engine::core::Vertex));
+
+    GLuint VAO;
+    glGenVertexArrays(1, &VAO);
+    glBindVertexArray(VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.ID());
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(engine::core::Vertex), (void*)0);
+    glEnableVertexAttribArray(0);
+
+    glUseProgram(program);
+    glFinish();
+
+    auto start = std::chrono::steady_clock::now();
+    for (GLuint frame = 0; frame < config.FRAMES; ++frame) {
+        stream.beginFrame();
+        auto allocation = stream.allocate<engine::core::Vertex>(count);
+        generateFrame(allocation.data, frame);
+        glDrawArrays(GL_POINTS, allocation.first, count);
+        stream.endFrame();
+    }
+    glFinish();
+    auto end = std::chrono::steady_clock::now();
+
+    glBindVertexArray(0);
+    glDeleteVertexArrays(1, &VAO);
+
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main()
+{
+    Window window;
+    Config config;
+
+    if (!windowInit(window) | !gladInit())
+        return -1;
+
+    GLuint program = createProgram();
+
+    std::cout << config.FRAMES << " frames x " << config.VERTICES_PER_FRAME
+              << " vertices (" << sizeof(engine::core::Vertex) << " bytes per vertex)"
+              << std::endl;
+
+    printResult("glBufferData", benchmarkBufferData(config, program), config);
+    printResult("StreamBuffer", benchmarkStreamBuffer(config, program), config);
+
+    glDeleteProgram(program);
+    glfwTerminate();
+
+    return 0;
+}